@@ -0,0 +1,197 @@
+// Atomik is a library that implements basic chemical concepts such as elements, substances, and reactions.
+//
+// Copyright (C) 2018-2019 Allan Leal and Reaktoro Contributors
+//
+// This library is free software; you can redistribute it and/or
+// modify it under the terms of the GNU Lesser General Public
+// License as published by the Free Software Foundation; either
+// version 2.1 of the License, or (at your option) any later version.
+//
+// This library is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+// Lesser General Public License for more details.
+//
+// You should have received a copy of the GNU Lesser General Public License
+// along with this library. If not, see <http://www.gnu.org/licenses/>.
+
+// C++ includes
+#include <cstdint>
+#include <cstdlib>
+#include <new>
+#include <string>
+#include <thread>
+#include <vector>
+
+// Catch includes
+#include <catch2/catch.hpp>
+
+// Atomik includes
+#include <Atomik/AllocationCounter.test.hpp>
+using namespace Atomik;
+
+namespace {
+
+/// The allocations made by the current thread since it started, while at least one counter was active.
+thread_local AllocationStats counters;
+
+/// The number of active counters in the current thread.
+thread_local std::size_t depth = 0;
+
+/// The minimum size of the allocations made to fail in the current thread.
+thread_local std::size_t failingSize = SIZE_MAX;
+
+/// Allocate memory with given size and alignment and count the allocation if counting is active.
+auto allocate(std::size_t size, std::size_t alignment = 0) -> void*
+{
+    if(size == 0) size = 1;
+    if(size >= failingSize) return nullptr;
+    void* p = nullptr;
+    if(alignment > alignof(std::max_align_t))
+        p = std::aligned_alloc(alignment, (size + alignment - 1) / alignment * alignment);
+    else p = std::malloc(size);
+    if(p && depth)
+    {
+        ++counters.allocations;
+        counters.bytes += size;
+    }
+    return p;
+}
+
+/// Deallocate memory and count the deallocation if counting is active.
+auto deallocate(void* p) -> void
+{
+    if(p == nullptr) return;
+    if(depth) ++counters.deallocations;
+    std::free(p);
+}
+
+/// Allocate memory with given size and alignment, or throw std::bad_alloc on failure.
+auto allocateOrThrow(std::size_t size, std::size_t alignment = 0) -> void*
+{
+    if(void* p = allocate(size, alignment))
+        return p;
+    throw std::bad_alloc();
+}
+
+} // namespace
+
+auto operator new(std::size_t size) -> void* { return allocateOrThrow(size); }
+auto operator new[](std::size_t size) -> void* { return allocateOrThrow(size); }
+auto operator new(std::size_t size, std::align_val_t alignment) -> void* { return allocateOrThrow(size, std::size_t(alignment)); }
+auto operator new[](std::size_t size, std::align_val_t alignment) -> void* { return allocateOrThrow(size, std::size_t(alignment)); }
+auto operator new(std::size_t size, const std::nothrow_t&) noexcept -> void* { return allocate(size); }
+auto operator new[](std::size_t size, const std::nothrow_t&) noexcept -> void* { return allocate(size); }
+auto operator new(std::size_t size, std::align_val_t alignment, const std::nothrow_t&) noexcept -> void* { return allocate(size, std::size_t(alignment)); }
+auto operator new[](std::size_t size, std::align_val_t alignment, const std::nothrow_t&) noexcept -> void* { return allocate(size, std::size_t(alignment)); }
+
+auto operator delete(void* p) noexcept -> void { deallocate(p); }
+auto operator delete[](void* p) noexcept -> void { deallocate(p); }
+auto operator delete(void* p, std::size_t) noexcept -> void { deallocate(p); }
+auto operator delete[](void* p, std::size_t) noexcept -> void { deallocate(p); }
+auto operator delete(void* p, std::align_val_t) noexcept -> void { deallocate(p); }
+auto operator delete[](void* p, std::align_val_t) noexcept -> void { deallocate(p); }
+auto operator delete(void* p, std::size_t, std::align_val_t) noexcept -> void { deallocate(p); }
+auto operator delete[](void* p, std::size_t, std::align_val_t) noexcept -> void { deallocate(p); }
+auto operator delete(void* p, const std::nothrow_t&) noexcept -> void { deallocate(p); }
+auto operator delete[](void* p, const std::nothrow_t&) noexcept -> void { deallocate(p); }
+auto operator delete(void* p, std::align_val_t, const std::nothrow_t&) noexcept -> void { deallocate(p); }
+auto operator delete[](void* p, std::align_val_t, const std::nothrow_t&) noexcept -> void { deallocate(p); }
+
+namespace Atomik {
+
+AllocationCounter::AllocationCounter()
+: m_start(counters)
+{
+    ++depth;
+}
+
+AllocationCounter::~AllocationCounter()
+{
+    --depth;
+}
+
+AllocationFailure::AllocationFailure(std::size_t minBytes)
+: m_previous(failingSize)
+{
+    failingSize = minBytes;
+}
+
+AllocationFailure::~AllocationFailure()
+{
+    failingSize = m_previous;
+}
+
+auto AllocationCounter::stats() const -> AllocationStats
+{
+    AllocationStats res;
+    res.allocations = counters.allocations - m_start.allocations;
+    res.deallocations = counters.deallocations - m_start.deallocations;
+    res.bytes = counters.bytes - m_start.bytes;
+    return res;
+}
+
+} // namespace Atomik
+
+TEST_CASE("Testing AllocationCounter", "[AllocationCounter]")
+{
+    SECTION("When nothing is allocated")
+    {
+        const auto stats = countAllocations([]() {});
+        REQUIRE(stats.allocations == 0);
+        REQUIRE(stats.deallocations == 0);
+        REQUIRE(stats.bytes == 0);
+    }
+
+    SECTION("When objects are allocated with new and delete")
+    {
+        const auto stats = countAllocations([]()
+        {
+            delete new double(1.0);
+            delete[] new int[10];
+        });
+        REQUIRE(stats.allocations == 2);
+        REQUIRE(stats.deallocations == 2);
+        REQUIRE(stats.bytes == sizeof(double) + 10 * sizeof(int));
+    }
+
+    SECTION("When containers of the standard library allocate")
+    {
+        const auto stats = countAllocations([]()
+        {
+            std::vector<double> values;
+            values.reserve(100);
+            std::string small = "H2O";
+            std::string large(100, 'x');
+        });
+        REQUIRE(stats.allocations == 2);
+        REQUIRE(stats.deallocations == 2);
+        REQUIRE(stats.bytes == 100 * sizeof(double) + 101);
+    }
+
+    SECTION("When counters are nested")
+    {
+        AllocationCounter outer;
+        const auto inner = countAllocations([]() { delete new double(1.0); });
+        std::vector<double> values(10);
+        const auto stats = outer.stats();
+        REQUIRE(inner.allocations == 1);
+        REQUIRE(stats.allocations == 2);
+        REQUIRE(stats.deallocations == 1);
+    }
+
+    SECTION("When other threads allocate")
+    {
+        AllocationCounter counter;
+        std::thread([]() { std::vector<double> values(1000); }).join();
+        REQUIRE(counter.stats().bytes < 1000 * sizeof(double));
+    }
+
+    SECTION("When large allocations are made to fail")
+    {
+        AllocationFailure failure(1000);
+        REQUIRE_THROWS_AS(std::vector<double>(1000), std::bad_alloc);
+        REQUIRE(new (std::nothrow) char[1000] == nullptr);
+        REQUIRE_NOTHROW(std::vector<double>(10));
+    }
+}
@@ -0,0 +1,102 @@
+// Atomik is a library that implements basic chemical concepts such as elements, substances, and reactions.
+//
+// Copyright (C) 2018-2019 Allan Leal and Reaktoro Contributors
+//
+// This library is free software; you can redistribute it and/or
+// modify it under the terms of the GNU Lesser General Public
+// License as published by the Free Software Foundation; either
+// version 2.1 of the License, or (at your option) any later version.
+//
+// This library is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+// Lesser General Public License for more details.
+//
+// You should have received a copy of the GNU Lesser General Public License
+// along with this library. If not, see <http://www.gnu.org/licenses/>.
+
+#pragma once
+
+// C++ includes
+#include <cstddef>
+#include <utility>
+
+namespace Atomik {
+
+/// A type used to describe the heap allocations made during an operation.
+struct AllocationStats
+{
+    /// The number of calls to the global operator new.
+    std::size_t allocations = 0;
+
+    /// The number of calls to the global operator delete.
+    std::size_t deallocations = 0;
+
+    /// The total number of bytes requested from the global operator new.
+    std::size_t bytes = 0;
+};
+
+/// A type used to count the heap allocations made by the current thread while it is alive.
+/// The counting is done by the replacements of the global operators new and delete in the
+/// `tests` application, so it covers allocations from the standard library as well. Allocations
+/// made by other threads are not counted. Counters can be nested, in which case every active
+/// counter sees the allocations made during its lifetime.
+class AllocationCounter
+{
+public:
+    /// Construct an AllocationCounter object and start counting.
+    AllocationCounter();
+
+    /// Destroy this AllocationCounter object and stop counting.
+    ~AllocationCounter();
+
+    AllocationCounter(const AllocationCounter&) = delete;
+
+    auto operator=(const AllocationCounter&) -> AllocationCounter& = delete;
+
+    /// Return the allocations counted since construction.
+    auto stats() const -> AllocationStats;
+
+private:
+    /// The counters of the current thread when this object was constructed.
+    AllocationStats m_start;
+};
+
+/// A type used to make the large heap allocations of the current thread fail while it is alive.
+/// Every call to the global operator new in the current thread requesting at least the given
+/// number of bytes throws std::bad_alloc (or returns nullptr in its nothrow variants). This
+/// permits the failure paths of code allocating large buffers to be tested.
+class AllocationFailure
+{
+public:
+    /// Construct an AllocationFailure object making allocations of at least `minBytes` bytes fail.
+    explicit AllocationFailure(std::size_t minBytes);
+
+    /// Destroy this AllocationFailure object and restore the previous allocation behavior.
+    ~AllocationFailure();
+
+    AllocationFailure(const AllocationFailure&) = delete;
+
+    auto operator=(const AllocationFailure&) -> AllocationFailure& = delete;
+
+private:
+    /// The minimum size of the failing allocations when this object was constructed.
+    std::size_t m_previous;
+};
+
+/// Return the heap allocations made by the current thread while calling a function.
+/// The result of the function is destroyed before counting stops, so its deallocations are
+/// included. Call the function once beforehand to exclude one-time costs such as caches:
+/// ~~~
+/// const auto stats = countAllocations([]() { return Substance("H2O"); });
+/// REQUIRE(stats.allocations <= 8);
+/// ~~~
+template<typename Function>
+auto countAllocations(Function&& function) -> AllocationStats
+{
+    AllocationCounter counter;
+    std::forward<Function>(function)();
+    return counter.stats();
+}
+
+} // namespace Atomik
@@ -0,0 +1,129 @@
+// Atomik is a library that implements basic chemical concepts such as elements, substances, and reactions.
+//
+// Copyright (C) 2018-2019 Allan Leal and Reaktoro Contributors
+//
+// This library is free software; you can redistribute it and/or
+// modify it under the terms of the GNU Lesser General Public
+// License as published by the Free Software Foundation; either
+// version 2.1 of the License, or (at your option) any later version.
+//
+// This library is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+// Lesser General Public License for more details.
+//
+// You should have received a copy of the GNU Lesser General Public License
+// along with this library. If not, see <http://www.gnu.org/licenses/>.
+
+// Catch includes
+#include <catch2/catch.hpp>
+
+// Atomik includes
+#include <Atomik/AllocationCounter.test.hpp>
+#include <Atomik/ChemicalFormula.hpp>
+#include <Atomik/StringList.hpp>
+#include <Atomik/Substance.hpp>
+#include <Atomik/Substances.hpp>
+using namespace Atomik;
+
+// The allocation counts and bytes below are budgets measured with libstdc++ on a 64-bit platform.
+// Lower them when an optimization lands; raising them must be a deliberate decision.
+TEST_CASE("Testing allocation budgets of chemical formula parsing", "[allocations]")
+{
+    SECTION("When parsing into FormulaTerms")
+    {
+        FormulaTerms terms;
+        const auto stats = countAllocations([&]()
+        {
+            parseChemicalFormula(std::string_view("(NH4)2Fe(SO4)2.6H2O"), terms);
+            parseChemicalFormula(std::string_view("Fe+++"), terms);
+        });
+        REQUIRE(stats.allocations == 0);
+    }
+
+    SECTION("When parsing into a map")
+    {
+        const std::string formula = "(NH4)2Fe(SO4)2.6H2O";
+        const auto stats = countAllocations([&]() { return parseChemicalFormula(formula); });
+        REQUIRE(stats.allocations <= 6);
+        REQUIRE(stats.bytes <= 320);
+        REQUIRE(stats.deallocations == stats.allocations);
+    }
+}
+
+TEST_CASE("Testing allocation budgets of Substance", "[allocations]")
+{
+    // Each operation is performed once before counting so that one-time costs, such as interning, are excluded
+    auto budget = [](auto&& function)
+    {
+        function();
+        return countAllocations(function);
+    };
+
+    SECTION("When constructing from a formula")
+    {
+        const auto water = budget([]() { return Substance("H2O"); });
+        REQUIRE(water.allocations <= 11);
+        REQUIRE(water.bytes <= 584);
+        REQUIRE(water.deallocations == water.allocations);
+
+        const auto salt = budget([]() { return Substance("(NH4)2Fe(SO4)2.6H2O"); });
+        REQUIRE(salt.allocations <= 16);
+        REQUIRE(salt.bytes <= 960);
+        REQUIRE(salt.deallocations == salt.allocations);
+    }
+
+    SECTION("When copying and querying")
+    {
+        const Substance substance("CaCO3");
+        REQUIRE(budget([&]() { return Substance(substance); }).allocations == 0);
+        REQUIRE(budget([&]() { return substance.molarMass(); }).allocations == 0);
+        REQUIRE(budget([&]() { return substance.charge(); }).allocations == 0);
+    }
+
+    SECTION("When replacing the name")
+    {
+        Substance substance("CaCO3");
+        const auto stats = budget([&]() { return substance.replaceName("Calcite"); });
+        REQUIRE(stats.allocations <= 1);
+        REQUIRE(stats.bytes <= 104);
+    }
+}
+
+TEST_CASE("Testing allocation budgets of Substances", "[allocations]")
+{
+    // Each operation is performed once before counting so that one-time costs, such as interning, are excluded
+    auto budget = [](auto&& function)
+    {
+        function();
+        return countAllocations(function);
+    };
+
+    auto create = []()
+    {
+        return Substances({ Substance("H2O"), Substance("H+"), Substance("OH-"), Substance("CO2"), Substance("CaCO3") });
+    };
+
+    SECTION("When constructing")
+    {
+        const auto stats = budget(create);
+        REQUIRE(stats.allocations <= 58);
+        REQUIRE(stats.bytes <= 3464);
+        REQUIRE(stats.deallocations == stats.allocations);
+
+        const auto append = budget([]() { Substances substances; substances.append(Substance("H2O")); return substances; });
+        REQUIRE(append.allocations <= 12);
+        REQUIRE(append.bytes <= 648);
+    }
+
+    SECTION("When searching and filtering")
+    {
+        const auto substances = create();
+        const StringList tags("aqueous");
+        const StringList symbols("C O");
+        REQUIRE(budget([&]() { return substances.indexWithName("CO2"); }).allocations == 0);
+        REQUIRE(budget([&]() { return substances.indexWithFormula("CO2"); }).allocations <= 24);
+        REQUIRE(budget([&]() { return substances.withTags(tags); }).allocations <= 1);
+        REQUIRE(budget([&]() { return substances.withElements(symbols); }).allocations <= 1);
+    }
+}
@@ -0,0 +1,204 @@
+// Atomik is a library that implements basic chemical concepts such as elements, substances, and reactions.
+//
+// Copyright (C) 2018-2019 Allan Leal and Reaktoro Contributors
+//
+// This library is free software; you can redistribute it and/or
+// modify it under the terms of the GNU Lesser General Public
+// License as published by the Free Software Foundation; either
+// version 2.1 of the License, or (at your option) any later version.
+//
+// This library is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+// Lesser General Public License for more details.
+//
+// You should have received a copy of the GNU Lesser General Public License
+// along with this library. If not, see <http://www.gnu.org/licenses/>.
+
+#include "ArrayWriter.hpp"
+
+// C++ includes
+#include <algorithm>
+#include <fstream>
+#include <ostream>
+#include <type_traits>
+
+// Atomik includes
+#include <Atomik/Exception.hpp>
+#include <Atomik/SubstanceTable.hpp>
+
+namespace Atomik {
+namespace {
+
+/// True if the host stores numbers in little-endian byte order.
+#if defined(__BYTE_ORDER__) && __BYTE_ORDER__ == __ORDER_BIG_ENDIAN__
+constexpr bool littleEndian = false;
+#else
+constexpr bool littleEndian = true;
+#endif
+
+/// A type used to describe the values of an array.
+struct ArrayType
+{
+    /// The kind of the values (`f` for floating-point, `i` for signed, and `u` for unsigned integers).
+    char kind;
+
+    /// The size of each value in bytes.
+    std::size_t size;
+};
+
+/// Return the description of the values of type `T` in an array.
+template<typename T>
+constexpr auto arrayType() -> ArrayType
+{
+    return { std::is_floating_point_v<T> ? 'f' : std::is_signed_v<T> ? 'i' : 'u', sizeof(T) };
+}
+
+/// Write an unsigned integer in little-endian fixed-width encoding.
+template<typename T>
+auto writeFixed(std::ostream& out, T value) -> void
+{
+    char bytes[sizeof(T)];
+    for(auto i = 0u; i < sizeof(T); ++i)
+        bytes[i] = char((std::uint64_t(value) >> (8 * i)) & 0xff);
+    out.write(bytes, sizeof(T));
+}
+
+/// Write the header of an array with given values, shape, and order.
+auto writeHeader(std::ostream& out, ArrayType type, const std::vector<std::size_t>& shape, bool fortranOrder, ArrayFormat format) -> void
+{
+    if(format == ArrayFormat::Raw)
+    {
+        out.write(RawArrayFormat::magic, sizeof(RawArrayFormat::magic));
+        const char info[8] = { type.kind, char(type.size), char(fortranOrder), char(shape.size()), 0, 0, 0, 0 };
+        out.write(info, sizeof(info));
+        for(auto dim : shape)
+            writeFixed<std::uint64_t>(out, dim);
+        return;
+    }
+
+    std::string dims;
+    for(auto dim : shape)
+        dims += (dims.empty() ? "" : ", ") + std::to_string(dim);
+    if(shape.size() == 1)
+        dims += ',';
+
+    auto dict = str("{'descr': '", littleEndian ? '<' : '>', type.kind, type.size, "', 'fortran_order': ", fortranOrder ? "True" : "False", ", 'shape': (", dims, "), }");
+
+    // Pad the header with spaces and a line break so that the values start at a multiple of 64 bytes
+    const std::size_t preamble = 10; // the magic string, the version, and the size of the header
+    dict.resize(((preamble + dict.size() + 1 + 63) / 64) * 64 - preamble - 1, ' ');
+    dict += '\n';
+
+    out.write("\x93NUMPY\x01\x00", 8);
+    writeFixed<std::uint16_t>(out, dict.size());
+    out.write(dict.data(), dict.size());
+}
+
+/// Write the values of an array, swapping their bytes in chunks if the raw format requires a different byte order.
+template<typename T>
+auto writeValues(std::ostream& out, const T* values, std::size_t count, ArrayFormat format) -> void
+{
+    if(littleEndian || format == ArrayFormat::Npy)
+    {
+        out.write(reinterpret_cast<const char*>(values), count * sizeof(T));
+        return;
+    }
+
+    char buffer[4096];
+    constexpr auto chunk = sizeof(buffer) / sizeof(T);
+    for(std::size_t offset = 0; offset < count; offset += chunk)
+    {
+        const auto n = std::min(chunk, count - offset);
+        auto bytes = reinterpret_cast<const char*>(values + offset);
+        for(std::size_t i = 0; i < n; ++i)
+            std::reverse_copy(bytes + i * sizeof(T), bytes + (i + 1) * sizeof(T), buffer + i * sizeof(T));
+        out.write(buffer, n * sizeof(T));
+    }
+}
+
+/// Write a one-dimensional array of values to a stream.
+template<typename T>
+auto writeVector(std::ostream& out, const std::vector<T>& values, ArrayFormat format) -> void
+{
+    writeHeader(out, arrayType<T>(), { values.size() }, false, format);
+    writeValues(out, values.data(), values.size(), format);
+}
+
+/// Return the extension of the files of arrays in a given format.
+auto extension(ArrayFormat format) -> std::string
+{
+    return format == ArrayFormat::Npy ? ".npy" : ".bin";
+}
+
+/// Open a file, write to it with a given function, and check the file was written.
+template<typename Function>
+auto writeFile(const std::string& path, const Function& write) -> void
+{
+    std::ofstream file(path, std::ios::binary);
+    error(!file, "Could not open the file `", path, "` for writing.");
+    write(file);
+    file.flush();
+    error(!file, "Could not write the file `", path, "`.");
+}
+
+} // namespace
+
+auto writeArray(std::ostream& out, const std::vector<double>& values, ArrayFormat format) -> void
+{
+    writeVector(out, values, format);
+}
+
+auto writeArray(std::ostream& out, const std::vector<Index>& values, ArrayFormat format) -> void
+{
+    writeVector(out, values, format);
+}
+
+auto writeArray(std::ostream& out, const std::vector<std::size_t>& values, ArrayFormat format) -> void
+{
+    writeVector(out, values, format);
+}
+
+auto writeMolarMasses(const SubstanceTable& table, const std::string& path, ArrayFormat format) -> void
+{
+    writeFile(path, [&](std::ostream& out) { writeArray(out, table.molarMasses(), format); });
+}
+
+auto writeCharges(const SubstanceTable& table, const std::string& path, ArrayFormat format) -> void
+{
+    writeFile(path, [&](std::ostream& out) { writeArray(out, table.charges(), format); });
+}
+
+auto writeFormulaMatrix(std::ostream& out, const SubstanceTable& table, ArrayFormat format) -> void
+{
+    const auto& offsets = table.compositionOffsets();
+    const auto& ielements = table.compositionElements();
+    const auto& coefficients = table.compositionCoefficients();
+
+    writeHeader(out, arrayType<double>(), { table.elements().size(), table.size() }, true, format);
+
+    // Write the matrix one column at a time, scattering the coefficients of each substance into a column
+    std::vector<double> column(table.elements().size(), 0.0);
+    for(auto i = 0u; i < table.size(); ++i)
+    {
+        for(auto k = offsets[i]; k < offsets[i + 1]; ++k)
+            column[ielements[k]] += coefficients[k];
+        writeValues(out, column.data(), column.size(), format);
+        for(auto k = offsets[i]; k < offsets[i + 1]; ++k)
+            column[ielements[k]] = 0.0;
+    }
+}
+
+auto writeFormulaMatrix(const SubstanceTable& table, const std::string& path, ArrayFormat format) -> void
+{
+    writeFile(path, [&](std::ostream& out) { writeFormulaMatrix(out, table, format); });
+}
+
+auto writeFormulaMatrixCSR(const SubstanceTable& table, const std::string& prefix, ArrayFormat format) -> void
+{
+    writeFile(prefix + ".indptr" + extension(format), [&](std::ostream& out) { writeArray(out, table.compositionOffsets(), format); });
+    writeFile(prefix + ".indices" + extension(format), [&](std::ostream& out) { writeArray(out, table.compositionElements(), format); });
+    writeFile(prefix + ".data" + extension(format), [&](std::ostream& out) { writeArray(out, table.compositionCoefficients(), format); });
+}
+
+} // namespace Atomik
@@ -0,0 +1,100 @@
+// Atomik is a library that implements basic chemical concepts such as elements, substances, and reactions.
+//
+// Copyright (C) 2018-2019 Allan Leal and Reaktoro Contributors
+//
+// This library is free software; you can redistribute it and/or
+// modify it under the terms of the GNU Lesser General Public
+// License as published by the Free Software Foundation; either
+// version 2.1 of the License, or (at your option) any later version.
+//
+// This library is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+// Lesser General Public License for more details.
+//
+// You should have received a copy of the GNU Lesser General Public License
+// along with this library. If not, see <http://www.gnu.org/licenses/>.
+
+#pragma once
+
+// C++ includes
+#include <cstdint>
+#include <iosfwd>
+#include <string>
+#include <vector>
+
+// Atomik includes
+#include <Atomik/Index.hpp>
+
+namespace Atomik {
+
+// Forward declarations
+class SubstanceTable;
+
+/// The file formats of the numeric arrays written by the functions below.
+enum class ArrayFormat
+{
+    /// The NumPy `.npy` format (version 1.0), readable with `numpy.load` or `numpy.memmap`.
+    /// The values are written in the byte order of the host, which is recorded in the header.
+    Npy,
+
+    /// Raw little-endian values preceded by a header of 16 bytes followed by the dimensions.
+    /// The header is the magic `ATOMIKAR`, the kind of the values (`f`, `i`, or `u`), their size
+    /// in bytes, 1 if the values are in column-major order (0 otherwise), the number of dimensions,
+    /// and four zero bytes. Each dimension is then written as a 64-bit unsigned integer.
+    Raw,
+};
+
+/// The constants of the raw array format.
+namespace RawArrayFormat {
+
+/// The bytes at the start of every raw array.
+constexpr char magic[8] = { 'A', 'T', 'O', 'M', 'I', 'K', 'A', 'R' };
+
+/// The size of the header of a raw array, excluding its dimensions.
+constexpr std::size_t headerSize = 16;
+
+} // namespace RawArrayFormat
+
+/// Write a one-dimensional array of floating-point values to a stream.
+auto writeArray(std::ostream& out, const std::vector<double>& values, ArrayFormat format = ArrayFormat::Npy) -> void;
+
+/// Write a one-dimensional array of signed integers to a stream.
+auto writeArray(std::ostream& out, const std::vector<Index>& values, ArrayFormat format = ArrayFormat::Npy) -> void;
+
+/// Write a one-dimensional array of unsigned integers to a stream.
+auto writeArray(std::ostream& out, const std::vector<std::size_t>& values, ArrayFormat format = ArrayFormat::Npy) -> void;
+
+/// Write the molar masses of the substances in a table (in unit of kg/mol) to a file.
+/// @throw std::runtime_error When the file cannot be written.
+auto writeMolarMasses(const SubstanceTable& table, const std::string& path, ArrayFormat format = ArrayFormat::Npy) -> void;
+
+/// Write the electric charges of the substances in a table to a file.
+/// @throw std::runtime_error When the file cannot be written.
+auto writeCharges(const SubstanceTable& table, const std::string& path, ArrayFormat format = ArrayFormat::Npy) -> void;
+
+/// Write the dense formula matrix of the substances in a table to a stream.
+/// The matrix has one row per element in `table.elements()` and one column per substance, and
+/// is written in column-major order so that each column is streamed from the composition columns of the
+/// table without assembling the matrix in memory:
+/// ~~~{.py}
+/// A = numpy.load("formula-matrix.npy")  # A[i, j] is the coefficient of element i in substance j
+/// ~~~
+auto writeFormulaMatrix(std::ostream& out, const SubstanceTable& table, ArrayFormat format = ArrayFormat::Npy) -> void;
+
+/// Write the dense formula matrix of the substances in a table to a file.
+/// @throw std::runtime_error When the file cannot be written.
+auto writeFormulaMatrix(const SubstanceTable& table, const std::string& path, ArrayFormat format = ArrayFormat::Npy) -> void;
+
+/// Write the sparse formula matrix of the substances in a table, as stored in the table, to three files.
+/// The files `<prefix>.indptr.<ext>`, `<prefix>.indices.<ext>`, and `<prefix>.data.<ext>` (with `<ext>`
+/// equal to `npy` or `bin`) receive the composition offsets, element indices, and coefficients of the table.
+/// These are the compressed sparse row (CSR) layout of the substance-by-element matrix, or equivalently, the
+/// compressed sparse column (CSC) layout of the formula matrix:
+/// ~~~{.py}
+/// A = scipy.sparse.csc_matrix((data, indices, indptr), shape=(num_elements, num_substances))
+/// ~~~
+/// @throw std::runtime_error When the files cannot be written.
+auto writeFormulaMatrixCSR(const SubstanceTable& table, const std::string& prefix, ArrayFormat format = ArrayFormat::Npy) -> void;
+
+} // namespace Atomik
@@ -0,0 +1,123 @@
+// Atomik is a library that implements basic chemical concepts such as elements, substances, and reactions.
+//
+// Copyright (C) 2018-2019 Allan Leal and Reaktoro Contributors
+//
+// This library is free software; you can redistribute it and/or
+// modify it under the terms of the GNU Lesser General Public
+// License as published by the Free Software Foundation; either
+// version 2.1 of the License, or (at your option) any later version.
+//
+// This library is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+// Lesser General Public License for more details.
+//
+// You should have received a copy of the GNU Lesser General Public License
+// along with this library. If not, see <http://www.gnu.org/licenses/>.
+
+// Catch includes
+#include <catch2/catch.hpp>
+
+// C++ includes
+#include <cstring>
+#include <filesystem>
+#include <fstream>
+#include <sstream>
+
+// Atomik includes
+#include <Atomik/ArrayWriter.hpp>
+#include <Atomik/Substance.hpp>
+#include <Atomik/SubstanceTable.hpp>
+#include <Atomik/Substances.hpp>
+using namespace Atomik;
+
+namespace {
+
+/// Return the values stored after a header of given size in a written array.
+template<typename T>
+auto values(const std::string& bytes, std::size_t headerSize) -> std::vector<T>
+{
+    std::vector<T> res((bytes.size() - headerSize) / sizeof(T));
+    std::memcpy(res.data(), bytes.data() + headerSize, res.size() * sizeof(T));
+    return res;
+}
+
+} // namespace
+
+TEST_CASE("Testing ArrayWriter", "[ArrayWriter]")
+{
+    const SubstanceTable table(Substances({ Substance("H2O"), Substance("H+"), Substance("OH-"), Substance("CO2"), Substance("HCO3-"), Substance("CaCO3") }));
+
+    SECTION("Testing the npy format")
+    {
+        std::stringstream ss;
+        writeArray(ss, table.molarMasses());
+        const auto bytes = ss.str();
+
+        REQUIRE(bytes.substr(0, 8) == std::string("\x93NUMPY\x01\x00", 8));
+        const auto headerSize = 10 + std::size_t(std::uint8_t(bytes[8])) + 256 * std::size_t(std::uint8_t(bytes[9]));
+        REQUIRE(headerSize % 64 == 0);
+        REQUIRE(bytes[headerSize - 1] == '\n');
+        REQUIRE(bytes.find("{'descr': '<f8', 'fortran_order': False, 'shape': (6,), }") == 10);
+        REQUIRE(values<double>(bytes, headerSize) == table.molarMasses());
+    }
+
+    SECTION("Testing the raw format")
+    {
+        std::stringstream ss;
+        writeArray(ss, table.compositionElements(), ArrayFormat::Raw);
+        const auto bytes = ss.str();
+
+        REQUIRE(bytes.substr(0, 8) == "ATOMIKAR");
+        REQUIRE(bytes[8] == 'i');
+        REQUIRE(bytes[9] == 8);
+        REQUIRE(bytes[10] == 0);
+        REQUIRE(bytes[11] == 1);
+        REQUIRE(values<std::uint64_t>(bytes.substr(0, 24), 16) == std::vector<std::uint64_t>{ table.compositionElements().size() });
+        REQUIRE(values<Index>(bytes, 24) == table.compositionElements());
+    }
+
+    SECTION("Testing the dense formula matrix")
+    {
+        std::stringstream ss;
+        writeFormulaMatrix(ss, table, ArrayFormat::Raw);
+        const auto bytes = ss.str();
+
+        const auto numElements = table.elements().size();
+        REQUIRE(bytes[10] == 1); // column-major order
+        REQUIRE(bytes[11] == 2);
+        REQUIRE(values<std::uint64_t>(bytes.substr(0, 32), 16) == std::vector<std::uint64_t>{ numElements, table.size() });
+
+        const auto matrix = values<double>(bytes, 32);
+        REQUIRE(matrix.size() == numElements * table.size());
+
+        const auto& offsets = table.compositionOffsets();
+        for(auto j = 0u; j < table.size(); ++j)
+        {
+            for(auto i = 0u; i < numElements; ++i)
+            {
+                double expected = 0.0;
+                for(auto k = offsets[j]; k < offsets[j + 1]; ++k)
+                    if(table.compositionElements()[k] == Index(i))
+                        expected = table.compositionCoefficients()[k];
+                REQUIRE(matrix[j * numElements + i] == expected);
+            }
+        }
+    }
+
+    SECTION("Testing the files of the sparse formula matrix")
+    {
+        const auto prefix = (std::filesystem::temp_directory_path() / "atomik-array-writer-test").string();
+
+        writeFormulaMatrixCSR(table, prefix);
+        writeCharges(table, prefix + ".charges.npy");
+
+        for(auto suffix : { ".indptr.npy", ".indices.npy", ".data.npy", ".charges.npy" })
+        {
+            REQUIRE(std::filesystem::exists(prefix + suffix));
+            std::filesystem::remove(prefix + suffix);
+        }
+
+        REQUIRE_THROWS(writeMolarMasses(table, prefix + "/missing/directory.npy"));
+    }
+}
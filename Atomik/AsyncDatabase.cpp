@@ -0,0 +1,285 @@
+// Atomik is a library that implements basic chemical concepts such as elements, substances, and reactions.
+//
+// Copyright (C) 2018-2019 Allan Leal and Reaktoro Contributors
+//
+// This library is free software; you can redistribute it and/or
+// modify it under the terms of the GNU Lesser General Public
+// License as published by the Free Software Foundation; either
+// version 2.1 of the License, or (at your option) any later version.
+//
+// This library is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+// Lesser General Public License for more details.
+//
+// You should have received a copy of the GNU Lesser General Public License
+// along with this library. If not, see <http://www.gnu.org/licenses/>.
+
+#include "AsyncDatabase.hpp"
+
+// C++ includes
+#include <atomic>
+#include <condition_variable>
+#include <exception>
+#include <mutex>
+#include <optional>
+#include <thread>
+#include <unordered_map>
+#include <vector>
+
+// Atomik includes
+#include <Atomik/Exception.hpp>
+#include <Atomik/MappedFile.hpp>
+#include <Atomik/Memory.hpp>
+#include <Atomik/ParallelLoader.hpp>
+#include <Atomik/Serialization.hpp>
+#include <Atomik/Tracing.hpp>
+
+namespace Atomik {
+
+struct AsyncDatabase::Impl
+{
+    /// The path to the YAML file of elements.
+    const std::string elementsPath;
+
+    /// The path to the YAML file of substances.
+    const std::string substancesPath;
+
+    /// The current stage of the loading.
+    std::atomic<LoadStage> stage = LoadStage::Started;
+
+    /// The number of substances loaded so far (the first ones in `records`).
+    std::atomic<std::size_t> loaded = 0;
+
+    /// The elements of the database (available from LoadStage::Parsed on).
+    Elements elements;
+
+    /// The YAML file of substances (available from LoadStage::Parsed on).
+    std::optional<MappedFile> file;
+
+    /// The records in the YAML file of substances, or none if it cannot be split into records (available from LoadStage::Parsed on).
+    RecordSpans spans;
+
+    /// The mapping from the names of the substances to the positions of their first records in `records` (available from LoadStage::NamesIndexed on).
+    std::unordered_map<InternedString, std::size_t> names;
+
+    /// The substances of the database, loaded in order or converted on demand (guarded by `mutex`).
+    std::vector<std::optional<Substance>> records;
+
+    /// The database (available from LoadStage::Ready on).
+    std::optional<Database> database;
+
+    /// The error raised while loading, if any.
+    std::exception_ptr failure;
+
+    /// The mutex and condition variable used to wait for the progress of the loading.
+    mutable std::mutex mutex;
+    mutable std::condition_variable progressed;
+
+    /// The memory resource of the thread that started the loading, also used by the loading thread.
+    std::pmr::memory_resource* const resource = memoryResource();
+
+    /// Set when the AsyncDatabase is destroyed, so that the loading stops at the next record.
+    std::atomic<bool> stopping = false;
+
+    /// The thread loading the database.
+    std::thread loader;
+
+    /// Construct an AsyncDatabase::Impl object and start loading the database.
+    Impl(std::string elementsPath, std::string substancesPath)
+    : elementsPath(std::move(elementsPath)), substancesPath(std::move(substancesPath))
+    {
+        loader = std::thread([this]() { load(); });
+    }
+
+    /// Destroy this AsyncDatabase::Impl object, stopping the loading at the next record.
+    ~Impl()
+    {
+        stopping.store(true, std::memory_order_relaxed);
+        loader.join();
+    }
+
+    /// Return the text of a record in the YAML file of substances.
+    auto record(std::size_t i) const -> std::string_view
+    {
+        return file->view().substr(spans.begins[i], spans.ends[i] - spans.begins[i]);
+    }
+
+    /// Return the substance converted from a record in the YAML file of substances.
+    auto convert(std::size_t i) const -> Substance
+    {
+        return YAML::Load(std::string(record(i)))[0].as<Substance>();
+    }
+
+    /// Return the substance of a record if it has been converted already.
+    auto converted(std::size_t i) const -> std::optional<Substance>
+    {
+        std::lock_guard lock(mutex);
+        return records[i];
+    }
+
+    /// Store the substance of a record unless it has been converted meanwhile, and return the stored one.
+    auto store(std::size_t i, Substance substance) -> Substance
+    {
+        std::lock_guard lock(mutex);
+        if(!records[i])
+            records[i] = std::move(substance);
+        return *records[i];
+    }
+
+    /// Set the current stage of the loading and notify the waiting threads.
+    auto advance(LoadStage next) -> void
+    {
+        {
+            std::lock_guard lock(mutex);
+            stage.store(next, std::memory_order_release);
+        }
+        progressed.notify_all();
+    }
+
+    /// Load the database in stages.
+    auto load() -> void
+    {
+        ATOMIK_TRACE_THREAD("AsyncDatabase loader");
+        MemoryResourceScope scope(resource);
+        try {
+            {
+                ATOMIK_TRACE_DETAIL("load elements", elementsPath);
+                elements = elementsPath.empty() ? Elements::PeriodicTable() : LoadFile(elementsPath).as<Elements>();
+            }
+            {
+                ATOMIK_TRACE_DETAIL("split records", substancesPath);
+                file.emplace(substancesPath);
+                spans = yamlRecordSpans(file->view());
+            }
+            advance(LoadStage::Parsed);
+
+            // A document that is not a top-level block sequence (e.g., in flow style) cannot be split into records, so it is parsed at once
+            const auto node = spans.begins.empty() ? YAML::Load(std::string(file->view())) : YAML::Node();
+            const auto numRecords = spans.begins.empty() ? node.size() : spans.begins.size();
+
+            {
+                ATOMIK_TRACE("index names");
+                names.reserve(numRecords);
+                for(std::size_t i = 0; i < numRecords; ++i)
+                {
+                    if(stopping.load(std::memory_order_relaxed))
+                        return;
+                    auto name = spans.begins.empty() ?
+                        std::optional<std::string>(node[i]["name"].as<std::string>()) :
+                        yamlRecordValue(record(i), "name");
+                    error(!name, "Could not index a substance without name in the file `", substancesPath, "`.");
+                    names.emplace(InternedString(std::move(*name)), i); // the first record with a name is the one looked up
+                }
+                records.resize(numRecords);
+            }
+            advance(LoadStage::NamesIndexed);
+
+            {
+                ATOMIK_TRACE("convert substances");
+                for(std::size_t i = 0; i < numRecords; ++i)
+                {
+                    if(stopping.load(std::memory_order_relaxed))
+                        return;
+                    if(!converted(i)) // a record requested by name may have been converted on demand already
+                        store(i, spans.begins.empty() ? node[i].as<Substance>() : convert(i));
+                    {
+                        std::lock_guard lock(mutex);
+                        loaded.store(i + 1, std::memory_order_release);
+                    }
+                    progressed.notify_all();
+                }
+            }
+            advance(LoadStage::Loaded);
+
+            {
+                ATOMIK_TRACE("build Database");
+                Substances substances;
+                for(const auto& substance : records)
+                    substances.append(*substance);
+                database.emplace(elements, std::move(substances));
+            }
+            advance(LoadStage::Ready);
+        }
+        catch(...) {
+            failure = std::current_exception();
+            advance(LoadStage::Failed);
+        }
+    }
+
+    /// Wait until a condition on the progress of the loading holds, rethrowing any loading error.
+    template<typename Condition>
+    auto waitUntil(const Condition& condition) const -> void
+    {
+        std::unique_lock lock(mutex);
+        progressed.wait(lock, [&]() { return condition() || stage.load() == LoadStage::Failed; });
+        if(stage.load() == LoadStage::Failed)
+            std::rethrow_exception(failure);
+    }
+};
+
+AsyncDatabase::AsyncDatabase(std::string elementsPath, std::string substancesPath)
+: pimpl(allocateShared<Impl>(std::move(elementsPath), std::move(substancesPath)))
+{}
+
+auto AsyncDatabase::stage() const -> LoadStage
+{
+    return pimpl->stage.load(std::memory_order_acquire);
+}
+
+auto AsyncDatabase::reached(LoadStage stage) const -> bool
+{
+    const auto current = this->stage();
+    return current != LoadStage::Failed && current >= stage;
+}
+
+auto AsyncDatabase::wait(LoadStage stage) const -> void
+{
+    pimpl->waitUntil([&]() { return reached(stage); });
+}
+
+auto AsyncDatabase::numLoaded() const -> std::size_t
+{
+    return pimpl->loaded.load(std::memory_order_acquire);
+}
+
+auto AsyncDatabase::numSubstances() const -> std::size_t
+{
+    wait(LoadStage::NamesIndexed);
+    return pimpl->records.size();
+}
+
+auto AsyncDatabase::hasSubstance(std::string_view name) const -> bool
+{
+    wait(LoadStage::NamesIndexed);
+    return pimpl->names.count(InternedString::find(name));
+}
+
+auto AsyncDatabase::substanceWithName(std::string_view name) const -> Substance
+{
+    wait(LoadStage::NamesIndexed);
+    const auto iter = pimpl->names.find(InternedString::find(name));
+    error(iter == pimpl->names.end(), "Could not find a substance with the given name `", name, "`.");
+    const auto index = iter->second;
+    if(auto substance = pimpl->converted(index))
+        return *substance;
+
+    // A document that could not be split into records is only converted as a whole by the loading thread
+    if(pimpl->spans.begins.empty())
+    {
+        pimpl->waitUntil([&]() { return numLoaded() > index; });
+        return *pimpl->converted(index);
+    }
+
+    // Otherwise, convert the requested record now rather than waiting for the records before it
+    MemoryResourceScope scope(pimpl->resource);
+    return pimpl->store(index, pimpl->convert(index));
+}
+
+auto AsyncDatabase::database() const -> const Database&
+{
+    wait(LoadStage::Ready);
+    return *pimpl->database;
+}
+
+} // namespace Atomik
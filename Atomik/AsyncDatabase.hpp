@@ -0,0 +1,100 @@
+// Atomik is a library that implements basic chemical concepts such as elements, substances, and reactions.
+//
+// Copyright (C) 2018-2019 Allan Leal and Reaktoro Contributors
+//
+// This library is free software; you can redistribute it and/or
+// modify it under the terms of the GNU Lesser General Public
+// License as published by the Free Software Foundation; either
+// version 2.1 of the License, or (at your option) any later version.
+//
+// This library is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+// Lesser General Public License for more details.
+//
+// You should have received a copy of the GNU Lesser General Public License
+// along with this library. If not, see <http://www.gnu.org/licenses/>.
+
+#pragma once
+
+// C++ includes
+#include <memory>
+#include <string>
+#include <string_view>
+
+// Atomik includes
+#include <Atomik/Database.hpp>
+
+namespace Atomik {
+
+/// The stages of the asynchronous loading of a database, in the order they are reached.
+enum class LoadStage
+{
+    Started,       ///< The loading has started in the background.
+    Parsed,        ///< The elements have been loaded and the file of substances has been split into records.
+    NamesIndexed,  ///< The names of the substances have been indexed, so they can be looked up.
+    Loaded,        ///< All substances have been loaded.
+    Ready,         ///< The database and its indexes have been built.
+    Failed,        ///< The loading has failed.
+};
+
+/// A type used as a handle to a database being loaded from YAML files in a background thread.
+/// The construction returns immediately, and the database becomes available progressively.
+/// Substances can be looked up by name as soon as their names have been indexed. A requested
+/// substance whose record has not been loaded yet is converted on demand in the calling thread,
+/// while the remaining records are still being loaded in file order. The names are read from
+/// the text of each record, so they are indexed without parsing the whole file. A file that
+/// cannot be split into records (e.g., a sequence in flow style) is parsed at once instead, and
+/// its substances become available only as the loading thread converts them.
+/// As in Substances, a name shared by several substances refers to the first of them:
+/// ~~~
+/// using namespace Atomik;
+/// AsyncDatabase async("", "species.yml");
+/// // ... do other startup work ...
+/// if(async.hasSubstance("H2O(aq)"))
+///     auto water = async.substanceWithName("H2O(aq)");
+/// const Database& db = async.database(); // waits until the whole database is ready
+/// ~~~
+/// Copies of an AsyncDatabase object refer to the same loading database. When the last of them is
+/// destroyed, the loading stops at the next record.
+class AsyncDatabase
+{
+public:
+    /// Construct an AsyncDatabase object that starts loading given files in the background.
+    /// @param elementsPath The path to the YAML file of elements (if empty, the periodic table is used).
+    /// @param substancesPath The path to the YAML file of substances.
+    AsyncDatabase(std::string elementsPath, std::string substancesPath);
+
+    /// Return the current stage of the loading (without waiting).
+    auto stage() const -> LoadStage;
+
+    /// Return true if a given stage of the loading has been reached (without waiting).
+    auto reached(LoadStage stage) const -> bool;
+
+    /// Wait until a given stage of the loading has been reached.
+    /// @throw std::exception The error raised while loading, if the loading has failed.
+    auto wait(LoadStage stage) const -> void;
+
+    /// Return the number of substances loaded so far (without waiting).
+    auto numLoaded() const -> std::size_t;
+
+    /// Return the number of substances in the database, waiting for their names to be indexed.
+    auto numSubstances() const -> std::size_t;
+
+    /// Return true if the database has a substance with given name, waiting for the names to be indexed.
+    auto hasSubstance(std::string_view name) const -> bool;
+
+    /// Return the substance with given name, converting its record now if it has not been loaded yet.
+    /// @throw std::runtime_error When there is no substance with given name.
+    auto substanceWithName(std::string_view name) const -> Substance;
+
+    /// Return the database, waiting for it to be ready.
+    auto database() const -> const Database&;
+
+private:
+    struct Impl;
+
+    std::shared_ptr<Impl> pimpl;
+};
+
+} // namespace Atomik
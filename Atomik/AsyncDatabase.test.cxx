@@ -0,0 +1,107 @@
+// Atomik is a library that implements basic chemical concepts such as elements, substances, and reactions.
+//
+// Copyright (C) 2018-2019 Allan Leal and Reaktoro Contributors
+//
+// This library is free software; you can redistribute it and/or
+// modify it under the terms of the GNU Lesser General Public
+// License as published by the Free Software Foundation; either
+// version 2.1 of the License, or (at your option) any later version.
+//
+// This library is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+// Lesser General Public License for more details.
+//
+// You should have received a copy of the GNU Lesser General Public License
+// along with this library. If not, see <http://www.gnu.org/licenses/>.
+
+// Catch includes
+#include <catch2/catch.hpp>
+
+// C++ includes
+#include <filesystem>
+#include <fstream>
+
+// Atomik includes
+#include <Atomik/AsyncDatabase.hpp>
+#include <Atomik/Serialization.hpp>
+using namespace Atomik;
+
+TEST_CASE("Testing AsyncDatabase", "[AsyncDatabase]")
+{
+    const auto path = std::filesystem::temp_directory_path() / "atomik-async-database-test.yml";
+
+    std::vector<Substance> substances;
+    for(auto i = 0; i < 500; ++i)
+        substances.push_back(Substance("CaCO3").replaceName("Calcite" + std::to_string(i)).replaceTags({"mineral"}));
+
+    YAML::Node node;
+    node << Substances(substances);
+    std::ofstream(path) << node;
+
+    AsyncDatabase async("", path.string());
+
+    // Test queries by name are answered without waiting for the whole database
+    REQUIRE(async.hasSubstance("Calcite0"));
+    REQUIRE_FALSE(async.hasSubstance("Aragonite"));
+    REQUIRE(async.numSubstances() == 500);
+    REQUIRE(async.reached(LoadStage::NamesIndexed));
+    REQUIRE(async.substanceWithName("Calcite0").formula() == substances[0].formula());
+    REQUIRE_THROWS(async.substanceWithName("Aragonite"));
+
+    // Test a record is converted on demand without waiting for the records before it
+    const auto last = async.substanceWithName("Calcite499");
+    REQUIRE(last.name() == "Calcite499");
+    REQUIRE(last.hasTag("mineral"));
+
+    // Test the whole database becomes ready
+    const auto& db = async.database();
+    REQUIRE(async.stage() == LoadStage::Ready);
+    REQUIRE(async.numLoaded() == 500);
+    REQUIRE(db.substances().size() == 500);
+    REQUIRE(db.substancesWithTag("mineral").size() == 500);
+    REQUIRE(db.substance(db.substanceWithName("Calcite499")).name() == "Calcite499");
+    REQUIRE(async.substanceWithName("Calcite499").name() == "Calcite499");
+
+    // Test a database destroyed while loading stops its loading
+    {
+        AsyncDatabase stopped("", path.string());
+        stopped.wait(LoadStage::NamesIndexed);
+    }
+
+    // Test names shared by several substances refer to the first of them
+    const auto duplicates = path.parent_path() / "atomik-async-database-duplicates-test.yml";
+    YAML::Node nodeWithDuplicates;
+    nodeWithDuplicates << Substances({
+        Substance("H2O").replaceName("H2O(aq)"),
+        Substance("H2O2").replaceName("H2O(aq)"),
+        Substance("CO2").replaceName("CO2(g)"),
+    });
+    std::ofstream(duplicates) << nodeWithDuplicates;
+
+    AsyncDatabase asyncWithDuplicates("", duplicates.string());
+    REQUIRE(asyncWithDuplicates.numSubstances() == 3);
+    REQUIRE(asyncWithDuplicates.substanceWithName("H2O(aq)").formula().formula() == "H2O");
+    REQUIRE(asyncWithDuplicates.substanceWithName("CO2(g)").name() == "CO2(g)");
+    const auto& dbWithDuplicates = asyncWithDuplicates.database();
+    REQUIRE(dbWithDuplicates.substance(dbWithDuplicates.substanceWithName("CO2(g)")).name() == "CO2(g)");
+    REQUIRE(dbWithDuplicates.substance(dbWithDuplicates.substanceWithName("H2O(aq)")).formula().formula() == "H2O");
+    std::filesystem::remove(duplicates);
+
+    // Test documents in flow style, which cannot be split into records, are loaded too
+    const auto flow = path.parent_path() / "atomik-async-database-flow-test.yml";
+    std::ofstream(flow) << "[{name: Calcite, formula: {formula: CaCO3, symbols: [Ca, C, O], coefficients: [1, 1, 3]}, tags: [mineral]}]";
+    AsyncDatabase asyncInFlowStyle("", flow.string());
+    REQUIRE(asyncInFlowStyle.substanceWithName("Calcite").hasTag("mineral"));
+    REQUIRE(asyncInFlowStyle.database().substances().size() == 1);
+    std::filesystem::remove(flow);
+
+    // Test loading errors are reported to the waiting threads
+    AsyncDatabase missing("", (path.parent_path() / "atomik-missing-file.yml").string());
+    REQUIRE_THROWS(missing.wait(LoadStage::Parsed));
+    REQUIRE_THROWS(missing.hasSubstance("Calcite0"));
+    REQUIRE(missing.stage() == LoadStage::Failed);
+    REQUIRE_FALSE(missing.reached(LoadStage::Parsed));
+
+    std::filesystem::remove(path);
+}
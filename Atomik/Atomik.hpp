@@ -19,15 +19,39 @@
 
 // Atomik includes
 #include <Atomik/Algorithms.hpp>
+#include <Atomik/ArrayWriter.hpp>
+#include <Atomik/AsyncDatabase.hpp>
+#include <Atomik/BinaryDatabase.hpp>
+#include <Atomik/CSVImporter.hpp>
+#include <Atomik/ChemicalFormula.hpp>
+#include <Atomik/Database.hpp>
+#include <Atomik/DatabaseDelta.hpp>
 #include <Atomik/Element.hpp>
 #include <Atomik/Elements.hpp>
 #include <Atomik/Exception.hpp>
 #include <Atomik/Extract.hpp>
-#include <Atomik/Formula.hpp>
+#include <Atomik/Instrumentation.hpp>
+#include <Atomik/InternedString.hpp>
+#include <Atomik/LazySubstances.hpp>
+#include <Atomik/MappedFile.hpp>
+#include <Atomik/Memory.hpp>
+#include <Atomik/MerkleTree.hpp>
+#include <Atomik/ParallelLoader.hpp>
 #include <Atomik/Parameters.hpp>
+#include <Atomik/ReloadableDatabase.hpp>
+#include <Atomik/SnapshotCache.hpp>
+#include <Atomik/StreamingLoader.hpp>
+#include <Atomik/StreamingWriter.hpp>
 #include <Atomik/StringList.hpp>
 #include <Atomik/StringUtils.hpp>
 #include <Atomik/Substance.hpp>
+#include <Atomik/SubstanceArchive.hpp>
+#include <Atomik/SubstanceElements.hpp>
+#include <Atomik/SubstanceFormula.hpp>
+#include <Atomik/SubstanceTable.hpp>
 #include <Atomik/Substances.hpp>
+#include <Atomik/SubstancesBuilder.hpp>
+#include <Atomik/Tracing.hpp>
+#include <Atomik/VersionedDatabase.hpp>
 #include <Atomik/WithUtils.hpp>
 #include <Atomik/YAML.hpp>
@@ -0,0 +1,559 @@
+// Atomik is a library that implements basic chemical concepts such as elements, substances, and reactions.
+//
+// Copyright (C) 2018-2019 Allan Leal and Reaktoro Contributors
+//
+// This library is free software; you can redistribute it and/or
+// modify it under the terms of the GNU Lesser General Public
+// License as published by the Free Software Foundation; either
+// version 2.1 of the License, or (at your option) any later version.
+//
+// This library is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+// Lesser General Public License for more details.
+//
+// You should have received a copy of the GNU Lesser General Public License
+// along with this library. If not, see <http://www.gnu.org/licenses/>.
+
+#include "BinaryDatabase.hpp"
+
+// C++ includes
+#include <cstdio>
+#include <cstring>
+#include <fstream>
+#include <unordered_map>
+
+// Atomik includes
+#include <Atomik/Database.hpp>
+#include <Atomik/Exception.hpp>
+#include <Atomik/Instrumentation.hpp>
+#include <Atomik/MappedFile.hpp>
+#include <Atomik/Memory.hpp>
+#include <Atomik/Substance.hpp>
+#include <Atomik/SubstanceElements.hpp>
+#include <Atomik/SubstanceFormula.hpp>
+#include <Atomik/Tracing.hpp>
+
+namespace Atomik {
+namespace BinaryFormat {
+
+auto hash(std::string_view str) -> std::uint64_t
+{
+    std::uint64_t h = 14695981039346656037ull;
+    for(const auto c : str)
+    {
+        h ^= static_cast<unsigned char>(c);
+        h *= 1099511628211ull;
+    }
+    return h;
+}
+
+} // namespace BinaryFormat
+
+namespace {
+
+using namespace BinaryFormat;
+
+/// Return the number of buckets of a hash table with given number of entries (a power of two with load factor at most 1/2).
+auto numBuckets(std::size_t count) -> std::size_t
+{
+    std::size_t buckets = 1;
+    while(buckets < 2 * count)
+        buckets *= 2;
+    return buckets;
+}
+
+/// Return the hash table (open addressing with linear probing) of given keys.
+template<typename Key>
+auto hashTable(std::size_t count, const Key& key) -> std::vector<std::uint32_t>
+{
+    std::vector<std::uint32_t> table(numBuckets(count), 0);
+    const auto mask = table.size() - 1;
+    for(auto i = 0u; i < count; ++i)
+    {
+        auto bucket = hash(key(i)) & mask;
+        while(table[bucket] != 0)
+            bucket = (bucket + 1) & mask;
+        table[bucket] = i + 1;
+    }
+    return table;
+}
+
+/// A type used to assemble the contents of a binary database file.
+class Writer
+{
+public:
+    /// Return the reference to a string in the string pool, adding it if needed.
+    auto string(std::string_view str) -> StringRef
+    {
+        const auto [iter, inserted] = m_strings.try_emplace(std::string(str), StringRef{ std::uint32_t(m_pool.size()), std::uint32_t(str.size()) });
+        if(inserted)
+        {
+            m_pool += str;
+            m_pool += '\0';
+        }
+        return iter->second;
+    }
+
+    /// Return the range of the indices of given tags in the tag index section, adding them to the tag dictionary if needed.
+    template<typename Tags>
+    auto tags(const Tags& tags) -> Range
+    {
+        const Range range{ std::uint32_t(m_tagIndices.size()), std::uint32_t(tags.size()) };
+        for(const auto& tag : tags)
+        {
+            const auto [iter, inserted] = m_tagIds.try_emplace(tag.str(), std::uint32_t(m_tags.size()));
+            if(inserted)
+                m_tags.push_back(string(tag.view()));
+            m_tagIndices.push_back(iter->second);
+        }
+        return range;
+    }
+
+    /// Return the string pool.
+    auto pool() const -> const std::string& { return m_pool; }
+
+    /// Return the tag dictionary.
+    auto tagDictionary() const -> const std::vector<StringRef>& { return m_tags; }
+
+    /// Return the indices in the tag dictionary referenced by the records.
+    auto tagIndices() const -> const std::vector<std::uint32_t>& { return m_tagIndices; }
+
+private:
+    std::string m_pool;
+    std::unordered_map<std::string, StringRef> m_strings;
+    std::vector<StringRef> m_tags;
+    std::unordered_map<std::string, std::uint32_t> m_tagIds;
+    std::vector<std::uint32_t> m_tagIndices;
+};
+
+/// Append an array of entries to a file buffer as a new section aligned to 8 bytes.
+template<typename T>
+auto appendSection(std::string& buffer, const T* data, std::size_t count) -> Section
+{
+    buffer.resize((buffer.size() + 7) / 8 * 8, '\0');
+    const Section section{ buffer.size(), count };
+    buffer.append(reinterpret_cast<const char*>(data), count * sizeof(T));
+    return section;
+}
+
+/// Append a vector of entries to a file buffer as a new section aligned to 8 bytes.
+template<typename T>
+auto appendSection(std::string& buffer, const std::vector<T>& data) -> Section
+{
+    return appendSection(buffer, data.data(), data.size());
+}
+
+/// Return the substance with given index in a binary database, composed of the elements returned by `elementAt` for their indices.
+template<typename ElementAt>
+auto substanceIn(const MappedDatabase& db, Index isubstance, const ElementAt& elementAt) -> Substance
+{
+    Substance::Args args;
+    args.name = db.substanceName(isubstance);
+    args.type = db.substanceType(isubstance);
+    for(auto tag : db.substanceTags(isubstance))
+        args.tags.emplace_back(tag);
+
+    SubstanceFormula::Args formulaArgs;
+    SubstanceElements::Args elementsArgs;
+    formulaArgs.formula = db.substanceFormula(isubstance);
+    for(auto k = 0u; k < db.numComponents(isubstance); ++k)
+    {
+        const auto ielement = db.componentElement(isubstance, k);
+        const auto coefficient = db.componentCoefficient(isubstance, k);
+        formulaArgs.elements.emplace(db.elementSymbol(ielement), coefficient);
+        elementsArgs.elements.append(elementAt(ielement));
+        elementsArgs.coefficients.push_back(coefficient);
+    }
+
+    args.formula = SubstanceFormula(std::move(formulaArgs));
+    args.elements = SubstanceElements(std::move(elementsArgs));
+
+    return Substance(std::move(args));
+}
+
+/// Return all substances in a binary database, composed of its elements built once beforehand.
+auto substancesIn(const MappedDatabase& db, const Elements& elements) -> Substances
+{
+    ATOMIK_TRACE("MappedDatabase::substances");
+    Substances res;
+    for(auto i = 0u; i < db.numSubstances(); ++i)
+        res.append(substanceIn(db, i, [&](Index ielement) { return elements[ielement]; }));
+    return res;
+}
+
+} // namespace
+
+auto writeBinaryDatabase(const Database& db, const std::string& path) -> void
+{
+    ATOMIK_TIME(Timer::WriteBinaryDatabase);
+    ATOMIK_TRACE_DETAIL("writeBinaryDatabase", path);
+    error(db.elements().size() > UINT32_MAX || db.substances().size() > UINT32_MAX,
+        "Could not write the binary database file `", path, "` because it has too many elements or substances.");
+
+    Writer writer;
+
+    std::vector<ElementRecord> elements;
+    elements.reserve(db.elements().size());
+    for(const auto& element : db.elements())
+    {
+        ElementRecord record = {};
+        record.symbol = writer.string(element.symbol().view());
+        record.name = writer.string(element.name().view());
+        record.atomicNumber = element.atomicNumber();
+        record.atomicWeight = element.atomicWeight();
+        record.electronegativity = element.electronegativity();
+        record.tags = writer.tags(element.tags());
+        elements.push_back(record);
+    }
+
+    std::vector<SubstanceRecord> substances;
+    std::vector<std::uint32_t> compositionElements;
+    std::vector<double> compositionCoefficients;
+    substances.reserve(db.substances().size());
+    for(auto i = 0u; i < db.substances().size(); ++i)
+    {
+        const auto& substance = db.substance(SubstanceId{i});
+        const auto& ids = db.elementsOf(SubstanceId{i});
+        const auto& coefficients = substance.elements().coefficients();
+
+        SubstanceRecord record = {};
+        record.name = writer.string(substance.name().view());
+        record.formula = writer.string(substance.formula().formula());
+        record.type = writer.string(substance.type().view());
+        record.charge = substance.charge();
+        record.molarMass = substance.molarMass();
+        record.composition = { std::uint32_t(compositionElements.size()), std::uint32_t(ids.size()) };
+        record.tags = writer.tags(substance.tags());
+        for(auto k = 0u; k < ids.size(); ++k)
+        {
+            compositionElements.push_back(ids[k].value);
+            compositionCoefficients.push_back(coefficients[k]);
+        }
+        substances.push_back(record);
+    }
+
+    error(writer.pool().size() > UINT32_MAX || writer.tagIndices().size() > UINT32_MAX || compositionElements.size() > UINT32_MAX,
+        "Could not write the binary database file `", path, "` because its strings, tags or compositions exceed the 32-bit offsets of the format.");
+
+    const auto substanceNameIndex = hashTable(db.substances().size(), [&](auto i) { return db.substances()[i].name().view(); });
+    const auto elementSymbolIndex = hashTable(db.elements().size(), [&](auto i) { return db.elements()[i].symbol().view(); });
+
+    std::string buffer(sizeof(Header), '\0');
+
+    Header header = {};
+    std::memcpy(header.magic, magic, sizeof(magic));
+    header.version = version;
+    header.byteOrderMark = byteOrderMark;
+    header.strings = appendSection(buffer, writer.pool().data(), writer.pool().size());
+    header.elements = appendSection(buffer, elements);
+    header.substances = appendSection(buffer, substances);
+    header.compositionElements = appendSection(buffer, compositionElements);
+    header.compositionCoefficients = appendSection(buffer, compositionCoefficients);
+    header.tags = appendSection(buffer, writer.tagDictionary());
+    header.tagIndices = appendSection(buffer, writer.tagIndices());
+    header.substanceNameIndex = appendSection(buffer, substanceNameIndex);
+    header.elementSymbolIndex = appendSection(buffer, elementSymbolIndex);
+    buffer.resize((buffer.size() + 7) / 8 * 8, '\0');
+    header.fileSize = buffer.size();
+    std::memcpy(buffer.data(), &header, sizeof(Header));
+
+    // Write to a temporary file and rename it, so that processes mapping an existing file keep reading its old contents
+    const auto temporary = path + ".tmp";
+    {
+        std::ofstream file(temporary, std::ios::binary);
+        file.write(buffer.data(), buffer.size());
+        error(!file, "Could not write the binary database file `", path, "`.");
+    }
+    error(std::rename(temporary.c_str(), path.c_str()) != 0, "Could not write the binary database file `", path, "`.");
+}
+
+struct MappedDatabase::Impl
+{
+    /// The mapped file.
+    MappedFile file;
+
+    /// The start of the mapped file.
+    const char* base = nullptr;
+
+    /// The size of the mapped file.
+    std::size_t size = 0;
+
+    /// The header of the file.
+    const Header* header = nullptr;
+
+    /// The sections of the file.
+    const char* strings = nullptr;
+    const ElementRecord* elements = nullptr;
+    const SubstanceRecord* substances = nullptr;
+    const std::uint32_t* compositionElements = nullptr;
+    const double* compositionCoefficients = nullptr;
+    const StringRef* tags = nullptr;
+    const std::uint32_t* tagIndices = nullptr;
+    const std::uint32_t* substanceNameIndex = nullptr;
+    const std::uint32_t* elementSymbolIndex = nullptr;
+
+    /// Construct a MappedDatabase::Impl object by mapping a given file.
+    Impl(const std::string& path)
+    : file(path), base(file.data()), size(file.size())
+    {
+        ATOMIK_TIME(Timer::OpenMappedDatabase);
+        ATOMIK_TRACE_DETAIL("open MappedDatabase", path);
+        validate(path);
+    }
+
+    /// Check the header of the mapped file and set the pointers to its sections.
+    auto validate(const std::string& path) -> void
+    {
+        auto check = [&](bool failed, const char* problem)
+        {
+            error(failed, "Could not use the binary database file `", path, "` because ", problem, ".");
+        };
+
+        check(size < sizeof(Header), "it is too small");
+        header = reinterpret_cast<const Header*>(base);
+        check(std::memcmp(header->magic, magic, sizeof(magic)) != 0, "it is not a binary database file");
+        check(header->byteOrderMark != byteOrderMark, "it was written on a machine with a different byte order");
+        check(header->version != version, "its format version is not supported");
+        check(header->fileSize != size, "it is truncated");
+
+        auto section = [&](const Section& s, std::size_t entrySize)
+        {
+            check(s.offset % 8 != 0 || s.offset > size || s.count > (size - s.offset) / entrySize, "one of its sections is out of bounds");
+            return base + s.offset;
+        };
+
+        strings = section(header->strings, 1);
+        elements = reinterpret_cast<const ElementRecord*>(section(header->elements, sizeof(ElementRecord)));
+        substances = reinterpret_cast<const SubstanceRecord*>(section(header->substances, sizeof(SubstanceRecord)));
+        compositionElements = reinterpret_cast<const std::uint32_t*>(section(header->compositionElements, sizeof(std::uint32_t)));
+        compositionCoefficients = reinterpret_cast<const double*>(section(header->compositionCoefficients, sizeof(double)));
+        tags = reinterpret_cast<const StringRef*>(section(header->tags, sizeof(StringRef)));
+        tagIndices = reinterpret_cast<const std::uint32_t*>(section(header->tagIndices, sizeof(std::uint32_t)));
+        substanceNameIndex = reinterpret_cast<const std::uint32_t*>(section(header->substanceNameIndex, sizeof(std::uint32_t)));
+        elementSymbolIndex = reinterpret_cast<const std::uint32_t*>(section(header->elementSymbolIndex, sizeof(std::uint32_t)));
+
+        check(header->substanceNameIndex.count < header->substances.count, "its index of substance names is incomplete");
+        check(header->elementSymbolIndex.count < header->elements.count, "its index of element symbols is incomplete");
+
+        // Check every reference between the sections once, so that the queries can follow them without checks
+        auto inPool = [&](StringRef ref)
+        {
+            return std::uint64_t(ref.offset) + ref.size <= header->strings.count;
+        };
+
+        auto inSection = [&](Range range, const Section& s)
+        {
+            return std::uint64_t(range.begin) + range.count <= s.count;
+        };
+
+        auto validIndexes = [&](const std::uint32_t* table, std::size_t buckets, std::size_t count)
+        {
+            if(buckets == 0)
+                return true;
+            if((buckets & (buckets - 1)) != 0)
+                return false; // the lookups assume a power of two
+            auto empty = false;
+            for(std::size_t i = 0; i < buckets; ++i)
+            {
+                if(table[i] > count)
+                    return false;
+                empty = empty || table[i] == 0;
+            }
+            return empty; // the probing of a missing key stops only at an empty bucket
+        };
+
+        for(std::size_t i = 0; i < header->tags.count; ++i)
+            check(!inPool(tags[i]), "one of its tags is out of the string pool");
+
+        for(std::size_t i = 0; i < header->tagIndices.count; ++i)
+            check(tagIndices[i] >= header->tags.count, "one of its tag indices is out of the tag dictionary");
+
+        for(std::size_t i = 0; i < header->elements.count; ++i)
+        {
+            const auto& record = elements[i];
+            check(!inPool(record.symbol) || !inPool(record.name), "one of its element strings is out of the string pool");
+            check(!inSection(record.tags, header->tagIndices), "the tags of one of its elements are out of bounds");
+        }
+
+        for(std::size_t i = 0; i < header->compositionElements.count; ++i)
+            check(compositionElements[i] >= header->elements.count, "one of its substances is composed of an unknown element");
+
+        for(std::size_t i = 0; i < header->substances.count; ++i)
+        {
+            const auto& record = substances[i];
+            check(!inPool(record.name) || !inPool(record.formula) || !inPool(record.type), "one of its substance strings is out of the string pool");
+            check(!inSection(record.composition, header->compositionElements) || !inSection(record.composition, header->compositionCoefficients),
+                "the composition of one of its substances is out of bounds");
+            check(!inSection(record.tags, header->tagIndices), "the tags of one of its substances are out of bounds");
+        }
+
+        check(!validIndexes(substanceNameIndex, header->substanceNameIndex.count, header->substances.count), "its index of substance names is corrupted");
+        check(!validIndexes(elementSymbolIndex, header->elementSymbolIndex.count, header->elements.count), "its index of element symbols is corrupted");
+    }
+
+    /// Return the string referenced in the string pool.
+    auto string(StringRef ref) const -> std::string_view
+    {
+        return { strings + ref.offset, ref.size };
+    }
+
+    /// Return the index of the entry with given key in a hash table, or -1 if there is none.
+    template<typename Key>
+    auto lookup(const std::uint32_t* table, std::size_t buckets, std::string_view key, const Key& keyOf) const -> Index
+    {
+        if(buckets == 0)
+            return -1;
+        const auto mask = buckets - 1;
+        for(auto bucket = hash(key) & mask; table[bucket] != 0; bucket = (bucket + 1) & mask)
+            if(keyOf(table[bucket] - 1) == key)
+                return table[bucket] - 1;
+        return -1;
+    }
+
+    /// Return the tags in a given range of the tag index section.
+    auto tagsIn(Range range) const -> std::vector<std::string_view>
+    {
+        std::vector<std::string_view> res;
+        res.reserve(range.count);
+        for(auto k = range.begin; k < range.begin + range.count; ++k)
+            res.push_back(string(tags[tagIndices[k]]));
+        return res;
+    }
+};
+
+MappedDatabase::MappedDatabase(const std::string& path)
+: pimpl(allocateShared<Impl>(path))
+{}
+
+auto MappedDatabase::numElements() const -> std::size_t
+{
+    return pimpl->header->elements.count;
+}
+
+auto MappedDatabase::numSubstances() const -> std::size_t
+{
+    return pimpl->header->substances.count;
+}
+
+auto MappedDatabase::elementSymbol(Index ielement) const -> std::string_view
+{
+    return pimpl->string(pimpl->elements[ielement].symbol);
+}
+
+auto MappedDatabase::elementName(Index ielement) const -> std::string_view
+{
+    return pimpl->string(pimpl->elements[ielement].name);
+}
+
+auto MappedDatabase::elementAtomicWeight(Index ielement) const -> double
+{
+    return pimpl->elements[ielement].atomicWeight;
+}
+
+auto MappedDatabase::substanceName(Index isubstance) const -> std::string_view
+{
+    return pimpl->string(pimpl->substances[isubstance].name);
+}
+
+auto MappedDatabase::substanceFormula(Index isubstance) const -> std::string_view
+{
+    return pimpl->string(pimpl->substances[isubstance].formula);
+}
+
+auto MappedDatabase::substanceType(Index isubstance) const -> std::string_view
+{
+    return pimpl->string(pimpl->substances[isubstance].type);
+}
+
+auto MappedDatabase::charge(Index isubstance) const -> double
+{
+    return pimpl->substances[isubstance].charge;
+}
+
+auto MappedDatabase::molarMass(Index isubstance) const -> double
+{
+    return pimpl->substances[isubstance].molarMass;
+}
+
+auto MappedDatabase::numComponents(Index isubstance) const -> std::size_t
+{
+    return pimpl->substances[isubstance].composition.count;
+}
+
+auto MappedDatabase::componentElement(Index isubstance, Index k) const -> Index
+{
+    return pimpl->compositionElements[pimpl->substances[isubstance].composition.begin + k];
+}
+
+auto MappedDatabase::componentCoefficient(Index isubstance, Index k) const -> double
+{
+    return pimpl->compositionCoefficients[pimpl->substances[isubstance].composition.begin + k];
+}
+
+auto MappedDatabase::substanceTags(Index isubstance) const -> std::vector<std::string_view>
+{
+    return pimpl->tagsIn(pimpl->substances[isubstance].tags);
+}
+
+auto MappedDatabase::hasTag(Index isubstance, std::string_view tag) const -> bool
+{
+    const auto range = pimpl->substances[isubstance].tags;
+    for(auto k = range.begin; k < range.begin + range.count; ++k)
+        if(pimpl->string(pimpl->tags[pimpl->tagIndices[k]]) == tag)
+            return true;
+    return false;
+}
+
+auto MappedDatabase::indexWithSymbol(std::string_view symbol) const -> Index
+{
+    return pimpl->lookup(pimpl->elementSymbolIndex, pimpl->header->elementSymbolIndex.count, symbol,
+        [&](auto i) { return elementSymbol(i); });
+}
+
+auto MappedDatabase::indexWithName(std::string_view name) const -> Index
+{
+    return pimpl->lookup(pimpl->substanceNameIndex, pimpl->header->substanceNameIndex.count, name,
+        [&](auto i) { return substanceName(i); });
+}
+
+auto MappedDatabase::element(Index ielement) const -> Element
+{
+    const auto& record = pimpl->elements[ielement];
+    ElementData data;
+    data.symbol = elementSymbol(ielement);
+    data.name = elementName(ielement);
+    data.atomicNumber = record.atomicNumber;
+    data.atomicWeight = record.atomicWeight;
+    data.electronegativity = record.electronegativity;
+    for(auto tag : pimpl->tagsIn(record.tags))
+        data.tags.emplace_back(tag);
+    return Element(std::move(data));
+}
+
+auto MappedDatabase::substance(Index isubstance) const -> Substance
+{
+    return substanceIn(*this, isubstance, [&](Index ielement) { return element(ielement); });
+}
+
+auto MappedDatabase::elements() const -> Elements
+{
+    Elements res;
+    for(auto i = 0u; i < numElements(); ++i)
+        res.append(element(i));
+    return res;
+}
+
+auto MappedDatabase::substances() const -> Substances
+{
+    return substancesIn(*this, elements());
+}
+
+auto MappedDatabase::database() const -> Database
+{
+    auto elements = this->elements();
+    auto substances = substancesIn(*this, elements);
+    return Database(std::move(elements), std::move(substances));
+}
+
+} // namespace Atomik
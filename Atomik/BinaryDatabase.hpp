@@ -0,0 +1,217 @@
+// Atomik is a library that implements basic chemical concepts such as elements, substances, and reactions.
+//
+// Copyright (C) 2018-2019 Allan Leal and Reaktoro Contributors
+//
+// This library is free software; you can redistribute it and/or
+// modify it under the terms of the GNU Lesser General Public
+// License as published by the Free Software Foundation; either
+// version 2.1 of the License, or (at your option) any later version.
+//
+// This library is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+// Lesser General Public License for more details.
+//
+// You should have received a copy of the GNU Lesser General Public License
+// along with this library. If not, see <http://www.gnu.org/licenses/>.
+
+#pragma once
+
+// C++ includes
+#include <cstdint>
+#include <memory>
+#include <string>
+#include <string_view>
+#include <vector>
+
+// Atomik includes
+#include <Atomik/Index.hpp>
+
+namespace Atomik {
+
+// Forward declarations
+class Database;
+class Element;
+class Elements;
+class Substance;
+class Substances;
+
+/// The layout of the binary database format.
+/// A binary database file starts with a Header followed by sections whose offsets (in bytes from the start
+/// of the file) are recorded in the header. Every section is aligned to 8 bytes, and all values are stored in
+/// the byte order of the machine that wrote the file, which is checked when the file is opened.
+/// Strings are stored once in a null-terminated string pool and referenced by StringRef values.
+namespace BinaryFormat {
+
+/// The magic bytes identifying a binary database file.
+constexpr char magic[8] = { 'A', 'T', 'O', 'M', 'I', 'K', 'D', 'B' };
+
+/// The version of the binary database format written by this library.
+constexpr std::uint32_t version = 1;
+
+/// The value used to check the byte order of a binary database file.
+constexpr std::uint32_t byteOrderMark = 0x01020304;
+
+/// A reference to a string in the string pool.
+struct StringRef
+{
+    std::uint32_t offset; ///< The offset of the string in the string pool.
+    std::uint32_t size;   ///< The number of characters in the string (excluding the null terminator).
+};
+
+/// A contiguous range in one of the array sections.
+struct Range
+{
+    std::uint32_t begin; ///< The index of the first entry in the range.
+    std::uint32_t count; ///< The number of entries in the range.
+};
+
+/// A section of the file storing an array of entries.
+struct Section
+{
+    std::uint64_t offset; ///< The offset of the section from the start of the file.
+    std::uint64_t count;  ///< The number of entries (or bytes for the string pool) in the section.
+};
+
+/// The record of an element.
+struct ElementRecord
+{
+    StringRef symbol;
+    StringRef name;
+    std::uint64_t atomicNumber;
+    double atomicWeight;
+    double electronegativity;
+    Range tags; ///< The range of the tags of the element in the tag index section.
+    std::uint32_t padding;
+};
+
+/// The record of a substance.
+struct SubstanceRecord
+{
+    StringRef name;
+    StringRef formula;
+    StringRef type;
+    double charge;
+    double molarMass;
+    Range composition; ///< The range of the elements of the substance in the composition sections.
+    Range tags;        ///< The range of the tags of the substance in the tag index section.
+};
+
+/// The header at the start of a binary database file.
+struct Header
+{
+    char magic[8];
+    std::uint32_t version;
+    std::uint32_t byteOrderMark;
+    std::uint64_t fileSize;
+    Section strings;                 ///< The string pool (`count` in bytes).
+    Section elements;                ///< The ElementRecord entries.
+    Section substances;              ///< The SubstanceRecord entries.
+    Section compositionElements;     ///< The `std::uint32_t` indices of the elements composing the substances (CSR).
+    Section compositionCoefficients; ///< The `double` coefficients of the elements composing the substances (CSR).
+    Section tags;                    ///< The StringRef entries of the tag dictionary.
+    Section tagIndices;              ///< The `std::uint32_t` indices in the tag dictionary referenced by the records.
+    Section substanceNameIndex;      ///< The hash table of substance names (`std::uint32_t` index plus one, or zero if empty).
+    Section elementSymbolIndex;      ///< The hash table of element symbols (`std::uint32_t` index plus one, or zero if empty).
+};
+
+/// Return the hash of a string used in the prebuilt indexes (64-bit FNV-1a, stable across processes).
+auto hash(std::string_view str) -> std::uint64_t;
+
+} // namespace BinaryFormat
+
+/// Write a database to a file in the binary database format.
+/// @throw std::runtime_error When the file cannot be written.
+auto writeBinaryDatabase(const Database& db, const std::string& path) -> void;
+
+/// A type used to query a binary database file in place, without parsing or copying it.
+/// The file is memory-mapped read-only, so processes opening the same file share one physical copy of it.
+/// Strings are returned as views into the mapped file and remain valid while the MappedDatabase object
+/// (or any of its copies) exists:
+/// ~~~
+/// using namespace Atomik;
+/// writeBinaryDatabase(db, "species.atomikdb");
+/// MappedDatabase mapped("species.atomikdb");
+/// auto i = mapped.indexWithName("H2O(aq)");
+/// auto molarMass = mapped.molarMass(i);
+/// ~~~
+class MappedDatabase
+{
+public:
+    /// Construct a MappedDatabase object by mapping a given binary database file.
+    /// @throw std::runtime_error When the file cannot be mapped or is not a valid binary database file.
+    explicit MappedDatabase(const std::string& path);
+
+    /// Return the number of elements in the database.
+    auto numElements() const -> std::size_t;
+
+    /// Return the number of substances in the database.
+    auto numSubstances() const -> std::size_t;
+
+    /// Return the symbol of the element with given index.
+    auto elementSymbol(Index ielement) const -> std::string_view;
+
+    /// Return the name of the element with given index.
+    auto elementName(Index ielement) const -> std::string_view;
+
+    /// Return the atomic weight of the element with given index (in unit of kg/mol).
+    auto elementAtomicWeight(Index ielement) const -> double;
+
+    /// Return the name of the substance with given index.
+    auto substanceName(Index isubstance) const -> std::string_view;
+
+    /// Return the chemical formula of the substance with given index.
+    auto substanceFormula(Index isubstance) const -> std::string_view;
+
+    /// Return the type of the substance with given index.
+    auto substanceType(Index isubstance) const -> std::string_view;
+
+    /// Return the electric charge of the substance with given index.
+    auto charge(Index isubstance) const -> double;
+
+    /// Return the molar mass of the substance with given index (in unit of kg/mol).
+    auto molarMass(Index isubstance) const -> double;
+
+    /// Return the number of elements composing the substance with given index.
+    auto numComponents(Index isubstance) const -> std::size_t;
+
+    /// Return the index of the `k`-th element composing the substance with given index.
+    auto componentElement(Index isubstance, Index k) const -> Index;
+
+    /// Return the coefficient of the `k`-th element composing the substance with given index.
+    auto componentCoefficient(Index isubstance, Index k) const -> double;
+
+    /// Return the tags of the substance with given index.
+    auto substanceTags(Index isubstance) const -> std::vector<std::string_view>;
+
+    /// Return true if the substance with given index has a given tag.
+    auto hasTag(Index isubstance, std::string_view tag) const -> bool;
+
+    /// Return the index of the element with given symbol using the prebuilt index (-1 if not found).
+    auto indexWithSymbol(std::string_view symbol) const -> Index;
+
+    /// Return the index of the substance with given name using the prebuilt index (-1 if not found).
+    auto indexWithName(std::string_view name) const -> Index;
+
+    /// Return the element with given index as an Element object.
+    auto element(Index ielement) const -> Element;
+
+    /// Return the substance with given index as a Substance object.
+    auto substance(Index isubstance) const -> Substance;
+
+    /// Return all elements as an Elements object.
+    auto elements() const -> Elements;
+
+    /// Return all substances as a Substances object.
+    auto substances() const -> Substances;
+
+    /// Return the binary database as a Database object.
+    auto database() const -> Database;
+
+private:
+    struct Impl;
+
+    std::shared_ptr<Impl> pimpl;
+};
+
+} // namespace Atomik
@@ -0,0 +1,153 @@
+// Atomik is a library that implements basic chemical concepts such as elements, substances, and reactions.
+//
+// Copyright (C) 2018-2019 Allan Leal and Reaktoro Contributors
+//
+// This library is free software; you can redistribute it and/or
+// modify it under the terms of the GNU Lesser General Public
+// License as published by the Free Software Foundation; either
+// version 2.1 of the License, or (at your option) any later version.
+//
+// This library is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+// Lesser General Public License for more details.
+//
+// You should have received a copy of the GNU Lesser General Public License
+// along with this library. If not, see <http://www.gnu.org/licenses/>.
+
+// Catch includes
+#include <catch2/catch.hpp>
+
+// C++ includes
+#include <cstddef>
+#include <cstring>
+#include <filesystem>
+#include <fstream>
+
+// Atomik includes
+#include <Atomik/BinaryDatabase.hpp>
+#include <Atomik/Database.hpp>
+using namespace Atomik;
+
+TEST_CASE("Testing BinaryDatabase", "[BinaryDatabase]")
+{
+    const auto path = (std::filesystem::temp_directory_path() / "atomik-binary-database-test.atomikdb").string();
+
+    Substances substances({
+        Substance("H2O").replaceName("H2O(aq)").replaceTags({"aqueous", "neutral"}),
+        Substance("HCO3-").replaceName("HCO3-(aq)").replaceTags({"aqueous", "charged"}),
+        Substance("CaCO3").replaceName("Calcite").replaceTags({"mineral"}),
+    });
+
+    const Database db(Elements::PeriodicTable(), substances);
+
+    writeBinaryDatabase(db, path);
+
+    const MappedDatabase mapped(path);
+
+    // Test the records are queried in place
+    REQUIRE(mapped.numElements() == db.elements().size());
+    REQUIRE(mapped.numSubstances() == 3);
+    REQUIRE(mapped.elementSymbol(1) == "H");
+    REQUIRE(mapped.elementName(1) == "Hydrogen");
+    REQUIRE(mapped.substanceName(2) == "Calcite");
+    REQUIRE(mapped.substanceFormula(1) == "HCO3-");
+    REQUIRE(mapped.charge(1) == substances[1].charge());
+    REQUIRE(mapped.molarMass(2) == substances[2].molarMass());
+    REQUIRE(mapped.numComponents(2) == 3);
+
+    auto mass = 0.0;
+    for(auto k = 0u; k < mapped.numComponents(2); ++k)
+        mass += mapped.componentCoefficient(2, k) * mapped.elementAtomicWeight(mapped.componentElement(2, k));
+    REQUIRE(mass == Approx(substances[2].molarMass()));
+
+    REQUIRE(mapped.substanceTags(1) == std::vector<std::string_view>{"aqueous", "charged"});
+    REQUIRE(mapped.hasTag(0, "neutral"));
+    REQUIRE_FALSE(mapped.hasTag(2, "aqueous"));
+
+    // Test the prebuilt indexes
+    REQUIRE(mapped.indexWithName("Calcite") == 2);
+    REQUIRE(mapped.indexWithName("Aragonite") == -1);
+    REQUIRE(mapped.indexWithSymbol("Ca") == db.elementWithSymbol("Ca").value);
+    REQUIRE(mapped.indexWithSymbol("Xy") == -1);
+
+    // Test the conversion into regular objects
+    REQUIRE(mapped.substance(0).name() == "H2O(aq)");
+    REQUIRE(mapped.substance(0).molarMass() == Approx(substances[0].molarMass()));
+    REQUIRE(mapped.substance(0).tags() == substances[0].tags());
+    REQUIRE(mapped.element(20) == db.elements()[20]);
+    const auto copy = mapped.database();
+    REQUIRE(copy.substancesWithTag("aqueous").size() == 2);
+
+    // Test rewriting the file does not affect existing mappings
+    writeBinaryDatabase(Database(Elements::PeriodicTable(), Substances()), path);
+    REQUIRE(MappedDatabase(path).numSubstances() == 0);
+    REQUIRE(mapped.substanceName(2) == "Calcite");
+
+    // Test invalid files are rejected
+    const auto invalid = path + ".invalid";
+    std::ofstream(invalid, std::ios::binary) << std::string(sizeof(BinaryFormat::Header), 'x');
+    REQUIRE_THROWS(MappedDatabase(invalid));
+    REQUIRE_THROWS(MappedDatabase(path + ".missing"));
+
+    std::filesystem::remove(path);
+    std::filesystem::remove(invalid);
+}
+
+TEST_CASE("Testing BinaryDatabase with corrupted files", "[BinaryDatabase]")
+{
+    using namespace BinaryFormat;
+
+    const auto path = (std::filesystem::temp_directory_path() / "atomik-binary-database-corrupted-test.atomikdb").string();
+
+    Substances substances({
+        Substance("H2O").replaceName("H2O(aq)").replaceTags({"aqueous"}),
+        Substance("CaCO3").replaceName("Calcite").replaceTags({"mineral"}),
+    });
+
+    writeBinaryDatabase(Database(Elements::PeriodicTable(), substances), path);
+
+    std::ifstream in(path, std::ios::binary);
+    const std::string contents((std::istreambuf_iterator<char>(in)), std::istreambuf_iterator<char>());
+
+    Header header;
+    std::memcpy(&header, contents.data(), sizeof(Header));
+
+    // Return the contents of the file with a value written at a given offset
+    auto corrupted = [&](std::size_t offset, auto value)
+    {
+        auto res = contents;
+        std::memcpy(res.data() + offset, &value, sizeof(value));
+        return res;
+    };
+
+    // Test a file is rejected when opened, rather than when queried, if one of its references is out of bounds
+    auto requireRejected = [&](const std::string& bytes)
+    {
+        std::ofstream(path, std::ios::binary | std::ios::trunc) << bytes;
+        REQUIRE_THROWS_AS(MappedDatabase(path), std::runtime_error);
+    };
+
+    const auto substance0 = header.substances.offset;
+
+    requireRejected(corrupted(substance0 + offsetof(SubstanceRecord, name), StringRef{ std::uint32_t(header.strings.count), 1 }));
+    requireRejected(corrupted(substance0 + offsetof(SubstanceRecord, type), StringRef{ 0, UINT32_MAX }));
+    requireRejected(corrupted(header.elements.offset + offsetof(ElementRecord, symbol), StringRef{ UINT32_MAX, 1 }));
+    requireRejected(corrupted(substance0 + offsetof(SubstanceRecord, composition), Range{ std::uint32_t(header.compositionElements.count), 1 }));
+    requireRejected(corrupted(substance0 + offsetof(SubstanceRecord, tags), Range{ UINT32_MAX, 2 }));
+    requireRejected(corrupted(header.tagIndices.offset, std::uint32_t(header.tags.count)));
+    requireRejected(corrupted(header.compositionElements.offset, std::uint32_t(header.elements.count)));
+
+    // Test a hash table without an empty bucket, in which lookups of missing keys would never stop, is rejected
+    const std::uint32_t first = 1;
+    auto full = contents;
+    for(std::size_t i = 0; i < header.substanceNameIndex.count; ++i)
+        std::memcpy(full.data() + header.substanceNameIndex.offset + i * sizeof(first), &first, sizeof(first));
+    requireRejected(full);
+
+    // Test the original contents are still accepted
+    std::ofstream(path, std::ios::binary | std::ios::trunc) << contents;
+    REQUIRE(MappedDatabase(path).indexWithName("Calcite") == 1);
+
+    std::filesystem::remove(path);
+}
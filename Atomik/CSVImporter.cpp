@@ -0,0 +1,488 @@
+// Atomik is a library that implements basic chemical concepts such as elements, substances, and reactions.
+//
+// Copyright (C) 2018-2019 Allan Leal and Reaktoro Contributors
+//
+// This library is free software; you can redistribute it and/or
+// modify it under the terms of the GNU Lesser General Public
+// License as published by the Free Software Foundation; either
+// version 2.1 of the License, or (at your option) any later version.
+//
+// This library is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+// Lesser General Public License for more details.
+//
+// You should have received a copy of the GNU Lesser General Public License
+// along with this library. If not, see <http://www.gnu.org/licenses/>.
+
+#include "CSVImporter.hpp"
+
+// C++ includes
+#include <algorithm>
+#include <future>
+#include <thread>
+#include <unordered_map>
+
+// Atomik includes
+#include <Atomik/ChemicalFormula.hpp>
+#include <Atomik/Exception.hpp>
+#include <Atomik/MappedFile.hpp>
+#include <Atomik/Memory.hpp>
+#include <Atomik/ParallelLoader.hpp>
+#include <Atomik/Substance.hpp>
+#include <Atomik/SubstanceElements.hpp>
+#include <Atomik/SubstanceFormula.hpp>
+#include <Atomik/Tracing.hpp>
+
+namespace Atomik {
+namespace {
+
+/// A type used to locate a row in a delimited text.
+struct Row
+{
+    /// The offset in the text where the row begins.
+    std::size_t begin = 0;
+
+    /// The offset in the text where the row ends (excluding the line break).
+    std::size_t end = 0;
+
+    /// The line number (starting at one) where the row begins.
+    std::size_t line = 0;
+};
+
+/// A type used to represent the indices of the columns of substance attributes in a delimited text.
+struct Columns
+{
+    /// The number of fields in each row (if zero, any number between two and four).
+    std::size_t size = 0;
+
+    /// The index of the column of names.
+    std::size_t name = 0;
+
+    /// The index of the column of formulas.
+    std::size_t formula = 1;
+
+    /// The index of the column of tags.
+    std::size_t tags = 2;
+
+    /// The index of the column of types.
+    std::size_t type = 3;
+};
+
+/// The value of an absent column in Columns.
+constexpr auto absent = std::size_t(-1);
+
+/// A type used to represent the attributes of a substance in a row, with views into the text or a scratch buffer.
+struct RowFields
+{
+    std::string_view name;
+    std::string_view formula;
+    std::string_view tags;
+    std::string_view type;
+};
+
+/// Return the elements of the periodic table keyed by their symbols.
+auto periodicElementsBySymbol() -> const std::unordered_map<std::string_view, Element>&
+{
+    static const auto elements = []()
+    {
+        std::unordered_map<std::string_view, Element> res;
+        for(const auto& element : Elements::PeriodicTable())
+            res.emplace(element.symbol().view(), element);
+        return res;
+    }();
+    return elements;
+}
+
+/// Return the rows of a delimited text, splitting it at line breaks outside quoted fields.
+/// As in `splitFields`, a quote opens a quoted field only as its first non-space character, and is literal elsewhere.
+/// Blank rows are skipped, and a carriage return before a line break is excluded from its row.
+auto splitRows(std::string_view text, char delimiter) -> std::vector<Row>
+{
+    std::vector<Row> rows;
+    auto addRow = [&](std::size_t begin, std::size_t end, std::size_t line)
+    {
+        if(end > begin && text[end - 1] == '\r') --end;
+        if(text.substr(begin, end - begin).find_first_not_of(" \t") != std::string_view::npos)
+            rows.push_back({ begin, end, line });
+    };
+
+    const char stops[] = { '"', '\n', delimiter, '\0' };
+    std::size_t begin = 0;
+    std::size_t fieldBegin = 0;
+    std::size_t line = 1;
+    std::size_t beginLine = 1;
+    for(auto pos = text.find_first_of(stops); pos != std::string_view::npos; pos = text.find_first_of(stops, pos + 1))
+    {
+        if(text[pos] == '"')
+        {
+            if(text.substr(fieldBegin, pos - fieldBegin).find_first_not_of(' ') != std::string_view::npos)
+                continue;
+            auto close = text.find('"', pos + 1);
+            while(close != std::string_view::npos && close + 1 < text.size() && text[close + 1] == '"')
+                close = text.find('"', close + 2);
+            const auto end = std::min(close, text.size());
+            line += std::count(text.begin() + pos, text.begin() + end, '\n');
+            if(close == std::string_view::npos)
+                break;
+            pos = fieldBegin = close; // any further quote in the field is literal
+            continue;
+        }
+        fieldBegin = pos + 1;
+        if(text[pos] != '\n')
+            continue;
+        ++line;
+        addRow(begin, pos, beginLine);
+        begin = pos + 1;
+        beginLine = line;
+    }
+    addRow(begin, text.size(), beginLine);
+    return rows;
+}
+
+/// Split a row into fields, unescaping quoted fields into a scratch buffer.
+/// Leading and trailing spaces of unquoted fields are removed.
+/// @return An error message, or an empty view if the row was split successfully.
+auto splitFields(std::string_view row, char delimiter, std::vector<std::string_view>& fields, std::string& scratch) -> std::string_view
+{
+    fields.clear();
+    scratch.clear();
+    scratch.reserve(row.size()); // so that views into the scratch buffer are never invalidated
+
+    std::size_t pos = 0;
+    while(true)
+    {
+        while(pos < row.size() && row[pos] == ' ' && delimiter != ' ')
+            ++pos;
+
+        if(pos < row.size() && row[pos] == '"')
+        {
+            const auto begin = scratch.size();
+            ++pos;
+            while(true)
+            {
+                const auto quote = row.find('"', pos);
+                if(quote == std::string_view::npos)
+                    return "The row has a quoted field without a closing quote.";
+                scratch.append(row.substr(pos, quote - pos));
+                pos = quote + 1;
+                if(pos < row.size() && row[pos] == '"')
+                {
+                    scratch.push_back('"');
+                    ++pos;
+                }
+                else break;
+            }
+            fields.push_back(std::string_view(scratch).substr(begin));
+            while(pos < row.size() && row[pos] == ' ' && delimiter != ' ')
+                ++pos;
+            if(pos < row.size() && row[pos] != delimiter)
+                return "The row has characters after the closing quote of a field.";
+        }
+        else
+        {
+            const auto end = std::min(row.find(delimiter, pos), row.size());
+            auto field = row.substr(pos, end - pos);
+            while(!field.empty() && field.back() == ' ')
+                field.remove_suffix(1);
+            fields.push_back(field);
+            pos = end;
+        }
+
+        if(pos >= row.size())
+            return {};
+        ++pos; // skip the delimiter
+    }
+}
+
+/// Return the columns of substance attributes named in a header row.
+auto parseHeader(std::string_view text, const Row& row, char delimiter) -> Columns
+{
+    std::vector<std::string_view> fields;
+    std::string scratch;
+    const auto message = splitFields(text.substr(row.begin, row.end - row.begin), delimiter, fields, scratch);
+    error(!message.empty(), "Could not parse the header of the delimited text. ", message);
+
+    Columns columns;
+    columns.size = fields.size();
+    columns.name = columns.formula = columns.tags = columns.type = absent;
+    for(auto i = 0u; i < fields.size(); ++i)
+    {
+        if(fields[i] == "name") columns.name = i;
+        else if(fields[i] == "formula") columns.formula = i;
+        else if(fields[i] == "tags") columns.tags = i;
+        else if(fields[i] == "type") columns.type = i;
+    }
+    error(columns.name == absent, "The header of the delimited text has no `name` column.");
+    error(columns.formula == absent, "The header of the delimited text has no `formula` column.");
+    return columns;
+}
+
+/// Return the field in a given column, or an empty view if the column is absent from the row.
+auto field(const std::vector<std::string_view>& fields, std::size_t column) -> std::string_view
+{
+    return column < fields.size() ? fields[column] : std::string_view();
+}
+
+/// Call a function with each tag in a tags field.
+template<typename Function>
+auto forEachTag(std::string_view tags, char separator, const Function& f) -> void
+{
+    while(!tags.empty())
+    {
+        const auto end = std::min(tags.find(separator), tags.size());
+        if(end > 0)
+            f(tags.substr(0, end));
+        tags.remove_prefix(std::min(end + 1, tags.size()));
+    }
+}
+
+/// A type used to parse the rows of a delimited text, reusing its buffers from row to row.
+class RowParser
+{
+public:
+    /// Construct a RowParser object for a text with given columns.
+    RowParser(std::string_view text, const Columns& columns, const CSVOptions& options)
+    : m_text(text), m_columns(columns), m_options(options)
+    {}
+
+    /// Parse a row into its fields and the terms of its formula.
+    /// @return An error message, or an empty string if the row was parsed successfully.
+    auto parse(const Row& row) -> std::string
+    {
+        const auto message = splitFields(m_text.substr(row.begin, row.end - row.begin), m_options.delimiter, m_fields, m_scratch);
+        if(!message.empty())
+            return std::string(message);
+
+        if(m_columns.size && m_fields.size() != m_columns.size)
+            return str("The row has ", m_fields.size(), " fields instead of ", m_columns.size, ".");
+        if(!m_columns.size && (m_fields.size() < 2 || m_fields.size() > 4))
+            return str("The row has ", m_fields.size(), " fields instead of two to four (name, formula, tags, type).");
+
+        m_row.name = field(m_fields, m_columns.name);
+        m_row.formula = field(m_fields, m_columns.formula);
+        m_row.tags = field(m_fields, m_columns.tags);
+        m_row.type = field(m_fields, m_columns.type);
+
+        if(m_row.name.empty())
+            return "The row has an empty name.";
+        if(m_row.formula.empty())
+            return "The row has an empty formula.";
+
+        try { parseChemicalFormula(m_row.formula, m_terms); }
+        catch(const std::exception&) { return str("Could not parse the formula `", m_row.formula, "`."); }
+
+        const auto& elements = periodicElementsBySymbol();
+        for(auto i = 0u; i < m_terms.size; ++i)
+            if(!elements.count(m_terms.symbols[i]))
+                return str("The formula `", m_row.formula, "` has the element `", m_terms.symbols[i], "`, which is not in the periodic table.");
+
+        return {};
+    }
+
+    /// Return the fields of the last parsed row.
+    auto fields() const -> const RowFields& { return m_row; }
+
+    /// Return the terms of the formula of the last parsed row.
+    auto terms() const -> const FormulaTerms& { return m_terms; }
+
+    /// Return the options used to parse the rows.
+    auto options() const -> const CSVOptions& { return m_options; }
+
+private:
+    /// The delimited text.
+    std::string_view m_text;
+
+    /// The columns of substance attributes in the text.
+    Columns m_columns;
+
+    /// The options used to parse the rows.
+    CSVOptions m_options;
+
+    /// The fields of the last parsed row.
+    std::vector<std::string_view> m_fields;
+
+    /// The buffer of the unescaped quoted fields of the last parsed row.
+    std::string m_scratch;
+
+    /// The attributes of the substance in the last parsed row.
+    RowFields m_row;
+
+    /// The terms of the formula of the last parsed row.
+    FormulaTerms m_terms;
+};
+
+/// Parse the rows of a delimited text on several threads, appending each row with `append` into
+/// an output of type `Output` per chunk of rows, and return the outputs and errors of all chunks in order.
+template<typename Output, typename Append>
+auto parseRows(std::string_view text, const CSVOptions& options, const Append& append) -> std::pair<std::vector<Output>, std::vector<CSVRowError>>
+{
+    std::vector<Row> rows;
+    {
+        ATOMIK_TRACE("split rows");
+        rows = splitRows(text, options.delimiter);
+    }
+
+    Columns columns;
+    if(options.header && !rows.empty())
+    {
+        columns = parseHeader(text, rows.front(), options.delimiter);
+        rows.erase(rows.begin());
+    }
+
+    const auto numChunks = std::max<std::size_t>(1, std::min(threadCount(options.numThreads), rows.size()));
+
+    const auto resource = memoryResource();
+
+    auto parseChunk = [&](std::size_t first, std::size_t last)
+    {
+        ATOMIK_TRACE_THREAD("CSVImporter worker");
+        MemoryResourceScope scope(resource);
+        ATOMIK_TRACE("parse rows");
+        std::pair<Output, std::vector<CSVRowError>> res;
+        RowParser parser(text, columns, options);
+        for(auto i = first; i < last; ++i)
+        {
+            auto message = parser.parse(rows[i]);
+            if(message.empty())
+                append(res.first, parser);
+            else res.second.push_back({ rows[i].line, std::move(message) });
+        }
+        return res;
+    };
+
+    std::vector<std::future<std::pair<Output, std::vector<CSVRowError>>>> futures;
+    futures.reserve(numChunks);
+    for(std::size_t i = 0; i < numChunks; ++i)
+    {
+        const auto first = rows.size() * i / numChunks;
+        const auto last = rows.size() * (i + 1) / numChunks;
+        futures.push_back(std::async(std::launch::async, parseChunk, first, last));
+    }
+
+    std::pair<std::vector<Output>, std::vector<CSVRowError>> res;
+    res.first.reserve(numChunks);
+    for(auto& future : futures)
+    {
+        auto chunk = future.get();
+        res.first.push_back(std::move(chunk.first));
+        res.second.insert(res.second.end(), chunk.second.begin(), chunk.second.end());
+    }
+    return res;
+}
+
+/// Append the substance in the last row parsed by a RowParser object to a vector of substances.
+auto appendSubstance(std::vector<Substance>& substances, const RowParser& parser) -> void
+{
+    const auto& row = parser.fields();
+    const auto& terms = parser.terms();
+    const auto& periodic = periodicElementsBySymbol();
+
+    SubstanceFormula::Args formulaArgs;
+    formulaArgs.formula = std::string(row.formula);
+    for(auto i = 0u; i < terms.size; ++i)
+        formulaArgs.elements.emplace(std::string(terms.symbols[i]), terms.coefficients[i]);
+    const SubstanceFormula formula(formulaArgs);
+
+    std::vector<Element> elements;
+    elements.reserve(formula.symbols().size());
+    for(const auto& symbol : formula.symbols())
+        elements.push_back(periodic.at(symbol.view()));
+
+    Substance::Args args;
+    args.name = std::string(row.name);
+    args.formula = formula;
+    args.elements = SubstanceElements({
+        .elements = Elements(std::move(elements)),
+        .coefficients = formula.coefficients(),
+        .oxidationStates = {}
+    });
+    args.type = std::string(row.type);
+    forEachTag(row.tags, parser.options().tagSeparator, [&](std::string_view tag) { args.tags.emplace_back(tag); });
+
+    substances.push_back(Substance(std::move(args)));
+}
+
+/// A type used to append the rows parsed by RowParser objects to a SubstanceTable object, reusing its buffers from row to row.
+struct TableAppender
+{
+    /// The table of substances.
+    SubstanceTable table;
+
+    /// The tags of the last appended row.
+    std::vector<InternedString> tags;
+
+    /// The elements of the last appended row.
+    std::vector<Element> elements;
+
+    /// The coefficients of the elements of the last appended row.
+    std::vector<double> coefficients;
+
+    /// Append the substance in the last row parsed by a RowParser object.
+    auto append(const RowParser& parser) -> void
+    {
+        const auto& row = parser.fields();
+        const auto& terms = parser.terms();
+        const auto& periodic = periodicElementsBySymbol();
+
+        tags.clear();
+        forEachTag(row.tags, parser.options().tagSeparator, [&](std::string_view tag) { tags.emplace_back(tag); });
+
+        elements.clear();
+        coefficients.clear();
+        for(auto i = 0u; i < terms.size; ++i)
+        {
+            elements.push_back(periodic.at(terms.symbols[i]));
+            coefficients.push_back(terms.coefficients[i]);
+        }
+
+        table.append(row.name, row.formula, InternedString(row.type), tags, elements, coefficients);
+    }
+};
+
+} // namespace
+
+auto parseSubstancesCSV(std::string_view text, const CSVOptions& options) -> CSVSubstances
+{
+    ATOMIK_TRACE("parseSubstancesCSV");
+    auto chunks = parseRows<std::vector<Substance>>(text, options, appendSubstance);
+
+    std::size_t size = 0;
+    for(const auto& chunk : chunks.first)
+        size += chunk.size();
+
+    std::vector<Substance> substances;
+    substances.reserve(size);
+    for(auto& chunk : chunks.first)
+        std::move(chunk.begin(), chunk.end(), std::back_inserter(substances));
+
+    return { Substances(std::move(substances)), std::move(chunks.second) };
+}
+
+auto parseSubstanceTableCSV(std::string_view text, const CSVOptions& options) -> CSVSubstanceTable
+{
+    ATOMIK_TRACE("parseSubstanceTableCSV");
+    auto chunks = parseRows<TableAppender>(text, options, [](TableAppender& appender, const RowParser& parser) { appender.append(parser); });
+
+    SubstanceTable table;
+    for(const auto& chunk : chunks.first)
+        table.append(chunk.table);
+
+    return { std::move(table), std::move(chunks.second) };
+}
+
+auto importSubstancesCSV(const std::string& path, const CSVOptions& options) -> CSVSubstances
+{
+    ATOMIK_TRACE_DETAIL("importSubstancesCSV", path);
+    const MappedFile file(path);
+    return parseSubstancesCSV(file.view(), options);
+}
+
+auto importSubstanceTableCSV(const std::string& path, const CSVOptions& options) -> CSVSubstanceTable
+{
+    ATOMIK_TRACE_DETAIL("importSubstanceTableCSV", path);
+    const MappedFile file(path);
+    return parseSubstanceTableCSV(file.view(), options);
+}
+
+} // namespace Atomik
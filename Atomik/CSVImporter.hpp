@@ -0,0 +1,107 @@
+// Atomik is a library that implements basic chemical concepts such as elements, substances, and reactions.
+//
+// Copyright (C) 2018-2019 Allan Leal and Reaktoro Contributors
+//
+// This library is free software; you can redistribute it and/or
+// modify it under the terms of the GNU Lesser General Public
+// License as published by the Free Software Foundation; either
+// version 2.1 of the License, or (at your option) any later version.
+//
+// This library is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+// Lesser General Public License for more details.
+//
+// You should have received a copy of the GNU Lesser General Public License
+// along with this library. If not, see <http://www.gnu.org/licenses/>.
+
+#pragma once
+
+// C++ includes
+#include <cstddef>
+#include <string>
+#include <string_view>
+#include <vector>
+
+// Atomik includes
+#include <Atomik/SubstanceTable.hpp>
+#include <Atomik/Substances.hpp>
+
+namespace Atomik {
+
+/// The options used to import substances from a delimited text (e.g., CSV or TSV).
+struct CSVOptions
+{
+    /// The character separating the fields of a row (e.g., `','` for CSV or `'\t'` for TSV).
+    char delimiter = ',';
+
+    /// The character separating the tags in the tags field of a row.
+    char tagSeparator = ' ';
+
+    /// True if the first row names the columns `name`, `formula`, `tags` and `type` in any order.
+    /// Otherwise, the fields of each row are the name, formula, tags and type, in this order,
+    /// with the tags and type optional.
+    bool header = true;
+
+    /// The number of threads used to parse the rows (if zero, the number of hardware threads).
+    std::size_t numThreads = 0;
+};
+
+/// A type used to describe a row of a delimited text that could not be imported.
+struct CSVRowError
+{
+    /// The line number (starting at one) where the row begins.
+    std::size_t line = 0;
+
+    /// The reason the row could not be imported.
+    std::string message;
+};
+
+/// The substances imported from a delimited text, along with the rows that could not be imported.
+struct CSVSubstances
+{
+    /// The substances in the rows that were imported, in their original order.
+    Substances substances;
+
+    /// The rows that could not be imported, in their original order.
+    std::vector<CSVRowError> errors;
+};
+
+/// The substances imported from a delimited text into columns, along with the rows that could not be imported.
+struct CSVSubstanceTable
+{
+    /// The substances in the rows that were imported, in their original order.
+    SubstanceTable table;
+
+    /// The rows that could not be imported, in their original order.
+    std::vector<CSVRowError> errors;
+};
+
+/// Return the substances in a delimited text with columns of names, formulas, tags and types.
+/// Fields may be quoted with `"` (with `""` for a quote inside a quoted field) to contain delimiters or line breaks.
+/// The text is split at its row boundaries into chunks, and each chunk is parsed on its own thread
+/// with formulas parsed without heap allocation. A row with a wrong number of fields, an empty name
+/// or formula, or an element not in the periodic table is skipped and reported in `errors`.
+/// ~~~
+/// using namespace Atomik;
+/// auto imported = parseSubstancesCSV("name,formula,tags,type\nH2O(aq),H2O,solvent,aqueous\nH+(aq),H+,cation,aqueous\n");
+/// for(const auto& e : imported.errors)
+///     std::cerr << "line " << e.line << ": " << e.message << std::endl;
+/// ~~~
+/// @throw std::runtime_error When the header does not name the `name` and `formula` columns.
+auto parseSubstancesCSV(std::string_view text, const CSVOptions& options = {}) -> CSVSubstances;
+
+/// Return the substances in a delimited text as columns of a SubstanceTable, without constructing Substance objects.
+/// The text is parsed as in `parseSubstancesCSV`.
+/// @throw std::runtime_error When the header does not name the `name` and `formula` columns.
+auto parseSubstanceTableCSV(std::string_view text, const CSVOptions& options = {}) -> CSVSubstanceTable;
+
+/// Return the substances in a delimited file, which is mapped into memory and parsed as in `parseSubstancesCSV`.
+/// @throw std::runtime_error When the file cannot be read or its header does not name the `name` and `formula` columns.
+auto importSubstancesCSV(const std::string& path, const CSVOptions& options = {}) -> CSVSubstances;
+
+/// Return the substances in a delimited file as columns of a SubstanceTable, mapping the file into memory.
+/// @throw std::runtime_error When the file cannot be read or its header does not name the `name` and `formula` columns.
+auto importSubstanceTableCSV(const std::string& path, const CSVOptions& options = {}) -> CSVSubstanceTable;
+
+} // namespace Atomik
@@ -0,0 +1,166 @@
+// Atomik is a library that implements basic chemical concepts such as elements, substances, and reactions.
+//
+// Copyright (C) 2018-2019 Allan Leal and Reaktoro Contributors
+//
+// This library is free software; you can redistribute it and/or
+// modify it under the terms of the GNU Lesser General Public
+// License as published by the Free Software Foundation; either
+// version 2.1 of the License, or (at your option) any later version.
+//
+// This library is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+// Lesser General Public License for more details.
+//
+// You should have received a copy of the GNU Lesser General Public License
+// along with this library. If not, see <http://www.gnu.org/licenses/>.
+
+// Catch includes
+#include <catch2/catch.hpp>
+
+// C++ includes
+#include <filesystem>
+#include <fstream>
+
+// Atomik includes
+#include <Atomik/CSVImporter.hpp>
+#include <Atomik/Substance.hpp>
+using namespace Atomik;
+
+TEST_CASE("Testing CSVImporter", "[CSVImporter]")
+{
+    const std::string text =
+        "formula,name,type,tags\n"
+        "H2O,H2O(aq),aqueous,solvent neutral\n"
+        "H+,H+(aq),aqueous,cation\r\n"
+        "\n"
+        "CaCO3,Calcite,mineral,\n"
+        "\"Ca(HCO3)+\",\"CaHCO3+,\n"
+        "\"\"complex\"\"\",aqueous,\"cation complex\"\n"
+        "Xx2O,Unknown,aqueous,\n"
+        "CO2,CO2(g),gaseous\n"
+        ",Nameless,aqueous,\n"
+        "CO3-2,CO3-2(aq),aqueous,anion\n";
+
+    SECTION("Testing the import of substances")
+    {
+        for(auto numThreads : { 1, 2, 8 })
+        {
+            CSVOptions options;
+            options.numThreads = numThreads;
+
+            const auto imported = parseSubstancesCSV(text, options);
+            const auto& substances = imported.substances;
+
+            REQUIRE(substances.size() == 5);
+            REQUIRE(substances[0].name() == "H2O(aq)");
+            REQUIRE(substances[0].formula().formula() == "H2O");
+            REQUIRE(substances[0].type() == "aqueous");
+            REQUIRE(substances[0].tags().size() == 2);
+            REQUIRE(substances[0].tags()[1] == "neutral");
+            REQUIRE(substances[0].molarMass() == Approx(Substance("H2O").molarMass()));
+            REQUIRE(substances[1].name() == "H+(aq)");
+            REQUIRE(substances[1].charge() == 1);
+            REQUIRE(substances[2].name() == "Calcite");
+            REQUIRE(substances[2].tags().empty());
+            REQUIRE(substances[3].name() == "CaHCO3+,\n\"complex\"");
+            REQUIRE(substances[3].formula().formula() == "Ca(HCO3)+");
+            REQUIRE(substances[3].tags().size() == 2);
+            REQUIRE(substances[3].tags()[1] == "complex");
+            REQUIRE(substances[3].formula().coefficient("O") == 3);
+            REQUIRE(substances[4].name() == "CO3-2(aq)");
+            REQUIRE(substances[4].charge() == -2);
+
+            REQUIRE(imported.errors.size() == 3);
+            REQUIRE(imported.errors[0].line == 8);
+            REQUIRE(imported.errors[0].message.find("Xx") != std::string::npos);
+            REQUIRE(imported.errors[1].line == 9);
+            REQUIRE(imported.errors[2].line == 10);
+        }
+    }
+
+    SECTION("Testing the import of substances into a table")
+    {
+        for(auto numThreads : { 1, 3 })
+        {
+            CSVOptions options;
+            options.numThreads = numThreads;
+
+            const auto imported = parseSubstanceTableCSV(text, options);
+            const auto& table = imported.table;
+            const auto expected = SubstanceTable(parseSubstancesCSV(text, options).substances);
+
+            REQUIRE(imported.errors.size() == 3);
+            REQUIRE(table.size() == expected.size());
+            for(auto i = 0u; i < table.size(); ++i)
+            {
+                REQUIRE(table.name(i) == expected.name(i));
+                REQUIRE(table.formula(i) == expected.formula(i));
+                REQUIRE(table.type(i) == expected.type(i));
+                REQUIRE(table.tags(i) == expected.tags(i));
+                REQUIRE(table.charges()[i] == expected.charges()[i]);
+                REQUIRE(table.molarMasses()[i] == Approx(expected.molarMasses()[i]));
+                REQUIRE(table.substance(i).formula().equivalent(expected.substance(i).formula()));
+            }
+            REQUIRE(table.indicesWithTag("cation") == std::vector<Index>{1, 3});
+        }
+    }
+
+    SECTION("Testing the import of a TSV file without header")
+    {
+        const auto path = (std::filesystem::temp_directory_path() / "atomik-csv-importer-test.tsv").string();
+
+        std::ofstream(path, std::ios::binary) <<
+            "H2O(aq)\tH2O\tsolvent\taqueous\n"
+            "Na+(aq)\tNa+\n"
+            "Cl-(aq)\tCl-\tanion\taqueous\textra\n"
+            "\"Quartz\tSiO2\n";
+
+        CSVOptions options;
+        options.delimiter = '\t';
+        options.header = false;
+
+        const auto imported = importSubstancesCSV(path, options);
+        REQUIRE(imported.substances.size() == 2);
+        REQUIRE(imported.substances[0].type() == "aqueous");
+        REQUIRE(imported.substances[1].name() == "Na+(aq)");
+        REQUIRE(imported.errors.size() == 2);
+        REQUIRE(imported.errors[0].line == 3);
+        REQUIRE(imported.errors[1].line == 4);
+
+        REQUIRE(importSubstanceTableCSV(path, options).table.size() == 2);
+
+        std::filesystem::remove(path);
+    }
+
+    SECTION("Testing quotes inside unquoted fields")
+    {
+        for(auto numThreads : { 1, 2 })
+        {
+            CSVOptions options;
+            options.numThreads = numThreads;
+
+            const auto imported = parseSubstancesCSV(
+                "name,formula,tags\n"
+                "bad\"name,H2O,aqueous\n"
+                "Calcite,CaCO3,mineral\n"
+                " \"Quartz,\nalpha\" ,SiO2,\"mineral silicate\"\n"
+                "CO2(g),CO2,gaseous\n", options);
+
+            REQUIRE(imported.errors.empty());
+            REQUIRE(imported.substances.size() == 4);
+            REQUIRE(parseSubstancesCSV("name,formula\nbad\"name,H2O\nx,\"CO2\n").errors[0].line == 3);
+            REQUIRE(imported.substances[0].name() == "bad\"name");
+            REQUIRE(imported.substances[1].name() == "Calcite");
+            REQUIRE(imported.substances[2].name() == "Quartz,\nalpha");
+            REQUIRE(imported.substances[2].tags().size() == 2);
+            REQUIRE(imported.substances[3].name() == "CO2(g)");
+        }
+    }
+
+    SECTION("Testing a header without the required columns")
+    {
+        REQUIRE_THROWS(parseSubstancesCSV("name,tags\nH2O(aq),aqueous\n"));
+        REQUIRE(parseSubstancesCSV("").substances.size() == 0);
+    }
+}
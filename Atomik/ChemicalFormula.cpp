@@ -18,157 +18,179 @@
 #include "SubstanceFormula.hpp"
 
 // C++ includes
-using std::pair;
+#include <charconv>
 using std::string;
 using std::unordered_map;
 
 // Atomik includes
+#include <Atomik/ChemicalFormula.hpp>
 #include <Atomik/Exception.hpp>
+#include <Atomik/Instrumentation.hpp>
 
 namespace Atomik {
 namespace {
 
-auto parseElementAtom(string::iterator begin, string::iterator end) -> pair<string, string::iterator>
+/// Return the number parsed from the beginning of a given string, or zero if there is none (like `atof`).
+auto parseNumber(std::string_view str) -> double
 {
-    error(!isupper(*begin), "The first character in a chemical formula must be in uppercase.");
-    if(begin == end) return {"", begin};
-    auto endelement = find_if(begin + 1, end, [](char c){return isupper(c) || !isalpha(c);});
-    string element = string(begin, endelement);
-    return {element, endelement};
+    double number = 0.0;
+    std::from_chars(str.data(), str.data() + str.size(), number);
+    return number;
 }
 
-auto parseNumAtoms(string::iterator begin, string::iterator end) -> pair<double, string::iterator>
+/// Return the number of charges parsed from the digits following a sign in a chemical formula.
+auto parseChargeNumber(std::string_view digits) -> double
 {
-    if(begin == end) return {1.0, begin};
-    if(!(isdigit(*begin) || *begin == '.')) return {1.0, begin};
-    auto endnumber = find_if(begin, end, [](char c){return !(isdigit(c) || c == '.');});
-    double number = atof(string(begin, endnumber).c_str());
-    return {number, endnumber};
+    double number = 0.0;
+    const auto res = std::from_chars(digits.data(), digits.data() + digits.size(), number);
+    error(res.ec != std::errc(), "Could not parse the charge `", std::string(digits), "` in a chemical formula.");
+    return number;
 }
 
-auto findMatchedParenthesis(string::iterator begin, string::iterator end) -> string::iterator
+auto parseNumAtoms(std::string_view str, std::size_t& pos) -> double
 {
-    if(begin == end) return end;
-    int level = 0;
-    for(auto iter = begin+1; iter < end; ++iter)
-    {
-        level = (*iter == '(') ? level + 1 : level;
-        level = (*iter == ')') ? level - 1 : level;
-        if(*iter == ')' && level == -1)
-            return iter;
-    }
-    return end;
+    if(pos == str.size()) return 1.0;
+    if(!(isdigit(str[pos]) || str[pos] == '.')) return 1.0;
+    const auto begin = pos;
+    while(pos < str.size() && (isdigit(str[pos]) || str[pos] == '.'))
+        ++pos;
+    return parseNumber(str.substr(begin, pos - begin));
 }
 
-auto parseChemicalFormula(string::iterator begin, string::iterator end, unordered_map<string, double>& result, double scalar) -> void
+auto findMatchedParenthesis(std::string_view str, std::size_t begin) -> std::size_t
 {
-    if(begin == end) return;
-
-    if(*begin != '(' && *begin != '.' && !isupper(*begin))
+    int level = 0;
+    for(auto i = begin + 1; i < str.size(); ++i)
     {
-        parseChemicalFormula(begin + 1, end, result, scalar);
+        level = (str[i] == '(') ? level + 1 : level;
+        level = (str[i] == ')') ? level - 1 : level;
+        if(str[i] == ')' && level == -1)
+            return i;
     }
-    else if(*begin == '(')
-    {
-        string::iterator begin1 = begin + 1;
-        string::iterator end1   = findMatchedParenthesis(begin, end);
-
-        auto res = parseNumAtoms(end1 + 1, end);
+    return str.size();
+}
 
-        const double number = res.first;
+/// A type used to store the terms of a chemical formula in a FormulaTerms object, and in a map once that is full.
+struct UnboundedTerms
+{
+    /// The terms of the formula, while there are at most `FormulaTerms::capacity` of them.
+    FormulaTerms terms;
 
-        string::iterator begin2 = res.second;
-        string::iterator end2   = end;
+    /// All the terms of the formula, once there are more than `FormulaTerms::capacity` of them.
+    unordered_map<string, double> overflow;
 
-        parseChemicalFormula(begin1, end1, result, scalar * number);
-        parseChemicalFormula(begin2, end2, result, scalar);
-    }
-    else if(*begin == '.')
+    /// Add a coefficient to a given symbol, moving all terms to `overflow` when `terms` is full.
+    auto add(std::string_view symbol, double coefficient) -> void
     {
-        auto res = parseNumAtoms(begin + 1, end);
-
-        const double number = res.first;
-
-        string::iterator begin1 = res.second;
-        string::iterator end1   = end;
-
-        parseChemicalFormula(begin1, end1, result, scalar * number);
+        if(overflow.empty())
+        {
+            if(terms.size < FormulaTerms::capacity || terms.find(symbol) < terms.size)
+            {
+                terms.add(symbol, coefficient);
+                return;
+            }
+            for(std::size_t i = 0; i < terms.size; ++i)
+                overflow.emplace(terms.symbols[i], terms.coefficients[i]);
+        }
+        overflow[string(symbol)] += coefficient;
     }
-    else
-    {
-        auto res1 = parseElementAtom(begin, end);
-        auto res2 = parseNumAtoms(res1.second, end);
-
-        string element = res1.first;
-        double natoms  = res2.first;
+};
 
-        if(result.count(element)) result[element] += scalar * natoms;
-        else result[element] = scalar * natoms;
+/// Return true if a given symbol is in the terms of a chemical formula.
+auto contains(const FormulaTerms& terms, std::string_view symbol) -> bool
+{
+    return terms.find(symbol) < terms.size;
+}
 
-        string::iterator begin1 = res2.second;
-        string::iterator end1   = end;
+/// Return true if a given symbol is in the terms of a chemical formula.
+auto contains(const UnboundedTerms& terms, std::string_view symbol) -> bool
+{
+    return terms.overflow.empty() ? contains(terms.terms, symbol) : terms.overflow.count(string(symbol)) > 0;
+}
 
-        parseChemicalFormula(begin1, end1, result, scalar);
+template<typename Terms>
+auto parseChemicalFormula(std::string_view str, Terms& terms, double scalar) -> void
+{
+    std::size_t pos = 0;
+    while(pos < str.size())
+    {
+        if(str[pos] == '(')
+        {
+            const auto end = findMatchedParenthesis(str, pos);
+            auto next = std::min(end + 1, str.size());
+            const auto number = parseNumAtoms(str, next);
+            parseChemicalFormula(str.substr(pos + 1, end - pos - 1), terms, scalar * number);
+            pos = next;
+        }
+        else if(str[pos] == '.')
+        {
+            ++pos;
+            scalar *= parseNumAtoms(str, pos);
+        }
+        else if(isupper(str[pos]))
+        {
+            const auto begin = pos++;
+            while(pos < str.size() && !isupper(str[pos]) && isalpha(str[pos]))
+                ++pos;
+            const auto symbol = str.substr(begin, pos - begin);
+            terms.add(symbol, scalar * parseNumAtoms(str, pos));
+        }
+        else ++pos;
     }
 }
 
-auto parseChargeModeSignNumber(string formula) -> double
+auto parseChargeModeSignNumber(std::string_view formula) -> double
 {
-    size_t ipos = formula.find_last_of('+');
-    size_t ineg = formula.find_last_of('-');
-    size_t imin = min(ipos, ineg);
+    const auto ipos = formula.find_last_of('+');
+    const auto ineg = formula.find_last_of('-');
+    const auto imin = std::min(ipos, ineg);
 
-    if(imin == string::npos)
+    if(imin == std::string_view::npos)
         return 0.0;
 
-    int sign = (imin == ipos) ? +1 : -1;
+    const int sign = (imin == ipos) ? +1 : -1;
 
     if(imin + 1 == formula.size())
         return sign;
 
-    string digits = formula.substr(imin + 1);
-
-    return sign * stod(digits);
+    return sign * parseChargeNumber(formula.substr(imin + 1));
 }
 
-auto parseChargeModeMultipleSigns(string formula) -> double
+auto parseChargeModeMultipleSigns(std::string_view formula) -> double
 {
     const auto sign = formula.back();
     const auto signval = sign == '+' ? 1 : (sign == '-' ? -1 : 0);
-    const auto ilast = formula.size() - 1;
-    if(sign != 0)
-    {
-        auto i = 0;
-        while(formula[ilast - i] == sign && i <= ilast)
-            ++i;
-        const auto charge = i * signval;
-        return charge;
-    }
-    else return 0;
+    if(signval == 0) return 0.0;
+    std::size_t i = 0;
+    while(i < formula.size() && formula[formula.size() - 1 - i] == sign)
+        ++i;
+    return double(i) * signval;
 }
 
-auto parseChargeModeNumberSign(string formula) -> double
+auto parseChargeModeNumberSign(std::string_view formula) -> double
 {
     if(formula.back() != ')') return 0.0;
 
-    size_t iparbegin = formula.rfind('(');
+    const auto iparbegin = formula.rfind('(');
 
-    if(iparbegin == string::npos) return 0.0;
+    if(iparbegin == std::string_view::npos) return 0.0;
 
     const auto isign = formula.size() - 2;
     const auto sign = formula[isign] == '+' ? +1.0 : formula[isign] == '-' ? -1.0 : 0.0;
 
     if(sign == 0.0) return 0.0;
 
-    string digits(formula.begin() + iparbegin + 1, formula.end() - 2);
+    const auto digits = formula.substr(iparbegin + 1, isign - iparbegin - 1);
 
     if(digits.empty()) return sign;
 
-    return sign * stod(digits);
+    return sign * parseChargeNumber(digits);
 }
 
-auto parseCharge(string formula) -> double
+auto parseCharge(std::string_view formula) -> double
 {
+    if(formula.empty()) return 0.0;
+
     double charge;
 
     charge = parseChargeModeMultipleSigns(formula); if(charge != 0.0) return charge;
@@ -178,22 +200,66 @@ auto parseCharge(string formula) -> double
     return 0.0;
 }
 
-} // namespace
-
-auto parseChemicalFormula(const std::string& formula) -> std::unordered_map<std::string, double>
+/// Parse a chemical formula into given terms, together with its charge as the coefficient of the symbol `Z`.
+template<typename Terms>
+auto parseTerms(std::string_view formula, Terms& terms) -> void
 {
-    unordered_map<string, double> result;
+    ATOMIK_COUNT(Counter::FormulaParses, 1);
+    ATOMIK_TIME(Timer::FormulaParse);
 
     // Parse the formula for elements and their coefficients (without charge)
-    parseChemicalFormula(formula.begin(), formula.end(), result, 1.0);
+    parseChemicalFormula(formula, terms, 1.0);
 
     // Get the charge of the formula
-    auto charge = parseCharge(formula);
+    const auto charge = parseCharge(formula);
 
     // Check if the formula contains charge
-    if(charge)
-        result.insert({"Z", charge});
+    if(charge && !contains(terms, "Z"))
+        terms.add("Z", charge);
+}
+
+} // namespace
+
+auto FormulaTerms::find(std::string_view symbol) const -> std::size_t
+{
+    std::size_t i = 0;
+    while(i < size && symbols[i] != symbol)
+        ++i;
+    return i;
+}
+
+auto FormulaTerms::add(std::string_view symbol, double coefficient) -> void
+{
+    const auto i = find(symbol);
+    if(i < size)
+    {
+        coefficients[i] += coefficient;
+        return;
+    }
+    error(size == capacity, "Could not parse a chemical formula with more than ", capacity, " distinct elements.");
+    symbols[size] = symbol;
+    coefficients[size] = coefficient;
+    ++size;
+}
+
+auto parseChemicalFormula(std::string_view formula, FormulaTerms& terms) -> void
+{
+    terms.size = 0;
+    parseTerms(formula, terms);
+}
+
+auto parseChemicalFormula(const std::string& formula) -> std::unordered_map<std::string, double>
+{
+    UnboundedTerms terms;
+    parseTerms(formula, terms);
+
+    if(!terms.overflow.empty())
+        return std::move(terms.overflow);
 
+    unordered_map<string, double> result;
+    result.reserve(terms.terms.size);
+    for(std::size_t i = 0; i < terms.terms.size; ++i)
+        result.emplace(terms.terms.symbols[i], terms.terms.coefficients[i]);
     return result;
 }
 
@@ -18,7 +18,9 @@
 #pragma once
 
 // C++ includes
+#include <array>
 #include <string>
+#include <string_view>
 #include <unordered_map>
 
 namespace Atomik {
@@ -47,6 +49,39 @@ namespace Atomik {
 /// auto formula10 = parseChemicalFormula("CO3--");
 /// auto formula11 = parseChemicalFormula("CO3-2");
 /// ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~
+/// The formula is parsed into a FormulaTerms object, whose terms are then copied into the returned map.
+/// A formula with more than `FormulaTerms::capacity` distinct symbols is parsed into the map directly.
 auto parseChemicalFormula(const std::string& formula) -> std::unordered_map<std::string, double>;
 
+/// A type used to store the element symbols and their coefficients in a chemical formula without heap allocation.
+/// The symbols are views into the parsed formula, which must outlive this object.
+/// The electric charge, if any, is stored as the coefficient of the symbol `Z`.
+struct FormulaTerms
+{
+    /// The maximum number of distinct symbols in a formula.
+    static constexpr std::size_t capacity = 32;
+
+    /// The distinct element symbols in the formula, in order of first appearance.
+    std::array<std::string_view, capacity> symbols;
+
+    /// The coefficients of the element symbols in the formula.
+    std::array<double, capacity> coefficients;
+
+    /// The number of distinct element symbols in the formula.
+    std::size_t size = 0;
+
+    /// Return the index of a given symbol, or `size` if not present.
+    auto find(std::string_view symbol) const -> std::size_t;
+
+    /// Add a coefficient to a given symbol, appending the symbol if not present.
+    /// @throw std::runtime_error When more than `capacity` distinct symbols are added.
+    auto add(std::string_view symbol, double coefficient) -> void;
+};
+
+/// Parse a chemical formula into a given FormulaTerms object without heap allocation.
+/// The rules are those of @ref parseChemicalFormula(const std::string&), but the
+/// symbols are stored as views into `formula` in order of first appearance.
+/// The contents of `terms` are overwritten.
+auto parseChemicalFormula(std::string_view formula, FormulaTerms& terms) -> void;
+
 } // namespace Atomik
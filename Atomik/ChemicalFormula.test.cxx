@@ -0,0 +1,85 @@
+// Atomik is a library that implements basic chemical concepts such as elements, substances, and reactions.
+//
+// Copyright (C) 2018-2019 Allan Leal and Reaktoro Contributors
+//
+// This library is free software; you can redistribute it and/or
+// modify it under the terms of the GNU Lesser General Public
+// License as published by the Free Software Foundation; either
+// version 2.1 of the License, or (at your option) any later version.
+//
+// This library is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+// Lesser General Public License for more details.
+//
+// You should have received a copy of the GNU Lesser General Public License
+// along with this library. If not, see <http://www.gnu.org/licenses/>.
+
+// Catch includes
+#include <catch2/catch.hpp>
+
+// Atomik includes
+#include <Atomik/ChemicalFormula.hpp>
+using namespace Atomik;
+
+TEST_CASE("Testing non-allocating parsing of chemical formulas", "[ChemicalFormula]")
+{
+    FormulaTerms terms;
+
+    const std::string formulas[] = {
+        "H2O", "CaCO3", "HCO3-", "Fe+++", "Fe+3", "Fe(+3)", "Na+", "CO3--", "CO3-2",
+        "(CaMg)(CO3)2", "Fe3Al2Si3O12", "CaSO4.2H2O", "Na2SO4.10H2O", "Mg(NO3)2(aq)", "H2.5O1.25",
+        "(NH4)2Fe(SO4)2.6H2O", "Ca(HCO3)+", "Al(OH)4-", "KAl3Si3O10(OH)2", "(CH3)3N", "e-", "",
+    };
+
+    for(const auto& formula : formulas)
+    {
+        parseChemicalFormula(formula, terms);
+        const auto expected = parseChemicalFormula(formula);
+        REQUIRE(terms.size == expected.size());
+        for(auto i = 0u; i < terms.size; ++i)
+        {
+            const auto symbol = std::string(terms.symbols[i]);
+            REQUIRE(expected.count(symbol));
+            REQUIRE(terms.coefficients[i] == Approx(expected.at(symbol)));
+        }
+    }
+
+    // Test the symbols are views into the formula, in order of first appearance
+    const std::string formula = "CaMg(CO3)2";
+    parseChemicalFormula(formula, terms);
+    REQUIRE(terms.size == 4);
+    REQUIRE(terms.symbols[0] == "Ca");
+    REQUIRE(terms.symbols[1] == "Mg");
+    REQUIRE(terms.symbols[2] == "C");
+    REQUIRE(terms.symbols[3] == "O");
+    REQUIRE(terms.symbols[0].data() == formula.data());
+    REQUIRE(terms.coefficients[3] == 6);
+
+    // Test the hydrates written by the database generator, with the water grouped as (H2O)n
+    const auto hydrate = parseChemicalFormula("FeF2(H2O)6");
+    REQUIRE(hydrate.size() == 4);
+    REQUIRE(hydrate.at("Fe") == 1);
+    REQUIRE(hydrate.at("F") == 2);
+    REQUIRE(hydrate.at("H") == 12);
+    REQUIRE(hydrate.at("O") == 6);
+    const auto salt = parseChemicalFormula("Na2SO4(H2O)10");
+    REQUIRE(salt.at("S") == 1);
+    REQUIRE(salt.at("O") == 14);
+    REQUIRE(salt.at("H") == 20);
+
+    // Test formulas with too many distinct elements are rejected
+    std::string large;
+    for(char c = 'A'; c <= 'Z'; ++c)
+        large += std::string(1, c) + "a" + std::string(1, c) + "b";
+    REQUIRE_THROWS(parseChemicalFormula(large, terms));
+
+    // Test such formulas are still parsed into maps
+    const auto elements = parseChemicalFormula(large + "2(AaZz)3+");
+    REQUIRE(elements.size() == 26 * 2 + 2);
+    REQUIRE(elements.at("Ab") == 1);
+    REQUIRE(elements.at("Zb") == 2);
+    REQUIRE(elements.at("Aa") == 4);
+    REQUIRE(elements.at("Zz") == 3);
+    REQUIRE(elements.at("Z") == 1);
+}
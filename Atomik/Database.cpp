@@ -0,0 +1,313 @@
+// Atomik is a library that implements basic chemical concepts such as elements, substances, and reactions.
+//
+// Copyright (C) 2018-2019 Allan Leal and Reaktoro Contributors
+//
+// This library is free software; you can redistribute it and/or
+// modify it under the terms of the GNU Lesser General Public
+// License as published by the Free Software Foundation; either
+// version 2.1 of the License, or (at your option) any later version.
+//
+// This library is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+// Lesser General Public License for more details.
+//
+// You should have received a copy of the GNU Lesser General Public License
+// along with this library. If not, see <http://www.gnu.org/licenses/>.
+
+#include "Database.hpp"
+
+// C++ includes
+#include <algorithm>
+#include <unordered_set>
+
+// Atomik includes
+#include <Atomik/Algorithms.hpp>
+#include <Atomik/DatabaseDelta.hpp>
+#include <Atomik/Exception.hpp>
+#include <Atomik/StringList.hpp>
+#include <Atomik/Tracing.hpp>
+
+namespace Atomik {
+namespace {
+
+/// The empty list of substance handles returned for unknown tags.
+const std::vector<SubstanceId> noSubstances;
+
+} // namespace
+
+Database::Database()
+{}
+
+Database::Database(Elements elements, Substances substances)
+: m_elements(std::move(elements)), m_substances(std::move(substances))
+{
+    ATOMIK_TRACE("build Database indices");
+    error(m_elements.size() > UINT32_MAX || m_substances.size() > UINT32_MAX,
+        "Database objects cannot have more than ", UINT32_MAX, " elements or substances.");
+
+    m_elementsBySymbol.reserve(m_elements.size());
+    for(auto i = 0u; i < m_elements.size(); ++i)
+        m_elementsBySymbol.emplace(m_elements[i].symbol(), ElementId{i});
+
+    m_substancesByName.reserve(m_substances.size());
+    m_substanceElements.reserve(m_substances.size());
+    for(auto i = 0u; i < m_substances.size(); ++i)
+    {
+        const auto& substance = m_substances[i];
+        const auto id = SubstanceId{i};
+
+        m_substancesByName.emplace(substance.name(), id);
+
+        for(const auto& tag : substance.tags())
+            m_substancesByTag[tag].push_back(id);
+
+        m_substanceElements.push_back(elementIds(substance));
+    }
+}
+
+auto Database::elements() const -> const Elements&
+{
+    return m_elements;
+}
+
+auto Database::substances() const -> const Substances&
+{
+    return m_substances;
+}
+
+auto Database::element(ElementId id) const -> const Element&
+{
+    return m_elements[id.value];
+}
+
+auto Database::substance(SubstanceId id) const -> const Substance&
+{
+    return m_substances[id.value];
+}
+
+auto Database::hasElement(std::string_view symbol) const -> bool
+{
+    return m_elementsBySymbol.count(InternedString::find(symbol));
+}
+
+auto Database::hasSubstance(std::string_view name) const -> bool
+{
+    return m_substancesByName.count(InternedString::find(name));
+}
+
+auto Database::elementWithSymbol(std::string_view symbol) const -> ElementId
+{
+    const auto iter = m_elementsBySymbol.find(InternedString::find(symbol));
+    error(iter == m_elementsBySymbol.end(), "Could not find an element with the given symbol `", symbol, "`.");
+    return iter->second;
+}
+
+auto Database::substanceWithName(std::string_view name) const -> SubstanceId
+{
+    const auto iter = m_substancesByName.find(InternedString::find(name));
+    error(iter == m_substancesByName.end(), "Could not find a substance with the given name `", name, "`.");
+    return iter->second;
+}
+
+auto Database::substanceIds() const -> std::vector<SubstanceId>
+{
+    std::vector<SubstanceId> ids(m_substances.size());
+    for(auto i = 0u; i < ids.size(); ++i)
+        ids[i] = SubstanceId{i};
+    return ids;
+}
+
+auto Database::substancesWithTag(std::string_view tag) const -> const std::vector<SubstanceId>&
+{
+    const auto iter = m_substancesByTag.find(InternedString::find(tag));
+    return iter != m_substancesByTag.end() ? iter->second : noSubstances;
+}
+
+auto Database::substancesWithTags(const StringList& tags) const -> std::vector<SubstanceId>
+{
+    ATOMIK_TRACE("Database::substancesWithTags");
+    if(tags.size() == 0)
+        return substanceIds();
+    std::vector<SubstanceId> res;
+    for(auto id : substancesWithTag(tags[0]))
+        if(contained(tags, substance(id).tags()))
+            res.push_back(id);
+    return res;
+}
+
+auto Database::substancesWithElements(const StringList& symbols) const -> std::vector<SubstanceId>
+{
+    ATOMIK_TRACE("Database::substancesWithElements");
+    std::vector<char> allowed(m_elements.size(), false);
+    for(const auto& symbol : symbols)
+    {
+        const auto iter = m_elementsBySymbol.find(InternedString::find(symbol));
+        if(iter != m_elementsBySymbol.end())
+            allowed[iter->second.value] = true;
+    }
+
+    std::vector<SubstanceId> res;
+    for(auto i = 0u; i < m_substanceElements.size(); ++i)
+        if(std::all_of(m_substanceElements[i].begin(), m_substanceElements[i].end(), [&](auto id) { return allowed[id.value]; }))
+            res.push_back(SubstanceId{i});
+    return res;
+}
+
+auto Database::elementsOf(SubstanceId id) const -> const std::vector<ElementId>&
+{
+    return m_substanceElements[id.value];
+}
+
+auto Database::apply(const DatabaseDelta& delta) -> void
+{
+    const std::unordered_set<std::string_view> removedElements(delta.removedElements.begin(), delta.removedElements.end());
+    const std::unordered_set<std::string_view> removedSubstances(delta.removedSubstances.begin(), delta.removedSubstances.end());
+    std::unordered_set<std::string_view> changedElements, changedSubstances;
+    for(const auto& element : delta.elements)
+        changedElements.insert(element.symbol().view());
+    for(const auto& substance : delta.substances)
+        changedSubstances.insert(substance.name().view());
+
+    delta.validate();
+    for(const auto& symbol : delta.removedElements)
+        error(!hasElement(symbol), "Could not apply a delta removing element `", symbol, "`, which is not in the database.");
+    for(const auto& name : delta.removedSubstances)
+        error(!hasSubstance(name), "Could not apply a delta removing substance `", name, "`, which is not in the database.");
+
+    const auto available = [&](std::string_view symbol)
+    {
+        return changedElements.count(symbol) || (hasElement(symbol) && !removedElements.count(symbol));
+    };
+    for(const auto& substance : delta.substances)
+        for(const auto& symbol : substance.elements().symbols())
+            error(!available(symbol.view()), "Could not apply a delta with substance `", substance.name(), "` because its element `", symbol, "` is not in the database.");
+    if(!removedElements.empty())
+        for(auto i = 0u; i < m_substances.size(); ++i)
+        {
+            const auto& name = m_substances[i].name().view();
+            if(removedSubstances.count(name) || changedSubstances.count(name))
+                continue;
+            for(auto id : m_substanceElements[i])
+                error(removedElements.count(element(id).symbol().view()), "Could not apply a delta removing element `",
+                    element(id).symbol(), "`, which composes substance `", name, "`.");
+        }
+    error(m_elements.size() + delta.elements.size() > UINT32_MAX || m_substances.size() + delta.substances.size() > UINT32_MAX,
+        "Database objects cannot have more than ", UINT32_MAX, " elements or substances.");
+
+    for(const auto& element : delta.elements)
+        upsertElement(element);
+    for(const auto& name : delta.removedSubstances)
+        eraseSubstance(substanceWithName(name));
+    for(const auto& substance : delta.substances)
+        upsertSubstance(substance);
+    for(const auto& symbol : delta.removedElements)
+        eraseElement(elementWithSymbol(symbol));
+}
+
+auto Database::elementIds(const Substance& substance) const -> std::vector<ElementId>
+{
+    std::vector<ElementId> ids;
+    ids.reserve(substance.elements().symbols().size());
+    for(const auto& symbol : substance.elements().symbols())
+    {
+        const auto iter = m_elementsBySymbol.find(symbol);
+        error(iter == m_elementsBySymbol.end(), "Could not create a database with substance `",
+            substance.name(), "` because its element `", symbol, "` is not in the database.");
+        ids.push_back(iter->second);
+    }
+    return ids;
+}
+
+auto Database::indexTags(SubstanceId id) -> void
+{
+    for(const auto& tag : substance(id).tags())
+    {
+        auto& ids = m_substancesByTag[tag];
+        ids.insert(std::lower_bound(ids.begin(), ids.end(), id), id);
+    }
+}
+
+auto Database::unindexTags(SubstanceId id) -> void
+{
+    for(const auto& tag : substance(id).tags())
+    {
+        const auto iter = m_substancesByTag.find(tag);
+        if(iter == m_substancesByTag.end())
+            continue;
+        auto& ids = iter->second;
+        const auto pos = std::lower_bound(ids.begin(), ids.end(), id);
+        if(pos != ids.end() && *pos == id)
+            ids.erase(pos);
+        if(ids.empty())
+            m_substancesByTag.erase(iter);
+    }
+}
+
+auto Database::upsertElement(const Element& element) -> void
+{
+    const auto iter = m_elementsBySymbol.find(element.symbol());
+    if(iter != m_elementsBySymbol.end())
+        m_elements.m_elements[iter->second.value] = element;
+    else
+    {
+        m_elementsBySymbol.emplace(element.symbol(), ElementId{std::uint32_t(m_elements.size())});
+        m_elements.m_elements.push_back(element);
+    }
+}
+
+auto Database::upsertSubstance(const Substance& substance) -> void
+{
+    const auto iter = m_substancesByName.find(substance.name());
+    if(iter != m_substancesByName.end())
+    {
+        const auto id = iter->second;
+        unindexTags(id);
+        m_substances.m_substances[id.value] = substance;
+        m_substanceElements[id.value] = elementIds(substance);
+        indexTags(id);
+    }
+    else
+    {
+        const auto id = SubstanceId{std::uint32_t(m_substances.size())};
+        m_substancesByName.emplace(substance.name(), id);
+        m_substances.m_substances.push_back(substance);
+        m_substanceElements.push_back(elementIds(substance));
+        indexTags(id);
+    }
+}
+
+auto Database::eraseElement(ElementId id) -> void
+{
+    const auto last = ElementId{std::uint32_t(m_elements.size() - 1)};
+    m_elementsBySymbol.erase(element(id).symbol());
+    if(id != last)
+    {
+        auto& elements = m_elements.m_elements;
+        elements[id.value] = std::move(elements[last.value]);
+        m_elementsBySymbol[elements[id.value].symbol()] = id;
+        for(auto& ids : m_substanceElements)
+            std::replace(ids.begin(), ids.end(), last, id);
+    }
+    m_elements.m_elements.pop_back();
+}
+
+auto Database::eraseSubstance(SubstanceId id) -> void
+{
+    const auto last = SubstanceId{std::uint32_t(m_substances.size() - 1)};
+    unindexTags(id);
+    m_substancesByName.erase(substance(id).name());
+    if(id != last)
+    {
+        unindexTags(last);
+        auto& substances = m_substances.m_substances;
+        substances[id.value] = std::move(substances[last.value]);
+        m_substanceElements[id.value] = std::move(m_substanceElements[last.value]);
+        m_substancesByName[substances[id.value].name()] = id;
+        indexTags(id);
+    }
+    m_substances.m_substances.pop_back();
+    m_substanceElements.pop_back();
+}
+
+} // namespace Atomik
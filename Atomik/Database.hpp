@@ -0,0 +1,205 @@
+// Atomik is a library that implements basic chemical concepts such as elements, substances, and reactions.
+//
+// Copyright (C) 2018-2019 Allan Leal and Reaktoro Contributors
+//
+// This library is free software; you can redistribute it and/or
+// modify it under the terms of the GNU Lesser General Public
+// License as published by the Free Software Foundation; either
+// version 2.1 of the License, or (at your option) any later version.
+//
+// This library is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+// Lesser General Public License for more details.
+//
+// You should have received a copy of the GNU Lesser General Public License
+// along with this library. If not, see <http://www.gnu.org/licenses/>.
+
+#pragma once
+
+// C++ includes
+#include <cstdint>
+#include <functional>
+#include <string>
+#include <string_view>
+#include <unordered_map>
+#include <vector>
+
+// Atomik includes
+#include <Atomik/Elements.hpp>
+#include <Atomik/InternedString.hpp>
+#include <Atomik/Substances.hpp>
+
+namespace Atomik {
+
+// Forward declarations
+class StringList;
+struct DatabaseDelta;
+
+/// A lightweight handle to an element in a Database object.
+/// Objects of this type are trivially copyable and can be exchanged between threads
+/// without touching the reference counts of Element objects.
+struct ElementId
+{
+    /// The index of the element in the database.
+    std::uint32_t value;
+};
+
+/// A lightweight handle to a substance in a Database object.
+/// Objects of this type are trivially copyable and can be exchanged between threads
+/// without touching the reference counts of Substance objects.
+struct SubstanceId
+{
+    /// The index of the substance in the database.
+    std::uint32_t value;
+};
+
+/// Compare two ElementId objects for equality.
+inline auto operator==(ElementId lhs, ElementId rhs) -> bool { return lhs.value == rhs.value; }
+
+/// Compare two ElementId objects for inequality.
+inline auto operator!=(ElementId lhs, ElementId rhs) -> bool { return lhs.value != rhs.value; }
+
+/// Compare two ElementId objects for less than.
+inline auto operator<(ElementId lhs, ElementId rhs) -> bool { return lhs.value < rhs.value; }
+
+/// Compare two SubstanceId objects for equality.
+inline auto operator==(SubstanceId lhs, SubstanceId rhs) -> bool { return lhs.value == rhs.value; }
+
+/// Compare two SubstanceId objects for inequality.
+inline auto operator!=(SubstanceId lhs, SubstanceId rhs) -> bool { return lhs.value != rhs.value; }
+
+/// Compare two SubstanceId objects for less than.
+inline auto operator<(SubstanceId lhs, SubstanceId rhs) -> bool { return lhs.value < rhs.value; }
+
+/// A type used as an immutable database of chemical elements and substances.
+/// A Database object is not modified after construction (except by `apply`), so it can be read concurrently
+/// from many threads. Its queries return ElementId and SubstanceId handles, which are
+/// resolved to Element and Substance objects by reference only when needed:
+/// ~~~
+/// using namespace Atomik;
+/// const Database db(Elements::PeriodicTable(), substances);
+/// // in any thread ...
+/// for(SubstanceId id : db.substancesWithTag("aqueous"))
+///     total += db.substance(id).molarMass();
+/// ~~~
+/// The handles are valid only for the Database object that created them.
+class Database
+{
+public:
+    /// Construct a default Database object.
+    Database();
+
+    /// Construct a Database object with given elements and substances.
+    Database(Elements elements, Substances substances);
+
+    /// Return the chemical elements in the database.
+    auto elements() const -> const Elements&;
+
+    /// Return the chemical substances in the database.
+    auto substances() const -> const Substances&;
+
+    /// Return the element with given handle.
+    auto element(ElementId id) const -> const Element&;
+
+    /// Return the substance with given handle.
+    auto substance(SubstanceId id) const -> const Substance&;
+
+    /// Return true if the database has an element with given symbol.
+    auto hasElement(std::string_view symbol) const -> bool;
+
+    /// Return true if the database has a substance with given name.
+    auto hasSubstance(std::string_view name) const -> bool;
+
+    /// Return the handle of the element with given symbol.
+    /// @throw std::runtime_error When there is no element with given symbol.
+    auto elementWithSymbol(std::string_view symbol) const -> ElementId;
+
+    /// Return the handle of the substance with given name.
+    /// @throw std::runtime_error When there is no substance with given name.
+    auto substanceWithName(std::string_view name) const -> SubstanceId;
+
+    /// Return the handles of all substances in the database.
+    auto substanceIds() const -> std::vector<SubstanceId>;
+
+    /// Return the handles of the substances with a given tag.
+    auto substancesWithTag(std::string_view tag) const -> const std::vector<SubstanceId>&;
+
+    /// Return the handles of the substances with given tags.
+    auto substancesWithTags(const StringList& tags) const -> std::vector<SubstanceId>;
+
+    /// Return the handles of the substances composed only of given elements.
+    auto substancesWithElements(const StringList& symbols) const -> std::vector<SubstanceId>;
+
+    /// Return the handles of the elements composing the substance with given handle.
+    auto elementsOf(SubstanceId id) const -> const std::vector<ElementId>&;
+
+    /// Apply the changes of a delta to this database, updating its indexes incrementally.
+    /// Elements and substances are replaced in place when their symbol or name exists, and appended otherwise.
+    /// A removed record is replaced by the last one, whose handle changes accordingly; removing an element
+    /// also takes time proportional to the number of substances. The delta is validated before any change.
+    /// This method must not be called while other threads read the database (see `VersionedDatabase::apply`).
+    /// @throw std::runtime_error When the delta is inconsistent (see `DatabaseDelta::validate`), a removed record
+    /// does not exist, or a remaining substance is composed of an element missing from the database.
+    auto apply(const DatabaseDelta& delta) -> void;
+
+private:
+    /// The chemical elements in the database.
+    Elements m_elements;
+
+    /// The chemical substances in the database.
+    Substances m_substances;
+
+    /// The index of the elements by symbol.
+    std::unordered_map<InternedString, ElementId> m_elementsBySymbol;
+
+    /// The index of the substances by name.
+    std::unordered_map<InternedString, SubstanceId> m_substancesByName;
+
+    /// The index of the substances by tag.
+    std::unordered_map<InternedString, std::vector<SubstanceId>> m_substancesByTag;
+
+    /// The elements composing each substance.
+    std::vector<std::vector<ElementId>> m_substanceElements;
+
+    /// Return the handles of the elements composing a substance.
+    auto elementIds(const Substance& substance) const -> std::vector<ElementId>;
+
+    /// Add a substance to the index of substances by tag.
+    auto indexTags(SubstanceId id) -> void;
+
+    /// Remove a substance from the index of substances by tag.
+    auto unindexTags(SubstanceId id) -> void;
+
+    /// Add an element or replace the one with the same symbol.
+    auto upsertElement(const Element& element) -> void;
+
+    /// Add a substance or replace the one with the same name.
+    auto upsertSubstance(const Substance& substance) -> void;
+
+    /// Remove an element, moving the last element into its position.
+    auto eraseElement(ElementId id) -> void;
+
+    /// Remove a substance, moving the last substance into its position.
+    auto eraseSubstance(SubstanceId id) -> void;
+};
+
+} // namespace Atomik
+
+namespace std {
+
+/// Specialize std::hash for ElementId so it can be used in unordered containers.
+template <>
+struct hash<Atomik::ElementId>
+{
+    auto operator()(Atomik::ElementId id) const noexcept { return std::hash<std::uint32_t>()(id.value); }
+};
+
+/// Specialize std::hash for SubstanceId so it can be used in unordered containers.
+template <>
+struct hash<Atomik::SubstanceId>
+{
+    auto operator()(Atomik::SubstanceId id) const noexcept { return std::hash<std::uint32_t>()(id.value); }
+};
+
+} // namespace std
@@ -0,0 +1,93 @@
+// Atomik is a library that implements basic chemical concepts such as elements, substances, and reactions.
+//
+// Copyright (C) 2018-2019 Allan Leal and Reaktoro Contributors
+//
+// This library is free software; you can redistribute it and/or
+// modify it under the terms of the GNU Lesser General Public
+// License as published by the Free Software Foundation; either
+// version 2.1 of the License, or (at your option) any later version.
+//
+// This library is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+// Lesser General Public License for more details.
+//
+// You should have received a copy of the GNU Lesser General Public License
+// along with this library. If not, see <http://www.gnu.org/licenses/>.
+
+// Catch includes
+#include <catch2/catch.hpp>
+
+// C++ includes
+#include <thread>
+#include <type_traits>
+
+// Atomik includes
+#include <Atomik/Database.hpp>
+#include <Atomik/StringList.hpp>
+using namespace Atomik;
+
+TEST_CASE("Testing Database", "[Database]")
+{
+    REQUIRE(std::is_trivially_copyable_v<ElementId>);
+    REQUIRE(std::is_trivially_copyable_v<SubstanceId>);
+
+    Substances substances({
+        Substance("H2O").replaceName("H2O(aq)").replaceTags({"aqueous", "neutral"}),
+        Substance("H+").replaceName("H+(aq)").replaceTags({"aqueous", "charged"}),
+        Substance("OH-").replaceName("OH-(aq)").replaceTags({"aqueous", "charged"}),
+        Substance("CO2").replaceName("CO2(g)").replaceTags({"gaseous", "neutral"}),
+        Substance("CaCO3").replaceName("Calcite").replaceTags({"mineral"}),
+    });
+
+    const Database db(Elements::PeriodicTable(), substances);
+
+    REQUIRE(db.elements().size() == 119);
+    REQUIRE(db.substances().size() == 5);
+
+    // Test the lookup methods
+    REQUIRE(db.hasElement("Ca"));
+    REQUIRE_FALSE(db.hasElement("Xy"));
+    REQUIRE(db.element(db.elementWithSymbol("Ca")).name() == "Calcium");
+    REQUIRE_THROWS(db.elementWithSymbol("Xy"));
+
+    REQUIRE(db.hasSubstance("Calcite"));
+    REQUIRE_FALSE(db.hasSubstance("Aragonite"));
+    REQUIRE(db.substanceWithName("CO2(g)") == SubstanceId{3});
+    REQUIRE(db.substance(SubstanceId{3}).name() == "CO2(g)");
+    REQUIRE_THROWS(db.substanceWithName("Aragonite"));
+
+    // Test the filtering methods
+    REQUIRE(db.substancesWithTag("aqueous") == std::vector<SubstanceId>{{0}, {1}, {2}});
+    REQUIRE(db.substancesWithTag("unknown").empty());
+    REQUIRE(db.substancesWithTags("aqueous charged") == std::vector<SubstanceId>{{1}, {2}});
+    REQUIRE(db.substancesWithTags("neutral") == std::vector<SubstanceId>{{0}, {3}});
+    REQUIRE(db.substancesWithElements("H O") == std::vector<SubstanceId>{{0}});
+    REQUIRE(db.substancesWithElements("H O Z") == std::vector<SubstanceId>{{0}, {1}, {2}});
+    REQUIRE(db.substancesWithElements("C O Ca") == std::vector<SubstanceId>{{3}, {4}});
+
+    // Test the elements composing a substance
+    const auto& ids = db.elementsOf(db.substanceWithName("Calcite"));
+    REQUIRE(ids.size() == 3);
+    for(auto id : ids)
+        REQUIRE(db.substance(SubstanceId{4}).formula().coefficient(db.element(id).symbol()) > 0);
+
+    // Test a database cannot have substances with elements it does not contain
+    REQUIRE_THROWS(Database(Elements::PeriodicTable().withSymbols("H O"), substances));
+
+    // Test concurrent readers exchanging handles
+    std::vector<double> totals(4, 0.0);
+    std::vector<std::thread> threads;
+    for(auto i = 0u; i < totals.size(); ++i)
+        threads.emplace_back([&, i] {
+            for(auto k = 0; k < 1000; ++k)
+                for(auto id : db.substancesWithTag("aqueous"))
+                    totals[i] += db.substance(id).molarMass();
+        });
+    for(auto& thread : threads)
+        thread.join();
+
+    const auto expected = 1000 * (substances[0].molarMass() + substances[1].molarMass() + substances[2].molarMass());
+    for(auto total : totals)
+        REQUIRE(total == Approx(expected));
+}
@@ -0,0 +1,105 @@
+// Atomik is a library that implements basic chemical concepts such as elements, substances, and reactions.
+//
+// Copyright (C) 2018-2019 Allan Leal and Reaktoro Contributors
+//
+// This library is free software; you can redistribute it and/or
+// modify it under the terms of the GNU Lesser General Public
+// License as published by the Free Software Foundation; either
+// version 2.1 of the License, or (at your option) any later version.
+//
+// This library is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+// Lesser General Public License for more details.
+//
+// You should have received a copy of the GNU Lesser General Public License
+// along with this library. If not, see <http://www.gnu.org/licenses/>.
+
+#include "DatabaseDelta.hpp"
+
+// C++ includes
+#include <unordered_set>
+
+// Atomik includes
+#include <Atomik/Exception.hpp>
+
+namespace Atomik {
+
+auto DatabaseDelta::empty() const -> bool
+{
+    return elements.size() == 0 && removedElements.empty() && substances.size() == 0 && removedSubstances.empty();
+}
+
+auto DatabaseDelta::validate() const -> void
+{
+    std::unordered_set<std::string_view> changedSymbols, changedNames, removedSymbols, removedNames;
+    for(const auto& element : elements)
+        error(!changedSymbols.insert(element.symbol().view()).second, "Could not apply a delta changing element `", element.symbol(), "` more than once.");
+    for(const auto& substance : substances)
+        error(!changedNames.insert(substance.name().view()).second, "Could not apply a delta changing substance `", substance.name(), "` more than once.");
+    for(const auto& symbol : removedElements)
+        error(!removedSymbols.insert(symbol).second || changedSymbols.count(symbol), "Could not apply a delta removing element `", symbol, "` more than once or also changing it.");
+    for(const auto& name : removedSubstances)
+        error(!removedNames.insert(name).second || changedNames.count(name), "Could not apply a delta removing substance `", name, "` more than once or also changing it.");
+}
+
+DatabaseHashes::DatabaseHashes()
+{}
+
+DatabaseHashes::DatabaseHashes(const Database& db)
+: m_elements(db.elements()), m_substances(db.substances())
+{}
+
+auto DatabaseHashes::apply(const DatabaseDelta& delta) -> void
+{
+    delta.validate();
+    for(const auto& symbol : delta.removedElements)
+        error(!m_elements.find(symbol), "Could not apply a delta removing element `", symbol, "`, which is not hashed.");
+    for(const auto& name : delta.removedSubstances)
+        error(!m_substances.find(name), "Could not apply a delta removing substance `", name, "`, which is not hashed.");
+
+    for(const auto& element : delta.elements)
+        m_elements.insert(element.symbol().view(), contentHash(element));
+    for(const auto& name : delta.removedSubstances)
+        m_substances.erase(name);
+    for(const auto& substance : delta.substances)
+        m_substances.insert(substance.name().view(), contentHash(substance));
+    for(const auto& symbol : delta.removedElements)
+        m_elements.erase(symbol);
+}
+
+auto DatabaseHashes::elements() const -> const MerkleTree&
+{
+    return m_elements;
+}
+
+auto DatabaseHashes::substances() const -> const MerkleTree&
+{
+    return m_substances;
+}
+
+auto makeDelta(const Database& to, const DatabaseHashes& fromHashes, const DatabaseHashes& toHashes) -> DatabaseDelta
+{
+    DatabaseDelta delta;
+
+    const auto elementChanges = diff(fromHashes.elements(), toHashes.elements());
+    for(const auto* symbols : { &elementChanges.added, &elementChanges.modified })
+        for(const auto& symbol : *symbols)
+            delta.elements.append(to.element(to.elementWithSymbol(symbol)));
+    delta.removedElements = elementChanges.removed;
+
+    const auto substanceChanges = diff(fromHashes.substances(), toHashes.substances());
+    for(const auto* names : { &substanceChanges.added, &substanceChanges.modified })
+        for(const auto& name : *names)
+            delta.substances.append(to.substance(to.substanceWithName(name)));
+    delta.removedSubstances = substanceChanges.removed;
+
+    return delta;
+}
+
+auto makeDelta(const Database& from, const Database& to) -> DatabaseDelta
+{
+    return makeDelta(to, DatabaseHashes(from), DatabaseHashes(to));
+}
+
+} // namespace Atomik
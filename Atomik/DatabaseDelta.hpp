@@ -0,0 +1,94 @@
+// Atomik is a library that implements basic chemical concepts such as elements, substances, and reactions.
+//
+// Copyright (C) 2018-2019 Allan Leal and Reaktoro Contributors
+//
+// This library is free software; you can redistribute it and/or
+// modify it under the terms of the GNU Lesser General Public
+// License as published by the Free Software Foundation; either
+// version 2.1 of the License, or (at your option) any later version.
+//
+// This library is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+// Lesser General Public License for more details.
+//
+// You should have received a copy of the GNU Lesser General Public License
+// along with this library. If not, see <http://www.gnu.org/licenses/>.
+
+#pragma once
+
+// C++ includes
+#include <string>
+#include <vector>
+
+// Atomik includes
+#include <Atomik/Database.hpp>
+#include <Atomik/MerkleTree.hpp>
+
+namespace Atomik {
+
+/// A type used to describe the changes from one version of a database to another.
+/// A delta is applied in place with `Database::apply` (or published with `VersionedDatabase::apply`),
+/// and it is serialized to YAML and JSON with the operators in Serialization.hpp.
+struct DatabaseDelta
+{
+    /// The elements added to the database or replacing the ones with the same symbol.
+    Elements elements;
+
+    /// The symbols of the elements removed from the database.
+    std::vector<std::string> removedElements;
+
+    /// The substances added to the database or replacing the ones with the same name.
+    Substances substances;
+
+    /// The names of the substances removed from the database.
+    std::vector<std::string> removedSubstances;
+
+    /// Return true if the delta has no changes.
+    auto empty() const -> bool;
+
+    /// Check that the delta is consistent on its own, independently of the database it is applied to.
+    /// @throw std::runtime_error When a symbol or name is changed or removed more than once, or is both changed and removed.
+    auto validate() const -> void;
+};
+
+/// A type used to keep the hierarchical hashes of the elements and substances of a database.
+class DatabaseHashes
+{
+public:
+    /// Construct a default DatabaseHashes object.
+    DatabaseHashes();
+
+    /// Construct a DatabaseHashes object with the hashes of a given database.
+    explicit DatabaseHashes(const Database& db);
+
+    /// Update the hashes with the changes of a delta, in time proportional to the number of changes.
+    /// The delta is validated before any change, as in `Database::apply`.
+    /// @throw std::runtime_error When the delta is inconsistent or removes a record that is not hashed.
+    auto apply(const DatabaseDelta& delta) -> void;
+
+    /// Return the hashes of the elements keyed by symbol.
+    auto elements() const -> const MerkleTree&;
+
+    /// Return the hashes of the substances keyed by name.
+    auto substances() const -> const MerkleTree&;
+
+private:
+    /// The hashes of the elements keyed by symbol.
+    MerkleTree m_elements;
+
+    /// The hashes of the substances keyed by name.
+    MerkleTree m_substances;
+};
+
+/// Return the delta from one version of a database to another, given the hashes of both versions.
+/// The cost grows with the number of changes, not with the size of the databases.
+/// @param to The new version of the database.
+/// @param fromHashes The hashes of the old version of the database.
+/// @param toHashes The hashes of the new version of the database.
+auto makeDelta(const Database& to, const DatabaseHashes& fromHashes, const DatabaseHashes& toHashes) -> DatabaseDelta;
+
+/// Return the delta from one version of a database to another, hashing both versions.
+auto makeDelta(const Database& from, const Database& to) -> DatabaseDelta;
+
+} // namespace Atomik
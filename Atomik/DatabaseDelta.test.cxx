@@ -0,0 +1,212 @@
+// Atomik is a library that implements basic chemical concepts such as elements, substances, and reactions.
+//
+// Copyright (C) 2018-2019 Allan Leal and Reaktoro Contributors
+//
+// This library is free software; you can redistribute it and/or
+// modify it under the terms of the GNU Lesser General Public
+// License as published by the Free Software Foundation; either
+// version 2.1 of the License, or (at your option) any later version.
+//
+// This library is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+// Lesser General Public License for more details.
+//
+// You should have received a copy of the GNU Lesser General Public License
+// along with this library. If not, see <http://www.gnu.org/licenses/>.
+// Catch includes
+#include <catch2/catch.hpp>
+
+// C++ includes
+#include <sstream>
+
+// Atomik includes
+#include <Atomik/DatabaseDelta.hpp>
+#include <Atomik/Serialization.hpp>
+#include <Atomik/VersionedDatabase.hpp>
+using namespace Atomik;
+
+namespace {
+
+/// Check that a database has the same contents and indexes as one built from scratch.
+auto checkIndexes(const Database& db) -> void
+{
+    const Database expected(db.elements(), db.substances());
+    REQUIRE(DatabaseHashes(db).elements().root() == DatabaseHashes(expected).elements().root());
+    REQUIRE(DatabaseHashes(db).substances().root() == DatabaseHashes(expected).substances().root());
+    for(auto i = 0u; i < db.substances().size(); ++i)
+    {
+        const auto& substance = db.substances()[i];
+        REQUIRE(db.substanceWithName(substance.name().view()).value == i);
+        for(const auto& tag : substance.tags())
+            REQUIRE(db.substancesWithTag(tag.view()) == expected.substancesWithTag(tag.view()));
+        const auto& ids = db.elementsOf(SubstanceId{i});
+        REQUIRE(ids.size() == substance.elements().symbols().size());
+        for(auto k = 0u; k < ids.size(); ++k)
+            REQUIRE(db.element(ids[k]).symbol() == substance.elements().symbols()[k]);
+    }
+    for(auto i = 0u; i < db.elements().size(); ++i)
+        REQUIRE(db.elementWithSymbol(db.elements()[i].symbol().view()).value == i);
+}
+
+} // namespace
+
+TEST_CASE("Testing DatabaseDelta", "[DatabaseDelta]")
+{
+    const auto elements = Elements::PeriodicTable();
+
+    const Database before(elements, Substances({
+        Substance("H2O").replaceName("H2O(aq)").replaceTags({"aqueous", "neutral"}),
+        Substance("HCO3-").replaceName("HCO3-(aq)").replaceTags({"aqueous", "charged"}),
+        Substance("CaCO3").replaceName("Calcite").replaceTags({"mineral"}),
+        Substance("CO2").replaceName("CO2(g)").replaceTags({"gaseous"}),
+        Substance("Na+").replaceName("Na+(aq)").replaceTags({"aqueous", "charged"}),
+    }));
+
+    const Database after(elements, Substances({
+        Substance("H2O").replaceName("H2O(aq)").replaceTags({"aqueous", "neutral"}),
+        Substance("HCO3-").replaceName("HCO3-(aq)").replaceTags({"aqueous"}),
+        Substance("Na+").replaceName("Na+(aq)").replaceTags({"aqueous", "charged"}),
+        Substance("CaCO3").replaceName("Aragonite").replaceTags({"mineral"}),
+        Substance("Cl-").replaceName("Cl-(aq)").replaceTags({"aqueous", "charged"}),
+    }));
+
+    SECTION("Testing the creation and application of deltas")
+    {
+        const auto delta = makeDelta(before, after);
+        REQUIRE(delta.elements.size() == 0);
+        REQUIRE(delta.removedElements.empty());
+        REQUIRE(delta.substances.size() == 3);
+        std::vector<std::string> removed = delta.removedSubstances;
+        std::sort(removed.begin(), removed.end());
+        REQUIRE(removed == std::vector<std::string>{"CO2(g)", "Calcite"});
+
+        auto db = before;
+        db.apply(delta);
+        checkIndexes(db);
+        REQUIRE(db.substances().size() == after.substances().size());
+        REQUIRE(makeDelta(db, after).empty());
+        REQUIRE(db.substancesWithTag("gaseous").empty());
+        REQUIRE(db.substancesWithTag("charged").size() == 2);
+
+        DatabaseHashes hashes(before);
+        hashes.apply(delta);
+        REQUIRE(hashes.substances().root() == DatabaseHashes(after).substances().root());
+        REQUIRE(makeDelta(after, hashes, DatabaseHashes(after)).empty());
+
+        // The original database is not affected by the changes in its copy
+        REQUIRE(before.hasSubstance("Calcite"));
+        REQUIRE(makeDelta(before, after).substances.size() == 3);
+    }
+
+    SECTION("Testing element changes")
+    {
+        DatabaseDelta delta;
+        delta.elements.append(elements.getWithSymbol("H").replaceName("Protium"));
+        delta.elements.append(Element({ .symbol = "Xx", .name = "Unknownium", .atomicNumber = 200, .atomicWeight = 0.5, .electronegativity = 0.0, .tags = {} }));
+        delta.removedElements = { "He", "Ne" };
+
+        auto db = before;
+        db.apply(delta);
+        checkIndexes(db);
+        REQUIRE(db.elements().size() == elements.size() - 1);
+        REQUIRE(db.element(db.elementWithSymbol("H")).name() == "Protium");
+        REQUIRE(db.hasElement("Xx"));
+        REQUIRE_FALSE(db.hasElement("He"));
+        REQUIRE_FALSE(db.hasElement("Ne"));
+        REQUIRE(makeDelta(before, db).elements.size() == 2);
+        REQUIRE(makeDelta(before, db).removedElements.size() == 2);
+    }
+
+    SECTION("Testing invalid deltas")
+    {
+        auto db = before;
+        const auto hashes = DatabaseHashes(db);
+
+        DatabaseDelta unknown;
+        unknown.removedSubstances = { "Quartz" };
+        REQUIRE_THROWS(db.apply(unknown));
+
+        DatabaseDelta composing;
+        composing.removedElements = { "Ca" };
+        REQUIRE_THROWS(db.apply(composing));
+        composing.removedSubstances = { "Calcite" };
+        REQUIRE_NOTHROW(db.apply(composing));
+        REQUIRE_FALSE(db.hasElement("Ca"));
+
+        DatabaseDelta missing;
+        missing.substances.append(Substance("CaCl2").replaceName("CaCl2(aq)"));
+        REQUIRE_THROWS(db.apply(missing));
+        checkIndexes(db);
+    }
+
+    SECTION("Testing deltas with duplicate names")
+    {
+        const auto check = [&](const DatabaseDelta& delta)
+        {
+            auto db = before;
+            REQUIRE_THROWS_AS(db.apply(delta), std::runtime_error);
+            REQUIRE(makeDelta(before, db).empty());
+            REQUIRE(db.substances().size() == before.substances().size());
+            REQUIRE(db.elements().size() == before.elements().size());
+            checkIndexes(db);
+
+            DatabaseHashes hashes(before);
+            REQUIRE_THROWS_AS(hashes.apply(delta), std::runtime_error);
+            REQUIRE(hashes.elements().root() == DatabaseHashes(before).elements().root());
+            REQUIRE(hashes.substances().root() == DatabaseHashes(before).substances().root());
+        };
+
+        DatabaseDelta removedSubstances;
+        removedSubstances.removedSubstances = { "CO2(g)", "CO2(g)" };
+        check(removedSubstances);
+
+        DatabaseDelta removedElements;
+        removedElements.removedElements = { "He", "He" };
+        check(removedElements);
+
+        DatabaseDelta changedElements;
+        changedElements.elements.append(elements.getWithSymbol("H").replaceName("Protium"));
+        changedElements.elements.append(elements.getWithSymbol("H").replaceName("Hydrogen"));
+        check(changedElements);
+
+        DatabaseDelta changedSubstances;
+        changedSubstances.substances.append(Substance("CO2").replaceName("CO2(g)").replaceTags({"gaseous"}));
+        changedSubstances.substances.append(Substance("CO2").replaceName("CO2(g)").replaceTags({"gaseous", "acidic"}));
+        changedSubstances.removedSubstances = { "Calcite" };
+        check(changedSubstances);
+
+        DatabaseDelta changedAndRemoved;
+        changedAndRemoved.substances.append(Substance("CO2").replaceName("CO2(g)"));
+        changedAndRemoved.removedSubstances = { "CO2(g)" };
+        check(changedAndRemoved);
+
+        DatabaseHashes hashes(before);
+        DatabaseDelta unknown;
+        unknown.removedSubstances = { "Quartz" };
+        REQUIRE_THROWS_AS(hashes.apply(unknown), std::runtime_error);
+    }
+
+    SECTION("Testing serialized deltas")
+    {
+        const auto delta = makeDelta(before, after);
+
+        YAML::Node node;
+        node << delta;
+        std::stringstream ss;
+        ss << node;
+        auto fromYAML = before;
+        fromYAML.apply(YAML::Load(ss.str()).as<DatabaseDelta>());
+        REQUIRE(makeDelta(fromYAML, after).empty());
+
+        json j = delta;
+        auto fromJSON = before;
+        fromJSON.apply(json::parse(j.dump()).get<DatabaseDelta>());
+        REQUIRE(makeDelta(fromJSON, after).empty());
+
+        VersionedDatabase versioned(before);
+        const auto version = versioned.version();
+        REQUIRE(versioned.apply(delta) == version + 1);
+        REQUIRE(makeDelta(versioned.snapshot().database(), after).empty());
+    }
+}
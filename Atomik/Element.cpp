@@ -19,102 +19,151 @@
 
 // Atomik includes
 #include <Atomik/Algorithms.hpp>
+#include <Atomik/Memory.hpp>
 
 namespace Atomik {
 
 struct Element::Impl
 {
-    /// The attributes of the element.
-    ElementData attributes;
+    /// The symbol of the element (e.g., "H", "O", "C", "Na").
+    InternedString symbol;
+
+    /// The name of the element (e.g., "Hydrogen", "Oxygen").
+    InternedString name;
+
+    /// The atomic number of the element.
+    std::size_t atomicNumber = 0;
+
+    /// The atomic weight (or molar mass) of the element (in unit of kg/mol).
+    double atomicWeight = 0.0;
+
+    /// The electronegativity of the element.
+    double electronegativity = 0.0;
+
+    /// The tags of the element.
+    std::pmr::vector<InternedString> tags{memoryResource()};
 
     /// Construct a default Element::Impl object.
     Impl()
     {}
 
+    /// Construct a copy of an Element::Impl object with its tags allocated from the current memory resource.
+    Impl(const Impl& other)
+    : symbol(other.symbol),
+      name(other.name),
+      atomicNumber(other.atomicNumber),
+      atomicWeight(other.atomicWeight),
+      electronegativity(other.electronegativity),
+      tags(other.tags, memoryResource())
+    {}
+
     /// Construct an Element::Impl object with given attributes.
     Impl(const ElementData& attributes)
-    : attributes(attributes)
+    : symbol(attributes.symbol),
+      name(attributes.name),
+      atomicNumber(attributes.atomicNumber),
+      atomicWeight(attributes.atomicWeight),
+      electronegativity(attributes.electronegativity),
+      tags(intern(attributes.tags))
+    {}
+
+    /// Construct an Element::Impl object by taking ownership of given attributes.
+    Impl(ElementData&& attributes)
+    : symbol(std::move(attributes.symbol)),
+      name(std::move(attributes.name)),
+      atomicNumber(attributes.atomicNumber),
+      atomicWeight(attributes.atomicWeight),
+      electronegativity(attributes.electronegativity),
+      tags(intern(std::move(attributes.tags)))
     {}
 };
 
 Element::Element()
-: pimpl(new Impl())
+: pimpl(allocateShared<Impl>())
 {}
 
 Element::Element(const ElementData& attributes)
- : pimpl(new Impl(attributes))
+ : pimpl(allocateShared<Impl>(attributes))
+{}
+
+Element::Element(ElementData&& attributes)
+ : pimpl(allocateShared<Impl>(std::move(attributes)))
+{}
+
+Element::Element(std::shared_ptr<Impl> pimpl)
+: pimpl(std::move(pimpl))
 {}
 
 auto Element::replaceSymbol(const std::string& symbol) const -> Element
 {
-    auto attributes = pimpl->attributes;
-    attributes.symbol = symbol;
-    return Element(attributes);
+    auto impl = allocateShared<Impl>(*pimpl);
+    impl->symbol = InternedString(symbol);
+    return Element(std::move(impl));
 }
 
 auto Element::replaceName(const std::string& name) const -> Element
 {
-    auto attributes = pimpl->attributes;
-    attributes.name = name;
-    return Element(attributes);
+    auto impl = allocateShared<Impl>(*pimpl);
+    impl->name = InternedString(name);
+    return Element(std::move(impl));
 }
 
 auto Element::replaceAtomicNumber(std::size_t atomicNumber) const -> Element
 {
-    auto attributes = pimpl->attributes;
-    attributes.atomicNumber = atomicNumber;
-    return Element(attributes);
+    auto impl = allocateShared<Impl>(*pimpl);
+    impl->atomicNumber = atomicNumber;
+    return Element(std::move(impl));
 }
 
 auto Element::replaceAtomicWeight(double atomicWeight) const -> Element
 {
-    auto attributes = pimpl->attributes;
-    attributes.atomicWeight = atomicWeight;
-    return Element(attributes);
+    auto impl = allocateShared<Impl>(*pimpl);
+    impl->atomicWeight = atomicWeight;
+    return Element(std::move(impl));
 }
 
 auto Element::replaceElectronegativity(double electronegativity) const -> Element
 {
-    auto attributes = pimpl->attributes;
-    attributes.electronegativity = electronegativity;
-    return Element(attributes);
+    auto impl = allocateShared<Impl>(*pimpl);
+    impl->electronegativity = electronegativity;
+    return Element(std::move(impl));
 }
 
 auto Element::replaceTags(std::vector<std::string> tags) const -> Element
 {
-    auto attributes = pimpl->attributes;
-    attributes.tags = tags;
-    return Element(attributes);
+    auto impl = allocateShared<Impl>(*pimpl);
+    impl->tags = intern(tags);
+    return Element(std::move(impl));
 }
 
-auto Element::symbol() const -> std::string
+auto Element::symbol() const -> InternedString
 {
-    return pimpl->attributes.symbol;
+    return pimpl->symbol;
 }
 
-auto Element::name() const -> std::string
+auto Element::name() const -> InternedString
 {
-    return pimpl->attributes.name;
+    return pimpl->name;
 }
 
 auto Element::atomicNumber() const -> std::size_t
 {
-    return pimpl->attributes.atomicNumber;
+    return pimpl->atomicNumber;
 }
 
 auto Element::atomicWeight() const -> double
 {
-    return pimpl->attributes.atomicWeight;
+    return pimpl->atomicWeight;
 }
 
 auto Element::electronegativity() const -> double
 {
-    return pimpl->attributes.electronegativity;
+    return pimpl->electronegativity;
 }
 
-auto Element::tags() const -> const std::vector<std::string>&
+auto Element::tags() const -> const std::pmr::vector<InternedString>&
 {
-    return pimpl->attributes.tags;
+    return pimpl->tags;
 }
 
 auto Element::molarMass() const -> double
@@ -124,7 +173,7 @@ auto Element::molarMass() const -> double
 
 auto Element::hasTag(const std::string& tag) const -> bool
 {
-    return index(tags(), tag) < tags().size();
+    return contains(tags(), InternedString::find(tag));
 }
 
 auto operator<(const Element& lhs, const Element& rhs) -> bool
@@ -143,4 +192,4 @@ auto operator==(const Element& lhs, const Element& rhs) -> bool
            ;
 }
 
-} // attributes Atomik
+} // namespace Atomik
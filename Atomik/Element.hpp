@@ -19,9 +19,13 @@
 
 // C++ includes
 #include <memory>
+#include <memory_resource>
 #include <string>
 #include <vector>
 
+// Atomik includes
+#include <Atomik/InternedString.hpp>
+
 namespace Atomik {
 
 /// A type used to define attributes of elements.
@@ -56,6 +60,9 @@ public:
     /// Construct an Element object with given attributes.
     Element(const ElementData& attributes);
 
+    /// Construct an Element object by taking ownership of given attributes.
+    Element(ElementData&& attributes);
+
     /// Return a duplicate of this Element object with replaced symbol attribute.
     auto replaceSymbol(const std::string& symbol) const -> Element;
 
@@ -75,10 +82,10 @@ public:
     auto replaceTags(std::vector<std::string> tags) const -> Element;
 
     /// Return the symbol of the element (e.g., "H", "O", "C", "Na").
-    auto symbol() const -> std::string;
+    auto symbol() const -> InternedString;
 
     /// Return the name of the element (e.g., "Hydrogen", "Oxygen").
-    auto name() const -> std::string;
+    auto name() const -> InternedString;
 
     /// Return the atomic number of the element.
     auto atomicNumber() const -> std::size_t;
@@ -90,7 +97,7 @@ public:
     auto electronegativity() const -> double;
 
     /// Return the tags of the element.
-    auto tags() const -> const std::vector<std::string>&;
+    auto tags() const -> const std::pmr::vector<InternedString>&;
 
     /// Return the molar mass of the element (in unit of kg/mol).
     auto molarMass() const -> double;
@@ -101,6 +108,9 @@ public:
 private:
     struct Impl;
 
+    /// Construct an Element object with given internal state.
+    explicit Element(std::shared_ptr<Impl> pimpl);
+
     std::shared_ptr<Impl> pimpl;
 };
 
@@ -59,4 +59,14 @@ TEST_CASE("Testing Element", "[Element]")
     REQUIRE(element.tags().size() == 2);
     REQUIRE(element.hasTag("tag1"));
     REQUIRE(element.hasTag("tag2"));
+
+    // Test Element::Element(ElementData&&) constructor
+    ElementData attributes = { "Ca", "Calcium", 20, 0.040078000, 1.00, {"tag1"} };
+    element = Element(std::move(attributes));
+    REQUIRE(element.symbol() == "Ca");
+    REQUIRE(element.name() == "Calcium");
+    REQUIRE(element.atomicNumber() == 20);
+    REQUIRE(element.atomicWeight() == 0.040078000);
+    REQUIRE(element.electronegativity() == 1.00);
+    REQUIRE(element.hasTag("tag1"));
 }
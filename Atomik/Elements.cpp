@@ -20,6 +20,8 @@
 // Atomik includes
 #include <Atomik/Algorithms.hpp>
 #include <Atomik/Exception.hpp>
+#include <Atomik/Instrumentation.hpp>
+#include <Atomik/Memory.hpp>
 #include <Atomik/StringList.hpp>
 #include <Atomik/WithUtils.hpp>
 
@@ -152,11 +154,31 @@ const std::vector<Element> elements_from_periodic_table =
 
 } // namespace internal
 
+namespace {
+
+/// Return the elements in a collection that satisfy a given predicate.
+template<typename Predicate>
+auto select(const Elements& elements, const Predicate& pred) -> Elements
+{
+    Elements res;
+    for(const auto& element : elements)
+        if(pred(element))
+            res.append(element);
+    return res;
+}
+
+} // namespace
+
 Elements::Elements()
+: m_elements(memoryResource())
 {}
 
 Elements::Elements(std::vector<Element> elements)
-: m_elements(std::move(elements))
+: m_elements(std::make_move_iterator(elements.begin()), std::make_move_iterator(elements.end()), memoryResource())
+{}
+
+Elements::Elements(const Elements& other)
+: m_elements(other.m_elements, memoryResource())
 {}
 
 auto Elements::append(Element element) -> void
@@ -164,7 +186,12 @@ auto Elements::append(Element element) -> void
     m_elements.emplace_back(std::move(element));
 }
 
-auto Elements::data() const -> const std::vector<Element>&
+auto Elements::append(ElementData&& attributes) -> void
+{
+    m_elements.emplace_back(std::move(attributes));
+}
+
+auto Elements::data() const -> const std::pmr::vector<Element>&
 {
     return m_elements;
 }
@@ -181,12 +208,18 @@ auto Elements::operator[](Index index) const -> const Element&
 
 auto Elements::indexWithSymbol(std::string symbol) const -> Index
 {
-    return indexfn(data(), Atomik::withSymbol(symbol));
+    const auto idx = indexfn(data(), Atomik::withSymbol(symbol));
+    ATOMIK_COUNT(Counter::ElementLookups, 1);
+    ATOMIK_COUNT(Counter::ElementLookupComparisons, idx < 0 ? size() : idx + 1);
+    return idx;
 }
 
 auto Elements::indexWithName(std::string name) const -> Index
 {
-    return indexfn(data(), Atomik::withName(name));
+    const auto idx = indexfn(data(), Atomik::withName(name));
+    ATOMIK_COUNT(Counter::ElementLookups, 1);
+    ATOMIK_COUNT(Counter::ElementLookupComparisons, idx < 0 ? size() : idx + 1);
+    return idx;
 }
 
 auto Elements::getWithName(std::string name) const -> Element
@@ -205,26 +238,45 @@ auto Elements::getWithSymbol(std::string symbol) const -> Element
 
 auto Elements::withSymbols(const StringList& symbols) const -> Elements
 {
-    std::vector<Element> selected(symbols.size());
-    transform(symbols, selected, [&](auto&& symbol) { return getWithSymbol(symbol); });
-    return Elements(selected);
+    Elements selected;
+    selected.m_elements.reserve(symbols.size());
+    for(const auto& symbol : symbols)
+        selected.append(getWithSymbol(symbol));
+    return selected;
+}
+
+auto Elements::withSymbols(const std::pmr::vector<InternedString>& symbols) const -> Elements
+{
+    Elements selected;
+    selected.m_elements.reserve(symbols.size());
+    for(const auto& symbol : symbols)
+    {
+        const auto idx = indexfn(data(), [&](auto&& element) { return element.symbol() == symbol; });
+        ATOMIK_COUNT(Counter::ElementLookups, 1);
+        ATOMIK_COUNT(Counter::ElementLookupComparisons, idx < 0 ? size() : idx + 1);
+        error(idx < 0, "Could not find an element with the given symbol `", symbol, "`.");
+        selected.append(m_elements[idx]);
+    }
+    return selected;
 }
 
 auto Elements::withNames(const StringList& names) const -> Elements
 {
-    std::vector<Element> selected(names.size());
-    transform(names, selected, [&](auto&& name) { return getWithName(name); });
-    return Elements(selected);
+    Elements selected;
+    selected.m_elements.reserve(names.size());
+    for(const auto& name : names)
+        selected.append(getWithName(name));
+    return selected;
 }
 
 auto Elements::withTag(std::string tag) const -> Elements
 {
-    return Elements(filter(data(), Atomik::withTag(tag)));
+    return select(*this, Atomik::withTag(tag));
 }
 
 auto Elements::withTags(const StringList& tags) const -> Elements
 {
-    return Elements(filter(data(), Atomik::withTags(tags.data())));
+    return select(*this, Atomik::withTags(tags.data()));
 }
 
 auto Elements::PeriodicTable() -> Elements
@@ -232,4 +284,15 @@ auto Elements::PeriodicTable() -> Elements
     return Elements(internal::elements_from_periodic_table);
 }
 
+auto Elements::Default() -> const Elements&
+{
+    // Created on the default memory resource, since it outlives any MemoryResourceScope active on its first use
+    static const Elements db = []()
+    {
+        MemoryResourceScope scope(std::pmr::get_default_resource());
+        return PeriodicTable();
+    }();
+    return db;
+}
+
 } // namespace Atomik
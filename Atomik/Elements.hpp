@@ -18,6 +18,7 @@
 #pragma once
 
 // C++ includes
+#include <memory_resource>
 #include <string>
 #include <vector>
 
@@ -40,11 +41,26 @@ public:
     /// Construct an Elements object with given data.
     explicit Elements(std::vector<Element> elements);
 
+    /// Construct a copy of an Elements object allocated from the current memory resource.
+    Elements(const Elements& other);
+
+    /// Construct an Elements object by taking the elements of another, with its memory resource.
+    Elements(Elements&& other) = default;
+
+    /// Assign the elements of another Elements object to this one, keeping the memory resource of this one.
+    auto operator=(const Elements& other) -> Elements& = default;
+
+    /// Assign the elements of another Elements object to this one, keeping the memory resource of this one.
+    auto operator=(Elements&& other) -> Elements& = default;
+
     /// Append a new element to the list of elements.
     auto append(Element element) -> void;
 
+    /// Append a new element to the list of elements constructed in place from given attributes.
+    auto append(ElementData&& attributes) -> void;
+
     /// Return the internal collection of Element objects.
-    auto data() const -> const std::vector<Element>&;
+    auto data() const -> const std::pmr::vector<Element>&;
 
     /// Return the number of chemical elements in the collection.
     auto size() const -> std::size_t;
@@ -69,6 +85,9 @@ public:
     /// Return the chemical elements with given symbols.
     auto withSymbols(const StringList& symbols) const -> Elements;
 
+    /// Return the chemical elements with given interned symbols.
+    auto withSymbols(const std::pmr::vector<InternedString>& symbols) const -> Elements;
+
     /// Return the chemical elements with given names.
     auto withNames(const StringList& names) const -> Elements;
 
@@ -93,9 +112,16 @@ public:
     /// Return all chemical elements from the periodic table.
     static auto PeriodicTable() -> Elements;
 
+    /// Return the default database of chemical elements, shared by the whole library, with all elements from the periodic table.
+    /// This is the database used to resolve the elements of substances constructed from their formulas only.
+    static auto Default() -> const Elements&;
+
 private:
-    /// The chemical elements stored in the database.
-    std::vector<Element> m_elements;
+    /// Allow Database objects to update their elements in place when applying a delta.
+    friend class Database;
+
+    /// The chemical elements stored in the database, allocated from the memory resource current at construction.
+    std::pmr::vector<Element> m_elements;
 };
 
 } // namespace Atomik
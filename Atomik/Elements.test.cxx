@@ -51,6 +51,10 @@ TEST_CASE("Testing Elements", "[Elements]")
     elements = Elements::PeriodicTable();
 
     REQUIRE(elements.size() == 119);
+
+    // Test the default database of elements is a single shared instance of the periodic table
+    REQUIRE(&Elements::Default() == &Elements::Default());
+    REQUIRE(Elements::Default().size() == elements.size());
     REQUIRE(elements.getWithSymbol("Z").name() == "Charge");
     REQUIRE(elements.getWithSymbol("H").name() == "Hydrogen");
     REQUIRE(elements.getWithSymbol("He").name() == "Helium");
@@ -208,4 +212,15 @@ TEST_CASE("Testing Elements", "[Elements]")
     REQUIRE(filtered.size() == 2);
     REQUIRE(filtered[0].symbol() == "Aa");
     REQUIRE(filtered[1].symbol() == "Bb");
+
+    // Test method Elements::append with element attributes
+    elements = Elements();
+    elements.append(Element({"H", "Hydrogen"}));
+    elements.append(ElementData{"O", "Oxygen", 8, 0.015999400, 3.44, {"tag1"}});
+
+    REQUIRE(elements.size() == 2);
+    REQUIRE(elements[1].symbol() == "O");
+    REQUIRE(elements[1].name() == "Oxygen");
+    REQUIRE(elements[1].atomicNumber() == 8);
+    REQUIRE(elements[1].hasTag("tag1"));
 }
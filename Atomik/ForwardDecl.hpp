@@ -20,10 +20,12 @@
 namespace Atomik {
 
 // Forward declarations
+struct DatabaseDelta;
 class Element;
 class Elements;
-class Formula;
+struct InstrumentationSnapshot;
 class Substance;
+class SubstanceFormula;
 class Substances;
 
 } // namespace Atomik
@@ -0,0 +1,215 @@
+// Atomik is a library that implements basic chemical concepts such as elements, substances, and reactions.
+//
+// Copyright (C) 2018-2019 Allan Leal and Reaktoro Contributors
+//
+// This library is free software; you can redistribute it and/or
+// modify it under the terms of the GNU Lesser General Public
+// License as published by the Free Software Foundation; either
+// version 2.1 of the License, or (at your option) any later version.
+//
+// This library is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+// Lesser General Public License for more details.
+//
+// You should have received a copy of the GNU Lesser General Public License
+// along with this library. If not, see <http://www.gnu.org/licenses/>.
+
+#include "Instrumentation.hpp"
+
+// C++ includes
+#include <atomic>
+
+namespace Atomik {
+namespace {
+
+/// The names of the counters in the order of Counter.
+const char* counterNames[] = {
+    "formula_parses",
+    "element_lookups",
+    "element_lookup_comparisons",
+    "substance_lookups",
+    "substance_lookup_comparisons",
+    "substance_filters",
+};
+
+/// The names of the timers in the order of Timer.
+const char* timerNames[] = {
+    "formula_parse",
+    "load_elements_file",
+    "load_substances_file",
+    "write_binary_database",
+    "open_mapped_database",
+    "encode_substance_archive",
+    "decode_substance_archive",
+};
+
+/// The names of the caches in the order of Cache.
+const char* cacheNames[] = {
+    "interned_strings",
+    "snapshots",
+    "lazy_substances",
+};
+
+static_assert(std::size(counterNames) == std::size_t(Counter::Count));
+static_assert(std::size(timerNames) == std::size_t(Timer::Count));
+static_assert(std::size(cacheNames) == std::size_t(Cache::Count));
+
+/// The latencies recorded by a timer.
+struct Histogram
+{
+    std::atomic<std::uint64_t> count;
+    std::atomic<std::uint64_t> totalNs;
+    std::atomic<std::uint64_t> maxNs;
+    std::array<std::atomic<std::uint64_t>, numLatencyBuckets> buckets;
+};
+
+/// The hits and misses recorded for a cache.
+struct HitsAndMisses
+{
+    std::atomic<std::uint64_t> hits;
+    std::atomic<std::uint64_t> misses;
+};
+
+/// The state of the instrumentation, zero-initialized as a static object.
+/// All updates are relaxed atomic operations, so recording never blocks.
+struct State
+{
+    std::array<std::atomic<std::uint64_t>, std::size_t(Counter::Count)> counters;
+    std::array<Histogram, std::size_t(Timer::Count)> timers;
+    std::array<HitsAndMisses, std::size_t(Cache::Count)> caches;
+};
+
+auto state() -> State&
+{
+    static State state;
+    return state;
+}
+
+/// Return the histogram bucket of a latency in nanoseconds.
+auto bucketOf(std::uint64_t ns) -> std::size_t
+{
+    std::size_t i = 0;
+    while(ns > 1 && i + 1 < numLatencyBuckets)
+    {
+        ns >>= 1;
+        ++i;
+    }
+    return i;
+}
+
+} // namespace
+
+auto TimerStats::meanNs() const -> double
+{
+    return count ? double(totalNs) / count : 0.0;
+}
+
+auto TimerStats::quantileNs(double q) const -> double
+{
+    if(count == 0)
+        return 0.0;
+    const auto rank = q * count;
+    std::uint64_t seen = 0;
+    for(std::size_t i = 0; i < numLatencyBuckets; ++i)
+    {
+        seen += buckets[i];
+        if(seen >= rank && seen > 0)
+            return i + 1 < numLatencyBuckets ? double(std::uint64_t(1) << (i + 1)) : double(maxNs);
+    }
+    return double(maxNs);
+}
+
+auto CacheStats::hitRate() const -> double
+{
+    const auto lookups = hits + misses;
+    return lookups ? double(hits) / lookups : 0.0;
+}
+
+auto instrumentationSnapshot() -> InstrumentationSnapshot
+{
+    const auto& current = state();
+    const auto relaxed = std::memory_order_relaxed;
+
+    InstrumentationSnapshot res;
+
+    for(std::size_t i = 0; i < current.counters.size(); ++i)
+        res.counters.push_back({ counterNames[i], current.counters[i].load(relaxed) });
+
+    for(std::size_t i = 0; i < current.timers.size(); ++i)
+    {
+        const auto& histogram = current.timers[i];
+        TimerStats stats;
+        stats.name = timerNames[i];
+        stats.count = histogram.count.load(relaxed);
+        stats.totalNs = histogram.totalNs.load(relaxed);
+        stats.maxNs = histogram.maxNs.load(relaxed);
+        for(std::size_t j = 0; j < numLatencyBuckets; ++j)
+            stats.buckets[j] = histogram.buckets[j].load(relaxed);
+        res.timers.push_back(std::move(stats));
+    }
+
+    for(std::size_t i = 0; i < current.caches.size(); ++i)
+        res.caches.push_back({ cacheNames[i], current.caches[i].hits.load(relaxed), current.caches[i].misses.load(relaxed) });
+
+    return res;
+}
+
+auto resetInstrumentation() -> void
+{
+    auto& current = state();
+    const auto relaxed = std::memory_order_relaxed;
+
+    for(auto& counter : current.counters)
+        counter.store(0, relaxed);
+
+    for(auto& histogram : current.timers)
+    {
+        histogram.count.store(0, relaxed);
+        histogram.totalNs.store(0, relaxed);
+        histogram.maxNs.store(0, relaxed);
+        for(auto& bucket : histogram.buckets)
+            bucket.store(0, relaxed);
+    }
+
+    for(auto& cache : current.caches)
+    {
+        cache.hits.store(0, relaxed);
+        cache.misses.store(0, relaxed);
+    }
+}
+
+auto count(Counter counter, std::uint64_t events) -> void
+{
+    state().counters[std::size_t(counter)].fetch_add(events, std::memory_order_relaxed);
+}
+
+auto record(Timer timer, std::uint64_t ns) -> void
+{
+    auto& histogram = state().timers[std::size_t(timer)];
+    const auto relaxed = std::memory_order_relaxed;
+    histogram.count.fetch_add(1, relaxed);
+    histogram.totalNs.fetch_add(ns, relaxed);
+    histogram.buckets[bucketOf(ns)].fetch_add(1, relaxed);
+    auto max = histogram.maxNs.load(relaxed);
+    while(ns > max && !histogram.maxNs.compare_exchange_weak(max, ns, relaxed))
+        ;
+}
+
+auto record(Cache cache, bool hit) -> void
+{
+    auto& counts = state().caches[std::size_t(cache)];
+    (hit ? counts.hits : counts.misses).fetch_add(1, std::memory_order_relaxed);
+}
+
+ScopedTimer::ScopedTimer(Timer timer)
+: m_timer(timer), m_start(std::chrono::steady_clock::now())
+{}
+
+ScopedTimer::~ScopedTimer()
+{
+    const auto elapsed = std::chrono::steady_clock::now() - m_start;
+    record(m_timer, std::chrono::duration_cast<std::chrono::nanoseconds>(elapsed).count());
+}
+
+} // namespace Atomik
@@ -0,0 +1,198 @@
+// Atomik is a library that implements basic chemical concepts such as elements, substances, and reactions.
+//
+// Copyright (C) 2018-2019 Allan Leal and Reaktoro Contributors
+//
+// This library is free software; you can redistribute it and/or
+// modify it under the terms of the GNU Lesser General Public
+// License as published by the Free Software Foundation; either
+// version 2.1 of the License, or (at your option) any later version.
+//
+// This library is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+// Lesser General Public License for more details.
+//
+// You should have received a copy of the GNU Lesser General Public License
+// along with this library. If not, see <http://www.gnu.org/licenses/>.
+
+#pragma once
+
+// C++ includes
+#include <array>
+#include <chrono>
+#include <cstdint>
+#include <string>
+#include <vector>
+
+namespace Atomik {
+
+/// The events counted by the instrumentation of the library.
+enum class Counter
+{
+    FormulaParses,              ///< The number of chemical formulas parsed.
+    ElementLookups,             ///< The number of lookups of elements by symbol or name in Elements.
+    ElementLookupComparisons,   ///< The number of elements compared by the linear lookups in Elements.
+    SubstanceLookups,           ///< The number of lookups of substances by name or formula in Substances.
+    SubstanceLookupComparisons, ///< The number of substances compared by the linear lookups in Substances.
+    SubstanceFilters,           ///< The number of filters of substances by tags or elements in Substances.
+    Count                       ///< The number of counters (not a counter).
+};
+
+/// The operations whose latencies are recorded by the instrumentation of the library.
+enum class Timer
+{
+    FormulaParse,            ///< The parsing of a chemical formula.
+    LoadElementsFile,        ///< The loading of elements with loadElementsFile.
+    LoadSubstancesFile,      ///< The loading of substances with loadSubstancesFile.
+    WriteBinaryDatabase,     ///< The writing of a binary database with writeBinaryDatabase.
+    OpenMappedDatabase,      ///< The opening and validation of a binary database with MappedDatabase.
+    EncodeSubstanceArchive,  ///< The encoding of substances with encodeSubstanceArchive.
+    DecodeSubstanceArchive,  ///< The decoding of substances with decodeSubstanceArchive.
+    Count                    ///< The number of timers (not a timer).
+};
+
+/// The caches whose hits and misses are recorded by the instrumentation of the library.
+enum class Cache
+{
+    InternedStrings,  ///< The pool of interned strings (a hit when the string was already interned).
+    Snapshots,        ///< The binary snapshots of text databases read by loadElementsFile and loadSubstancesFile.
+    LazySubstances,   ///< The substances deserialized and cached by LazySubstances.
+    Count             ///< The number of caches (not a cache).
+};
+
+/// The number of buckets of the latency histograms.
+/// Bucket `i` counts the latencies in the range [2^i, 2^(i+1)) nanoseconds, with the
+/// first bucket also counting latencies below 1 ns and the last one those above 2^i ns.
+constexpr std::size_t numLatencyBuckets = 40;
+
+/// A type used to describe the value of a counter in a snapshot of the instrumentation.
+struct CounterStats
+{
+    /// The name of the counter (e.g., `formula_parses`).
+    std::string name;
+
+    /// The number of events counted.
+    std::uint64_t value = 0;
+};
+
+/// A type used to describe the latencies of an operation in a snapshot of the instrumentation.
+struct TimerStats
+{
+    /// The name of the timer (e.g., `formula_parse`).
+    std::string name;
+
+    /// The number of times the operation was timed.
+    std::uint64_t count = 0;
+
+    /// The sum of the latencies in nanoseconds.
+    std::uint64_t totalNs = 0;
+
+    /// The largest latency in nanoseconds.
+    std::uint64_t maxNs = 0;
+
+    /// The number of latencies in each bucket of the histogram (see @ref numLatencyBuckets).
+    std::array<std::uint64_t, numLatencyBuckets> buckets = {};
+
+    /// Return the mean latency in nanoseconds, or zero if the operation was not timed.
+    auto meanNs() const -> double;
+
+    /// Return an upper bound of the latency quantile @p q (e.g., 0.99) in nanoseconds,
+    /// given by the upper limit of the histogram bucket containing it.
+    auto quantileNs(double q) const -> double;
+};
+
+/// A type used to describe the hits and misses of a cache in a snapshot of the instrumentation.
+struct CacheStats
+{
+    /// The name of the cache (e.g., `snapshots`).
+    std::string name;
+
+    /// The number of lookups that found the requested entry in the cache.
+    std::uint64_t hits = 0;
+
+    /// The number of lookups that did not find the requested entry in the cache.
+    std::uint64_t misses = 0;
+
+    /// Return the fraction of lookups that were hits, or zero if there were none.
+    auto hitRate() const -> double;
+};
+
+/// A type used to describe the state of all counters, timers, and caches at some point in time.
+struct InstrumentationSnapshot
+{
+    /// The counters in the order of @ref Counter.
+    std::vector<CounterStats> counters;
+
+    /// The timers in the order of @ref Timer.
+    std::vector<TimerStats> timers;
+
+    /// The caches in the order of @ref Cache.
+    std::vector<CacheStats> caches;
+};
+
+/// Return true if the library was built with instrumentation (option `ATOMIK_ENABLE_INSTRUMENTATION`).
+/// Without it, the instrumentation macros compile to nothing and snapshots contain only zeros.
+constexpr auto instrumentationEnabled() -> bool
+{
+#ifdef ATOMIK_INSTRUMENTATION
+    return true;
+#else
+    return false;
+#endif
+}
+
+/// Return the current values of all counters, timers, and caches.
+/// The values are read without stopping other threads, so a snapshot taken while other
+/// threads use the library may combine values from slightly different moments.
+auto instrumentationSnapshot() -> InstrumentationSnapshot;
+
+/// Reset all counters, timers, and caches to zero, e.g., after exporting a snapshot.
+auto resetInstrumentation() -> void;
+
+/// Add a number of events to a counter.
+auto count(Counter counter, std::uint64_t events = 1) -> void;
+
+/// Record the latency of an operation in nanoseconds.
+auto record(Timer timer, std::uint64_t ns) -> void;
+
+/// Record a hit or a miss of a cache.
+auto record(Cache cache, bool hit) -> void;
+
+/// A type used to record the latency of an operation from its construction to its destruction.
+class ScopedTimer
+{
+public:
+    /// Construct a ScopedTimer object and start timing.
+    explicit ScopedTimer(Timer timer);
+
+    /// Destroy this ScopedTimer object and record the elapsed time.
+    ~ScopedTimer();
+
+    ScopedTimer(const ScopedTimer&) = delete;
+
+    auto operator=(const ScopedTimer&) -> ScopedTimer& = delete;
+
+private:
+    /// The timer recording the latency.
+    Timer m_timer;
+
+    /// The time at construction.
+    std::chrono::steady_clock::time_point m_start;
+};
+
+} // namespace Atomik
+
+#ifdef ATOMIK_INSTRUMENTATION
+#define ATOMIK_CONCAT_IMPL(a, b) a##b
+#define ATOMIK_CONCAT(a, b) ATOMIK_CONCAT_IMPL(a, b)
+/// Add a number of events to a counter (e.g., `ATOMIK_COUNT(Counter::FormulaParses, 1)`).
+#define ATOMIK_COUNT(counter, events) ::Atomik::count(counter, events)
+/// Record the latency of the rest of the enclosing scope (e.g., `ATOMIK_TIME(Timer::FormulaParse)`).
+#define ATOMIK_TIME(timer) const ::Atomik::ScopedTimer ATOMIK_CONCAT(atomikScopedTimer, __LINE__)(timer)
+/// Record a hit or a miss of a cache (e.g., `ATOMIK_CACHE(Cache::Snapshots, found)`).
+#define ATOMIK_CACHE(cache, hit) ::Atomik::record(cache, hit)
+#else
+#define ATOMIK_COUNT(counter, events) ((void)0)
+#define ATOMIK_TIME(timer) ((void)0)
+#define ATOMIK_CACHE(cache, hit) ((void)0)
+#endif
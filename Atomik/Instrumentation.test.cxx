@@ -0,0 +1,130 @@
+// Atomik is a library that implements basic chemical concepts such as elements, substances, and reactions.
+//
+// Copyright (C) 2018-2019 Allan Leal and Reaktoro Contributors
+//
+// This library is free software; you can redistribute it and/or
+// modify it under the terms of the GNU Lesser General Public
+// License as published by the Free Software Foundation; either
+// version 2.1 of the License, or (at your option) any later version.
+//
+// This library is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+// Lesser General Public License for more details.
+//
+// You should have received a copy of the GNU Lesser General Public License
+// along with this library. If not, see <http://www.gnu.org/licenses/>.
+
+// Catch includes
+#include <catch2/catch.hpp>
+
+// Atomik includes
+#include <Atomik/Elements.hpp>
+#include <Atomik/Instrumentation.hpp>
+#include <Atomik/Serialization.hpp>
+#include <Atomik/Substance.hpp>
+#include <Atomik/Substances.hpp>
+using namespace Atomik;
+
+TEST_CASE("Testing Instrumentation", "[Instrumentation]")
+{
+    resetInstrumentation();
+
+    SECTION("When recording events directly")
+    {
+        count(Counter::FormulaParses, 3);
+        record(Timer::FormulaParse, 0);
+        record(Timer::FormulaParse, 100);
+        record(Timer::FormulaParse, 1000);
+        record(Timer::FormulaParse, 5000);
+        record(Cache::Snapshots, true);
+        record(Cache::Snapshots, true);
+        record(Cache::Snapshots, true);
+        record(Cache::Snapshots, false);
+
+        const auto snapshot = instrumentationSnapshot();
+
+        REQUIRE(snapshot.counters.size() == std::size_t(Counter::Count));
+        REQUIRE(snapshot.timers.size() == std::size_t(Timer::Count));
+        REQUIRE(snapshot.caches.size() == std::size_t(Cache::Count));
+
+        const auto& parses = snapshot.counters[std::size_t(Counter::FormulaParses)];
+        REQUIRE(parses.name == "formula_parses");
+        REQUIRE(parses.value == 3);
+
+        const auto& timer = snapshot.timers[std::size_t(Timer::FormulaParse)];
+        REQUIRE(timer.name == "formula_parse");
+        REQUIRE(timer.count == 4);
+        REQUIRE(timer.totalNs == 6100);
+        REQUIRE(timer.maxNs == 5000);
+        REQUIRE(timer.meanNs() == Approx(1525.0));
+        REQUIRE(timer.buckets[0] == 1);  // 0 ns
+        REQUIRE(timer.buckets[6] == 1);  // 100 ns in [64, 128)
+        REQUIRE(timer.buckets[9] == 1);  // 1000 ns in [512, 1024)
+        REQUIRE(timer.buckets[12] == 1); // 5000 ns in [4096, 8192)
+        REQUIRE(timer.quantileNs(0.50) == 128);
+        REQUIRE(timer.quantileNs(0.75) == 1024);
+        REQUIRE(timer.quantileNs(1.00) == 8192);
+
+        const auto& cache = snapshot.caches[std::size_t(Cache::Snapshots)];
+        REQUIRE(cache.name == "snapshots");
+        REQUIRE(cache.hits == 3);
+        REQUIRE(cache.misses == 1);
+        REQUIRE(cache.hitRate() == Approx(0.75));
+
+        const json j = snapshot;
+        REQUIRE(j["enabled"] == instrumentationEnabled());
+        REQUIRE(j["counters"]["formula_parses"] == 3);
+        REQUIRE(j["timers"]["formula_parse"]["count"] == 4);
+        REQUIRE(j["timers"]["formula_parse"]["buckets"].size() == 13);
+        REQUIRE(j["caches"]["snapshots"]["hitRate"] == Approx(0.75));
+        REQUIRE(j["caches"]["lazy_substances"]["hitRate"] == 0.0);
+
+        resetInstrumentation();
+
+        const auto reset = instrumentationSnapshot();
+        REQUIRE(reset.counters[std::size_t(Counter::FormulaParses)].value == 0);
+        REQUIRE(reset.timers[std::size_t(Timer::FormulaParse)].count == 0);
+        REQUIRE(reset.timers[std::size_t(Timer::FormulaParse)].quantileNs(0.5) == 0.0);
+        REQUIRE(reset.caches[std::size_t(Cache::Snapshots)].hits == 0);
+    }
+
+    SECTION("When using the instrumented library")
+    {
+        const auto elements = Elements::PeriodicTable();
+        const Substances substances({ Substance("H2O"), Substance("CO2"), Substance("CaCO3") });
+
+        resetInstrumentation();
+
+        elements.indexWithSymbol("C");
+        elements.indexWithSymbol("Xx");
+        substances.indexWithName("CaCO3");
+        substances.withTag("aqueous");
+        Substance("NaCl");
+
+        const auto snapshot = instrumentationSnapshot();
+        auto counter = [&](Counter c) { return snapshot.counters[std::size_t(c)].value; };
+
+        if(instrumentationEnabled())
+        {
+            REQUIRE(counter(Counter::ElementLookups) >= 2);
+            REQUIRE(counter(Counter::ElementLookupComparisons) >= 6 + elements.size());
+            REQUIRE(counter(Counter::SubstanceLookups) == 1);
+            REQUIRE(counter(Counter::SubstanceLookupComparisons) == 3);
+            REQUIRE(counter(Counter::SubstanceFilters) == 1);
+            REQUIRE(counter(Counter::FormulaParses) >= 1);
+            REQUIRE(snapshot.timers[std::size_t(Timer::FormulaParse)].count >= 1);
+            const auto& interned = snapshot.caches[std::size_t(Cache::InternedStrings)];
+            REQUIRE(interned.hits + interned.misses > 0);
+        }
+        else
+        {
+            for(const auto& c : snapshot.counters)
+                REQUIRE(c.value == 0);
+            for(const auto& t : snapshot.timers)
+                REQUIRE(t.count == 0);
+            for(const auto& c : snapshot.caches)
+                REQUIRE(c.hits + c.misses == 0);
+        }
+    }
+}
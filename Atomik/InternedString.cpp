@@ -0,0 +1,183 @@
+// Atomik is a library that implements basic chemical concepts such as elements, substances, and reactions.
+//
+// Copyright (C) 2018-2019 Allan Leal and Reaktoro Contributors
+//
+// This library is free software; you can redistribute it and/or
+// modify it under the terms of the GNU Lesser General Public
+// License as published by the Free Software Foundation; either
+// version 2.1 of the License, or (at your option) any later version.
+//
+// This library is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+// Lesser General Public License for more details.
+//
+// You should have received a copy of the GNU Lesser General Public License
+// along with this library. If not, see <http://www.gnu.org/licenses/>.
+
+#include "InternedString.hpp"
+
+// C++ includes
+#include <array>
+#include <deque>
+#include <mutex>
+#include <shared_mutex>
+#include <unordered_map>
+
+// Atomik includes
+#include <Atomik/Instrumentation.hpp>
+#include <Atomik/Memory.hpp>
+
+namespace Atomik {
+namespace {
+
+/// The number of independently locked shards of the string pool.
+constexpr std::size_t numShards = 16;
+
+/// A type used to store a portion of the interned strings.
+struct Shard
+{
+    /// The mutex protecting the shard (shared for lookups, exclusive for insertions).
+    std::shared_mutex mutex;
+
+    /// The stored strings (a deque never relocates its existing elements).
+    std::deque<std::string> strings;
+
+    /// The mapping from the contents of the stored strings to their addresses.
+    std::unordered_map<std::string_view, const std::string*> index;
+};
+
+/// Return the shards of the string pool.
+/// The pool is intentionally never destroyed so that interned strings remain
+/// valid during the destruction of static objects in other translation units.
+auto shards() -> std::array<Shard, numShards>&
+{
+    static auto* pool = new std::array<Shard, numShards>();
+    return *pool;
+}
+
+/// Return the shard in which a string with given contents is stored.
+auto shardOf(std::string_view str) -> Shard&
+{
+    return shards()[std::hash<std::string_view>()(str) % numShards];
+}
+
+/// Return the stored empty string shared by all default InternedString objects.
+auto emptyString() -> const std::string*
+{
+    static const auto* empty = new std::string();
+    return empty;
+}
+
+/// Return the stored empty string returned by InternedString::find for unknown strings.
+auto missingString() -> const std::string*
+{
+    static const auto* missing = new std::string();
+    return missing;
+}
+
+/// Return the stored string with given contents in a shard, or nullptr if there is none.
+auto lookup(const Shard& shard, std::string_view str) -> const std::string*
+{
+    const auto iter = shard.index.find(str);
+    return iter != shard.index.end() ? iter->second : nullptr;
+}
+
+/// Return the stored string with given contents, storing it first if needed.
+/// The contents are moved into the pool if given as an rvalue std::string.
+template<typename String>
+auto store(String&& contents) -> const std::string*
+{
+    const std::string_view str = contents;
+
+    if(str.empty())
+        return emptyString();
+
+    auto& shard = shardOf(str);
+
+    {
+        std::shared_lock lock(shard.mutex);
+        const auto* found = lookup(shard, str);
+        ATOMIK_CACHE(Cache::InternedStrings, found != nullptr);
+        if(found)
+            return found;
+    }
+
+    std::unique_lock lock(shard.mutex);
+    if(const auto* found = lookup(shard, str)) // another thread may have stored it in the meantime
+        return found;
+
+    const auto* stored = &shard.strings.emplace_back(std::forward<String>(contents));
+    shard.index.emplace(*stored, stored);
+    return stored;
+}
+
+} // namespace
+
+InternedString::InternedString()
+: m_str(emptyString())
+{}
+
+InternedString::InternedString(std::string_view str)
+: m_str(store(str))
+{}
+
+InternedString::InternedString(const char* str)
+: m_str(store(std::string_view(str)))
+{}
+
+InternedString::InternedString(std::string&& str)
+: m_str(store(std::move(str)))
+{}
+
+auto InternedString::find(std::string_view str) -> InternedString
+{
+    if(str.empty())
+        return InternedString();
+
+    auto& shard = shardOf(str);
+    std::shared_lock lock(shard.mutex);
+    const auto* found = lookup(shard, str);
+    return InternedString(found ? found : missingString());
+}
+
+auto InternedString::poolSize() -> std::size_t
+{
+    std::size_t count = 0;
+    for(auto& shard : shards())
+    {
+        std::shared_lock lock(shard.mutex);
+        count += shard.strings.size();
+    }
+    return count;
+}
+
+auto intern(const std::vector<std::string>& strs) -> std::pmr::vector<InternedString>
+{
+    std::pmr::vector<InternedString> res(memoryResource());
+    res.reserve(strs.size());
+    for(const auto& str : strs)
+        res.emplace_back(str);
+    return res;
+}
+
+auto intern(std::vector<std::string>&& strs) -> std::pmr::vector<InternedString>
+{
+    std::pmr::vector<InternedString> res(memoryResource());
+    res.reserve(strs.size());
+    for(auto& str : strs)
+        res.emplace_back(std::move(str));
+    return res;
+}
+
+auto strings(const std::pmr::vector<InternedString>& strs) -> std::vector<std::string>
+{
+    return { strs.begin(), strs.end() };
+}
+
+auto strings(const std::vector<InternedString>& strs) -> std::vector<std::string>
+{
+    return { strs.begin(), strs.end() };
+}
+
+} // namespace Atomik
@@ -0,0 +1,144 @@
+// Atomik is a library that implements basic chemical concepts such as elements, substances, and reactions.
+//
+// Copyright (C) 2018-2019 Allan Leal and Reaktoro Contributors
+//
+// This library is free software; you can redistribute it and/or
+// modify it under the terms of the GNU Lesser General Public
+// License as published by the Free Software Foundation; either
+// version 2.1 of the License, or (at your option) any later version.
+//
+// This library is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+// Lesser General Public License for more details.
+//
+// You should have received a copy of the GNU Lesser General Public License
+// along with this library. If not, see <http://www.gnu.org/licenses/>.
+
+#pragma once
+
+// C++ includes
+#include <functional>
+#include <memory_resource>
+#include <ostream>
+#include <string>
+#include <string_view>
+#include <vector>
+
+namespace Atomik {
+
+/// A type used to represent a string stored once in a global, thread-safe string pool.
+/// Two InternedString objects with equal contents always refer to the same stored string.
+/// As a result, they are compared and hashed in constant time using only their addresses.
+/// The stored strings are never released, so the references and views returned by this
+/// class remain valid for the lifetime of the program.
+///
+/// @warning Since the pool is never released, its memory grows with every distinct string
+/// interned during the lifetime of the program. This includes the names, symbols, types, tags
+/// and parameter keys of every database loaded, reloaded or imported, even after the database
+/// itself has been destroyed. Reloading a database with the same names adds nothing to the
+/// pool, but input with an unbounded number of distinct names (e.g., generated or untrusted
+/// databases) should be size-checked beforehand, since its strings cannot be reclaimed.
+/// Use `poolSize` to monitor the number of stored strings.
+class InternedString
+{
+public:
+    /// Construct a default InternedString object representing an empty string.
+    InternedString();
+
+    /// Construct an InternedString object with given contents, storing them in the pool if needed.
+    explicit InternedString(std::string_view str);
+
+    /// Construct an InternedString object with given contents, storing them in the pool if needed.
+    explicit InternedString(const char* str);
+
+    /// Construct an InternedString object with given contents, moving them into the pool if needed.
+    explicit InternedString(std::string&& str);
+
+    /// Return the interned string with given contents if it exists, without adding it to the pool.
+    /// In case no string with such contents has been interned yet, the returned object
+    /// represents an empty string that compares unequal to every other interned string.
+    static auto find(std::string_view str) -> InternedString;
+
+    /// Return the number of strings stored in the pool.
+    static auto poolSize() -> std::size_t;
+
+    /// Return the stored string.
+    auto str() const -> const std::string& { return *m_str; }
+
+    /// Return a view of the stored string.
+    auto view() const -> std::string_view { return *m_str; }
+
+    /// Return the stored string as a null-terminated character array.
+    auto c_str() const -> const char* { return m_str->c_str(); }
+
+    /// Return the number of characters in the stored string.
+    auto size() const -> std::size_t { return m_str->size(); }
+
+    /// Return true if the stored string is empty.
+    auto empty() const -> bool { return m_str->empty(); }
+
+    /// Return (implicitly) the stored string.
+    operator const std::string&() const { return *m_str; }
+
+    /// Compare two InternedString objects for equality in constant time.
+    friend auto operator==(InternedString lhs, InternedString rhs) -> bool { return lhs.m_str == rhs.m_str; }
+
+    /// Compare two InternedString objects for inequality in constant time.
+    friend auto operator!=(InternedString lhs, InternedString rhs) -> bool { return lhs.m_str != rhs.m_str; }
+
+    /// Compare two InternedString objects for less than using their contents.
+    friend auto operator<(InternedString lhs, InternedString rhs) -> bool { return lhs.view() < rhs.view(); }
+
+    /// Compare an InternedString object with a string for equality.
+    friend auto operator==(InternedString lhs, std::string_view rhs) -> bool { return lhs.view() == rhs; }
+
+    /// Compare a string with an InternedString object for equality.
+    friend auto operator==(std::string_view lhs, InternedString rhs) -> bool { return lhs == rhs.view(); }
+
+    /// Compare an InternedString object with a string for inequality.
+    friend auto operator!=(InternedString lhs, std::string_view rhs) -> bool { return lhs.view() != rhs; }
+
+    /// Compare a string with an InternedString object for inequality.
+    friend auto operator!=(std::string_view lhs, InternedString rhs) -> bool { return lhs != rhs.view(); }
+
+    /// Output the stored string to a stream.
+    friend auto operator<<(std::ostream& out, InternedString str) -> std::ostream& { return out << str.view(); }
+
+private:
+    /// Construct an InternedString object from a string already stored in the pool.
+    explicit InternedString(const std::string* str) : m_str(str) {}
+
+    /// The pointer to the string stored in the pool.
+    const std::string* m_str;
+
+    friend struct std::hash<InternedString>;
+};
+
+/// Convert a vector of strings into a vector of interned strings allocated from the current memory resource (see Memory.hpp).
+auto intern(const std::vector<std::string>& strs) -> std::pmr::vector<InternedString>;
+
+/// Convert a vector of strings into a vector of interned strings allocated from the current memory resource, moving new strings into the pool.
+auto intern(std::vector<std::string>&& strs) -> std::pmr::vector<InternedString>;
+
+/// Convert a vector of interned strings into a vector of strings.
+auto strings(const std::pmr::vector<InternedString>& strs) -> std::vector<std::string>;
+
+/// Convert a vector of interned strings into a vector of strings.
+auto strings(const std::vector<InternedString>& strs) -> std::vector<std::string>;
+
+} // namespace Atomik
+
+namespace std {
+
+/// Hash an InternedString object in constant time using the address of its stored string.
+template<>
+struct hash<Atomik::InternedString>
+{
+    auto operator()(const Atomik::InternedString& str) const noexcept -> std::size_t
+    {
+        return std::hash<const std::string*>()(str.m_str);
+    }
+};
+
+} // namespace std
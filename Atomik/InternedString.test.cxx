@@ -0,0 +1,80 @@
+// Atomik is a library that implements basic chemical concepts such as elements, substances, and reactions.
+//
+// Copyright (C) 2018-2019 Allan Leal and Reaktoro Contributors
+//
+// This library is free software; you can redistribute it and/or
+// modify it under the terms of the GNU Lesser General Public
+// License as published by the Free Software Foundation; either
+// version 2.1 of the License, or (at your option) any later version.
+//
+// This library is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+// Lesser General Public License for more details.
+//
+// You should have received a copy of the GNU Lesser General Public License
+// along with this library. If not, see <http://www.gnu.org/licenses/>.
+
+// Catch includes
+#include <catch2/catch.hpp>
+
+// C++ includes
+#include <thread>
+
+// Atomik includes
+#include <Atomik/Element.hpp>
+#include <Atomik/InternedString.hpp>
+#include <Atomik/Substance.hpp>
+using namespace Atomik;
+
+TEST_CASE("Testing InternedString", "[InternedString]")
+{
+    const InternedString a("Calcite");
+    const InternedString b(std::string("Calc") + "ite");
+
+    REQUIRE(a == b);
+    REQUIRE(&a.str() == &b.str());
+    REQUIRE(a.view().data() == b.view().data());
+    REQUIRE(a == "Calcite");
+    REQUIRE(a != "Aragonite");
+    REQUIRE(std::hash<InternedString>()(a) == std::hash<InternedString>()(b));
+
+    REQUIRE(InternedString() == InternedString(""));
+    REQUIRE(InternedString().empty());
+
+    // Test find does not add new strings to the pool
+    const auto size = InternedString::poolSize();
+    const auto missing = InternedString::find("NotInternedAnywhere");
+    REQUIRE(missing.empty());
+    REQUIRE(missing != InternedString());
+    REQUIRE(InternedString::poolSize() == size);
+    REQUIRE(InternedString::find("Calcite") == a);
+
+    // Test moving a new string into the pool stores it once, and moving an existing one reuses it
+    const InternedString moved(std::string("MovedIntoThePool"));
+    REQUIRE(InternedString::poolSize() == size + 1);
+    REQUIRE(moved == "MovedIntoThePool");
+    REQUIRE(InternedString(std::string("Calcite")) == a);
+    REQUIRE(InternedString::poolSize() == size + 1);
+
+    // Test elements and substances share the stored strings
+    const Element element({ .symbol = "Ca", .name = "Calcium", .atomicNumber = 20, .atomicWeight = 0.040078, .electronegativity = 1.0, .tags = {"alkaline"} });
+    const auto substance = Substance("CaCO3").replaceName("Calcite").replaceTags({"mineral", "alkaline"});
+
+    REQUIRE(substance.name() == a);
+    REQUIRE(element.tags()[0] == substance.tags()[1]);
+    REQUIRE(element.symbol() == element.replaceName("Calcium2").symbol());
+
+    // Test concurrent interning of the same strings yields the same stored strings
+    std::vector<std::vector<InternedString>> results(4);
+    std::vector<std::thread> threads;
+    for(auto& result : results)
+        threads.emplace_back([&result]() {
+            for(auto i = 0; i < 1000; ++i)
+                result.emplace_back("ConcurrentString" + std::to_string(i));
+        });
+    for(auto& thread : threads)
+        thread.join();
+    for(const auto& result : results)
+        REQUIRE(result == results[0]);
+}
@@ -0,0 +1,279 @@
+// Atomik is a library that implements basic chemical concepts such as elements, substances, and reactions.
+//
+// Copyright (C) 2018-2019 Allan Leal and Reaktoro Contributors
+//
+// This library is free software; you can redistribute it and/or
+// modify it under the terms of the GNU Lesser General Public
+// License as published by the Free Software Foundation; either
+// version 2.1 of the License, or (at your option) any later version.
+//
+// This library is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+// Lesser General Public License for more details.
+//
+// You should have received a copy of the GNU Lesser General Public License
+// along with this library. If not, see <http://www.gnu.org/licenses/>.
+
+#include "LazySubstances.hpp"
+
+// C++ includes
+#include <filesystem>
+#include <fstream>
+#include <list>
+#include <mutex>
+#include <sstream>
+#include <unordered_map>
+#include <vector>
+
+// Atomik includes
+#include <Atomik/Exception.hpp>
+#include <Atomik/Instrumentation.hpp>
+#include <Atomik/Memory.hpp>
+#include <Atomik/ParallelLoader.hpp>
+#include <Atomik/Serialization.hpp>
+
+namespace Atomik {
+namespace {
+
+/// The first word of an index file, followed by its format version.
+constexpr std::string_view indexSignature = "atomik-substances-index";
+
+/// The version of the format of index files.
+constexpr int indexVersion = 1;
+
+/// The location of a record in a YAML file.
+struct RecordLocation
+{
+    /// The offset of the record from the start of the file.
+    std::uint64_t offset;
+
+    /// The number of characters in the record.
+    std::uint64_t length;
+};
+
+/// Return the size and modification time of a file, used to check whether a saved index still applies to it.
+auto fileStamp(const std::string& path) -> std::string
+{
+    const auto size = std::filesystem::file_size(path);
+    const auto time = std::filesystem::last_write_time(path).time_since_epoch().count();
+    return std::to_string(size) + " " + std::to_string(time);
+}
+
+/// Return an estimate of the bytes held by a cached substance, used to bound the memory of the cache.
+/// Interned strings and the data of elements are shared with other substances and are not counted.
+auto estimatedSize(const Substance& substance) -> std::size_t
+{
+    const auto& formula = substance.formula();
+    const auto& elements = substance.elements();
+    const auto numSymbols = formula.symbols().size() + elements.symbols().size();
+    const auto numNumbers = formula.coefficients().size() + elements.coefficients().size() + elements.oxidationStates().size();
+    return sizeof(std::pair<Index, Substance>) + 8 * sizeof(void*) // the list and map nodes of the cache entry
+        + sizeof(Substance) + sizeof(SubstanceFormula) + sizeof(SubstanceElements) + 4 * sizeof(void*) // the substance and its shared data
+        + formula.formula().capacity()
+        + numSymbols * sizeof(InternedString)
+        + numNumbers * sizeof(double)
+        + elements.elements().size() * sizeof(Element)
+        + substance.tags().size() * sizeof(InternedString);
+}
+
+} // namespace
+
+struct LazySubstances::Impl
+{
+    /// The YAML file of substances.
+    mutable std::ifstream file;
+
+    /// The locations of the records in the file.
+    std::vector<RecordLocation> records;
+
+    /// The names of the substances in the file.
+    std::vector<std::string> names;
+
+    /// The index of the first record with each name.
+    std::unordered_map<std::string_view, Index> indexOfName;
+
+    /// The maximum estimated number of bytes held by the substances in the cache.
+    const std::size_t capacity;
+
+    /// The estimated number of bytes held by the substances in the cache.
+    mutable std::size_t numCachedBytes = 0;
+
+    /// The cached substances and their indices, from the most to the least recently used.
+    mutable std::list<std::pair<Index, Substance>> recent;
+
+    /// The position in `recent` of each cached substance.
+    mutable std::unordered_map<Index, std::list<std::pair<Index, Substance>>::iterator> cached;
+
+    /// The mutex protecting the file and the cache.
+    mutable std::mutex mutex;
+
+    /// Construct a LazySubstances::Impl object.
+    Impl(const std::string& path, std::size_t capacity, const std::string& indexPath)
+    : file(path, std::ios::binary), capacity(capacity)
+    {
+        error(!file, "Could not open the file `", path, "`.");
+        const auto stamp = fileStamp(path);
+        if(indexPath.empty() || !readIndex(indexPath, stamp))
+        {
+            buildIndex();
+            if(!indexPath.empty())
+                writeIndex(indexPath, stamp);
+        }
+        for(auto i = 0u; i < names.size(); ++i)
+            indexOfName.emplace(names[i], i);
+    }
+
+    /// Scan the file for its records and their names, reading the names from the text of the records without parsing them.
+    auto buildIndex() -> void
+    {
+        std::stringstream ss;
+        ss << file.rdbuf();
+        const auto text = ss.str();
+        const auto spans = yamlRecordSpans(text);
+        error(spans.begins.empty() && text.find_first_not_of(" \t\r\n") != std::string::npos,
+            "Could not index the substances in a YAML file that is not a block sequence.");
+        records.reserve(spans.begins.size());
+        names.reserve(spans.begins.size());
+        for(auto i = 0u; i < spans.begins.size(); ++i)
+        {
+            const auto record = RecordLocation{ spans.begins[i], spans.ends[i] - spans.begins[i] };
+            auto name = yamlRecordValue(std::string_view(text).substr(record.offset, record.length), "name");
+            error(!name, "Could not index a substance without name at offset ", record.offset, ".");
+            records.push_back(record);
+            names.push_back(std::move(*name));
+        }
+    }
+
+    /// Read the index from a file saved for the same version of the YAML file, returning false if there is none.
+    auto readIndex(const std::string& indexPath, const std::string& stamp) -> bool
+    {
+        std::ifstream in(indexPath);
+        std::string signature, version, header;
+        if(!(in >> signature >> version) || signature != indexSignature || version != std::to_string(indexVersion))
+            return false;
+        if(!std::getline(in, header) || header != " " + stamp)
+            return false;
+        RecordLocation record;
+        std::string name;
+        while(in >> record.offset >> record.length && in.get() == ' ' && std::getline(in, name))
+        {
+            records.push_back(record);
+            names.push_back(std::move(name));
+        }
+        if(!in.eof())
+        {
+            records.clear();
+            names.clear();
+            return false;
+        }
+        return true;
+    }
+
+    /// Save the index to a file (failures are ignored, since the index can always be built again).
+    auto writeIndex(const std::string& indexPath, const std::string& stamp) const -> void
+    {
+        for(const auto& name : names)
+            if(name.find('\n') != std::string::npos)
+                return; // names with line breaks cannot be saved in the line-based format
+        std::ofstream out(indexPath + ".tmp");
+        out << indexSignature << ' ' << indexVersion << ' ' << stamp << '\n';
+        for(auto i = 0u; i < records.size(); ++i)
+            out << records[i].offset << ' ' << records[i].length << ' ' << names[i] << '\n';
+        out.close();
+        std::error_code ec;
+        if(out)
+            std::filesystem::rename(indexPath + ".tmp", indexPath, ec);
+    }
+
+    /// Return the substance with given index from the cache, deserializing it if needed.
+    auto get(Index index) const -> Substance
+    {
+        error(index < 0 || std::size_t(index) >= records.size(), "Could not get the substance with index ", index, " from a file with ", records.size(), " substances.");
+        std::lock_guard lock(mutex);
+
+        const auto it = cached.find(index);
+        ATOMIK_CACHE(Cache::LazySubstances, it != cached.end());
+        if(it != cached.end())
+        {
+            recent.splice(recent.begin(), recent, it->second);
+            return it->second->second;
+        }
+
+        const auto& record = records[index];
+        std::string text(record.length, '\0');
+        file.clear();
+        file.seekg(record.offset);
+        file.read(text.data(), text.size());
+        error(!file, "Could not read the substance `", names[index], "` from its file.");
+        auto substance = YAML::Load(text).as<Substances>()[0];
+
+        // Evict the least recently used substances, always keeping the one just read
+        const auto size = estimatedSize(substance);
+        while(!recent.empty() && numCachedBytes + size > capacity)
+        {
+            numCachedBytes -= estimatedSize(recent.back().second);
+            cached.erase(recent.back().first);
+            recent.pop_back();
+        }
+        recent.emplace_front(index, substance);
+        cached.emplace(index, recent.begin());
+        numCachedBytes += size;
+        return substance;
+    }
+};
+
+LazySubstances::LazySubstances(const std::string& path, std::size_t capacity, const std::string& indexPath)
+: pimpl(allocateShared<Impl>(path, capacity, indexPath))
+{}
+
+auto LazySubstances::size() const -> std::size_t
+{
+    return pimpl->records.size();
+}
+
+auto LazySubstances::capacity() const -> std::size_t
+{
+    return pimpl->capacity;
+}
+
+auto LazySubstances::numCached() const -> std::size_t
+{
+    std::lock_guard lock(pimpl->mutex);
+    return pimpl->cached.size();
+}
+
+auto LazySubstances::numCachedBytes() const -> std::size_t
+{
+    std::lock_guard lock(pimpl->mutex);
+    return pimpl->numCachedBytes;
+}
+
+auto LazySubstances::indexWithName(std::string_view name) const -> Index
+{
+    const auto it = pimpl->indexOfName.find(name);
+    return it != pimpl->indexOfName.end() ? it->second : size();
+}
+
+auto LazySubstances::operator[](Index index) const -> Substance
+{
+    return pimpl->get(index);
+}
+
+auto LazySubstances::getWithName(std::string_view name) const -> Substance
+{
+    const auto index = indexWithName(name);
+    error(std::size_t(index) >= size(), "Could not find a substance with the given name `", name, "`.");
+    return pimpl->get(index);
+}
+
+auto LazySubstances::withNames(const StringList& names) const -> Substances
+{
+    std::vector<Substance> selected;
+    selected.reserve(names.size());
+    for(const auto& name : names)
+        selected.push_back(getWithName(name));
+    return Substances(std::move(selected));
+}
+
+} // namespace Atomik
@@ -0,0 +1,87 @@
+// Atomik is a library that implements basic chemical concepts such as elements, substances, and reactions.
+//
+// Copyright (C) 2018-2019 Allan Leal and Reaktoro Contributors
+//
+// This library is free software; you can redistribute it and/or
+// modify it under the terms of the GNU Lesser General Public
+// License as published by the Free Software Foundation; either
+// version 2.1 of the License, or (at your option) any later version.
+//
+// This library is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+// Lesser General Public License for more details.
+//
+// You should have received a copy of the GNU Lesser General Public License
+// along with this library. If not, see <http://www.gnu.org/licenses/>.
+
+#pragma once
+
+// C++ includes
+#include <memory>
+#include <string>
+#include <string_view>
+
+// Atomik includes
+#include <Atomik/Index.hpp>
+#include <Atomik/StringList.hpp>
+#include <Atomik/Substances.hpp>
+
+namespace Atomik {
+
+/// A type used to access the substances of a large YAML file without deserializing all of them.
+/// On construction, the file is scanned for the offsets of its records and the names in them (or this
+/// index is read from a previously saved index file). A substance is deserialized only when first
+/// requested, and the most recently used ones are kept in a cache whose capacity is a number of bytes, compared
+/// against an estimate of the memory held by each deserialized substance:
+/// ~~~
+/// using namespace Atomik;
+/// LazySubstances substances("species.yml", 4 << 20);
+/// auto water = substances.getWithName("H2O(aq)");
+/// auto selected = substances.withNames({"H+", "OH-", "HCO3-"});
+/// ~~~
+/// The file must be a top-level block sequence of substances and must not change while in use.
+class LazySubstances
+{
+public:
+    /// Construct a LazySubstances object for a given YAML file of substances.
+    /// @param path The path to the YAML file of substances.
+    /// @param capacity The maximum estimated number of bytes held by the deserialized substances in the cache (the most recently used one is always kept).
+    /// @param indexPath The path to a file where the index of records is saved and read from later (if empty, the index is not saved).
+    /// @throw std::runtime_error When the file cannot be read or is not a block sequence of records with names.
+    explicit LazySubstances(const std::string& path, std::size_t capacity = 16 << 20, const std::string& indexPath = "");
+
+    /// Return the number of substances in the file.
+    auto size() const -> std::size_t;
+
+    /// Return the maximum estimated number of bytes held by the deserialized substances in the cache.
+    auto capacity() const -> std::size_t;
+
+    /// Return the number of deserialized substances currently in the cache.
+    auto numCached() const -> std::size_t;
+
+    /// Return the estimated number of bytes held by the deserialized substances currently in the cache.
+    auto numCachedBytes() const -> std::size_t;
+
+    /// Return the index of the first substance with given name.
+    /// If there is no substance with given name, return number of substances.
+    auto indexWithName(std::string_view name) const -> Index;
+
+    /// Return the substance with given index, deserializing it if not in the cache.
+    auto operator[](Index index) const -> Substance;
+
+    /// Return the first substance with given name, deserializing it if not in the cache.
+    /// @throw std::runtime_error When there is no substance with given name.
+    auto getWithName(std::string_view name) const -> Substance;
+
+    /// Return the substances with given names, deserializing those not in the cache.
+    /// @throw std::runtime_error When there is no substance with one of the given names.
+    auto withNames(const StringList& names) const -> Substances;
+
+private:
+    struct Impl;
+
+    std::shared_ptr<Impl> pimpl;
+};
+
+} // namespace Atomik
@@ -0,0 +1,161 @@
+// Atomik is a library that implements basic chemical concepts such as elements, substances, and reactions.
+//
+// Copyright (C) 2018-2019 Allan Leal and Reaktoro Contributors
+//
+// This library is free software; you can redistribute it and/or
+// modify it under the terms of the GNU Lesser General Public
+// License as published by the Free Software Foundation; either
+// version 2.1 of the License, or (at your option) any later version.
+//
+// This library is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+// Lesser General Public License for more details.
+//
+// You should have received a copy of the GNU Lesser General Public License
+// along with this library. If not, see <http://www.gnu.org/licenses/>.
+// Catch includes
+#include <catch2/catch.hpp>
+
+// C++ includes
+#include <algorithm>
+#include <cstdint>
+#include <filesystem>
+#include <fstream>
+#include <vector>
+
+// Atomik includes
+#include <Atomik/LazySubstances.hpp>
+#include <Atomik/StreamingWriter.hpp>
+using namespace Atomik;
+
+TEST_CASE("Testing LazySubstances", "[LazySubstances]")
+{
+    namespace fs = std::filesystem;
+
+    const auto directory = fs::temp_directory_path() / "LazySubstances.test";
+    const auto path = (directory / "substances.yml").string();
+    const auto indexPath = (directory / "substances.index").string();
+    fs::remove_all(directory);
+    fs::create_directories(directory);
+
+    const Substances substances({
+        Substance("H2O").replaceName("H2O(aq)").replaceTags({"aqueous", "neutral"}),
+        Substance("HCO3-").replaceName("HCO3-(aq)").replaceTags({"aqueous", "charged"}),
+        Substance("CaCO3").replaceName("Calcite").replaceTags({"mineral"}),
+        Substance("CO2").replaceName("CO2(g)").replaceTags({"gaseous"}),
+        Substance("Na+").replaceName("Na+ (sodium ion)").replaceTags({"aqueous", "charged"}),
+    });
+
+    {
+        std::ofstream out(path);
+        writeYAML(out, substances);
+    }
+
+    SECTION("Testing access by name with eviction")
+    {
+        // The capacity fits the two largest substances read below
+        LazySubstances probe(path, SIZE_MAX);
+        std::vector<std::size_t> sizes;
+        for(auto name : {"H2O(aq)", "Na+ (sodium ion)", "CO2(g)"})
+        {
+            const auto before = probe.numCachedBytes();
+            probe.getWithName(name);
+            sizes.push_back(probe.numCachedBytes() - before);
+        }
+        std::sort(sizes.begin(), sizes.end());
+        const auto capacity = sizes[1] + sizes[2];
+
+        LazySubstances lazy(path, capacity);
+        REQUIRE(lazy.size() == substances.size());
+        REQUIRE(lazy.capacity() == capacity);
+        REQUIRE(lazy.numCached() == 0);
+        REQUIRE(lazy.numCachedBytes() == 0);
+
+        REQUIRE(lazy.indexWithName("Calcite") == 2);
+        REQUIRE(lazy.indexWithName("Quartz") == Index(lazy.size()));
+        REQUIRE(lazy.numCached() == 0);
+
+        REQUIRE(lazy.getWithName("Calcite") == substances[2]);
+        REQUIRE(lazy.numCached() == 1);
+        REQUIRE(lazy.getWithName("Calcite") == substances[2]);
+        REQUIRE(lazy.numCached() == 1);
+
+        const auto selected = lazy.withNames({"H2O(aq)", "Na+ (sodium ion)", "CO2(g)"});
+        REQUIRE(selected.size() == 3);
+        REQUIRE(selected[0] == substances[0]);
+        REQUIRE(selected[1] == substances[4]);
+        REQUIRE(selected[2] == substances[3]);
+        REQUIRE(lazy.numCached() == 2);
+        REQUIRE(lazy.numCachedBytes() <= capacity);
+
+        for(auto i = 0u; i < lazy.size(); ++i)
+            REQUIRE(lazy[i] == substances[i]);
+        REQUIRE(lazy.numCached() >= 1);
+        REQUIRE(lazy.numCachedBytes() <= capacity);
+
+        // The most recently used substance is kept even when it does not fit
+        LazySubstances tiny(path, 1);
+        REQUIRE(tiny.getWithName("Calcite") == substances[2]);
+        REQUIRE(tiny.getWithName("CO2(g)") == substances[3]);
+        REQUIRE(tiny.numCached() == 1);
+        REQUIRE(tiny.numCachedBytes() > tiny.capacity());
+
+        REQUIRE_THROWS(lazy.getWithName("Quartz"));
+        REQUIRE_THROWS(lazy.withNames({"H2O(aq)", "Quartz"}));
+        REQUIRE_THROWS(lazy[lazy.size()]);
+    }
+
+    SECTION("Testing the saved index")
+    {
+        LazySubstances built(path, 8, indexPath);
+        REQUIRE(fs::exists(indexPath));
+
+        LazySubstances read(path, 8, indexPath);
+        REQUIRE(read.size() == substances.size());
+        for(auto i = 0u; i < substances.size(); ++i)
+            REQUIRE(read.getWithName(substances[i].name().view()) == substances[i]);
+
+        // A stale index is built again when the file changes
+        {
+            std::ofstream out(path);
+            writeYAML(out, Substances({ Substance("O2").replaceName("O2(g)").replaceTags({}) }));
+        }
+        fs::last_write_time(path, fs::last_write_time(path) + std::chrono::seconds(1));
+        LazySubstances changed(path, 8, indexPath);
+        REQUIRE(changed.size() == 1);
+        REQUIRE(changed.getWithName("O2(g)").formula().formula() == "O2");
+    }
+
+    SECTION("Testing the names read from hand-written records")
+    {
+        {
+            std::ofstream out(path);
+            out << "# substances\n"
+                   "- name: 'Quartz (alpha)'  # a quoted name\n"
+                   "  formula: {formula: SiO2, symbols: [Si, O], coefficients: [1, 2]}\n"
+                   "  tags: [mineral]\n"
+                   "-\n"
+                   "  formula:\n"
+                   "    formula: H2O\n"
+                   "    symbols: [H, O]\n"
+                   "    coefficients: [2, 1]\n"
+                   "  name: H2O(aq) # a plain name after the formula\n"
+                   "  tags: []\n";
+        }
+        LazySubstances lazy(path);
+        REQUIRE(lazy.size() == 2);
+        REQUIRE(lazy.getWithName("Quartz (alpha)").hasTag("mineral"));
+        REQUIRE(lazy.getWithName("H2O(aq)").formula().formula() == "H2O");
+
+        {
+            std::ofstream out(path);
+            out << "- formula: {formula: H2O, symbols: [H, O], coefficients: [2, 1]}\n  tags: []\n";
+        }
+        REQUIRE_THROWS(LazySubstances(path));
+    }
+
+    REQUIRE_THROWS(LazySubstances((directory / "missing.yml").string()));
+
+    fs::remove_all(directory);
+}
@@ -0,0 +1,85 @@
+// Atomik is a library that implements basic chemical concepts such as elements, substances, and reactions.
+//
+// Copyright (C) 2018-2019 Allan Leal and Reaktoro Contributors
+//
+// This library is free software; you can redistribute it and/or
+// modify it under the terms of the GNU Lesser General Public
+// License as published by the Free Software Foundation; either
+// version 2.1 of the License, or (at your option) any later version.
+//
+// This library is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+// Lesser General Public License for more details.
+//
+// You should have received a copy of the GNU Lesser General Public License
+// along with this library. If not, see <http://www.gnu.org/licenses/>.
+
+#include "MappedFile.hpp"
+
+// C++ includes
+#include <fstream>
+
+// POSIX includes
+#if defined(__unix__) || defined(__APPLE__)
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#define ATOMIK_USE_MMAP
+#endif
+
+// Atomik includes
+#include <Atomik/Exception.hpp>
+
+namespace Atomik {
+
+MappedFile::MappedFile(const std::string& path)
+{
+#ifdef ATOMIK_USE_MMAP
+    const auto fd = open(path.c_str(), O_RDONLY | O_CLOEXEC);
+    error(fd < 0, "Could not open the file `", path, "`.");
+    struct stat status;
+    const auto statted = fstat(fd, &status) == 0;
+    m_size = statted ? status.st_size : 0;
+    void* mapped = statted && m_size > 0 ? mmap(nullptr, m_size, PROT_READ, MAP_SHARED, fd, 0) : nullptr;
+    close(fd);
+    error(!statted || mapped == MAP_FAILED, "Could not map the file `", path, "`.");
+    m_data = static_cast<const char*>(mapped);
+    m_mapped = mapped != nullptr;
+#else
+    std::ifstream file(path, std::ios::binary | std::ios::ate);
+    error(!file, "Could not open the file `", path, "`.");
+    m_size = file.tellg();
+    m_buffer.reset(new std::uint64_t[(m_size + 7) / 8]);
+    file.seekg(0);
+    file.read(reinterpret_cast<char*>(m_buffer.get()), m_size);
+    error(!file, "Could not read the file `", path, "`.");
+    m_data = reinterpret_cast<const char*>(m_buffer.get());
+#endif
+}
+
+MappedFile::~MappedFile()
+{
+#ifdef ATOMIK_USE_MMAP
+    if(m_mapped)
+        munmap(const_cast<char*>(m_data), m_size);
+#endif
+}
+
+auto MappedFile::data() const -> const char*
+{
+    return m_data;
+}
+
+auto MappedFile::size() const -> std::size_t
+{
+    return m_size;
+}
+
+auto MappedFile::view() const -> std::string_view
+{
+    return { m_data, m_size };
+}
+
+} // namespace Atomik
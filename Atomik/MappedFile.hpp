@@ -0,0 +1,68 @@
+// Atomik is a library that implements basic chemical concepts such as elements, substances, and reactions.
+//
+// Copyright (C) 2018-2019 Allan Leal and Reaktoro Contributors
+//
+// This library is free software; you can redistribute it and/or
+// modify it under the terms of the GNU Lesser General Public
+// License as published by the Free Software Foundation; either
+// version 2.1 of the License, or (at your option) any later version.
+//
+// This library is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+// Lesser General Public License for more details.
+//
+// You should have received a copy of the GNU Lesser General Public License
+// along with this library. If not, see <http://www.gnu.org/licenses/>.
+
+#pragma once
+
+// C++ includes
+#include <cstdint>
+#include <memory>
+#include <string>
+#include <string_view>
+
+namespace Atomik {
+
+/// A type used to access the contents of a read-only file mapped into memory.
+/// Where memory mapping is not available, the file is read into a buffer instead.
+/// In both cases, the contents are aligned to 8 bytes.
+class MappedFile
+{
+public:
+    /// Construct a MappedFile object mapping a given file.
+    /// @throw std::runtime_error When the file cannot be opened or mapped.
+    explicit MappedFile(const std::string& path);
+
+    /// Destroy this MappedFile object, unmapping the file.
+    ~MappedFile();
+
+    MappedFile(const MappedFile&) = delete;
+
+    auto operator=(const MappedFile&) -> MappedFile& = delete;
+
+    /// Return the start of the contents of the file.
+    auto data() const -> const char*;
+
+    /// Return the size of the file.
+    auto size() const -> std::size_t;
+
+    /// Return the contents of the file.
+    auto view() const -> std::string_view;
+
+private:
+    /// The start of the mapped file.
+    const char* m_data = nullptr;
+
+    /// The size of the mapped file.
+    std::size_t m_size = 0;
+
+    /// True if the contents are mapped (false if read into `m_buffer`).
+    bool m_mapped = false;
+
+    /// The contents of the file, read into memory where memory mapping is not available.
+    std::unique_ptr<std::uint64_t[]> m_buffer;
+};
+
+} // namespace Atomik
@@ -0,0 +1,53 @@
+// Atomik is a library that implements basic chemical concepts such as elements, substances, and reactions.
+//
+// Copyright (C) 2018-2019 Allan Leal and Reaktoro Contributors
+//
+// This library is free software; you can redistribute it and/or
+// modify it under the terms of the GNU Lesser General Public
+// License as published by the Free Software Foundation; either
+// version 2.1 of the License, or (at your option) any later version.
+//
+// This library is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+// Lesser General Public License for more details.
+//
+// You should have received a copy of the GNU Lesser General Public License
+// along with this library. If not, see <http://www.gnu.org/licenses/>.
+
+// Catch includes
+#include <catch2/catch.hpp>
+
+// C++ includes
+#include <filesystem>
+#include <fstream>
+
+// Atomik includes
+#include <Atomik/MappedFile.hpp>
+using namespace Atomik;
+
+TEST_CASE("Testing MappedFile", "[MappedFile]")
+{
+    const auto path = (std::filesystem::temp_directory_path() / "atomik-mapped-file-test.txt").string();
+
+    std::ofstream(path, std::ios::binary) << "name,formula\nH2O(aq),H2O\n";
+
+    {
+        const MappedFile file(path);
+        REQUIRE(file.size() == 25);
+        REQUIRE(file.view() == "name,formula\nH2O(aq),H2O\n");
+        REQUIRE(reinterpret_cast<std::uintptr_t>(file.data()) % 8 == 0);
+    }
+
+    std::ofstream(path, std::ios::binary | std::ios::trunc);
+
+    {
+        const MappedFile file(path);
+        REQUIRE(file.size() == 0);
+        REQUIRE(file.view().empty());
+    }
+
+    std::filesystem::remove(path);
+
+    REQUIRE_THROWS(MappedFile(path));
+}
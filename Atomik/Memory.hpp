@@ -0,0 +1,86 @@
+// Atomik is a library that implements basic chemical concepts such as elements, substances, and reactions.
+//
+// Copyright (C) 2018-2019 Allan Leal and Reaktoro Contributors
+//
+// This library is free software; you can redistribute it and/or
+// modify it under the terms of the GNU Lesser General Public
+// License as published by the Free Software Foundation; either
+// version 2.1 of the License, or (at your option) any later version.
+//
+// This library is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+// Lesser General Public License for more details.
+//
+// You should have received a copy of the GNU Lesser General Public License
+// along with this library. If not, see <http://www.gnu.org/licenses/>.
+
+#pragma once
+
+// C++ includes
+#include <memory>
+#include <memory_resource>
+
+namespace Atomik {
+
+/// Return the memory resource used to allocate the internal state of Atomik objects in the current thread.
+/// This is the resource set by the innermost active MemoryResourceScope in the current
+/// thread or `std::pmr::get_default_resource()` if there is none.
+auto memoryResource() -> std::pmr::memory_resource*;
+
+/// A type used to allocate the internal state of Atomik objects from a given memory resource.
+/// While an object of this type is alive, every Element, Substance, SubstanceFormula and
+/// SubstanceElements object created in the same thread allocates its internal state, together
+/// with its reference count and its vectors, from the given memory resource. So does every
+/// Elements and Substances object for its vector. This permits a whole database to be created
+/// in a single arena and released with it, as shown below:
+/// ~~~
+/// using namespace Atomik;
+/// std::pmr::monotonic_buffer_resource arena;
+/// {
+///     MemoryResourceScope scope(&arena);
+///     Substances substances = yaml(input);
+///     // ... use substances
+/// }
+/// ~~~
+/// The memory resource must outlive all objects allocated from it, including their copies.
+///
+/// A copy allocates from the memory resource of the thread and scope in which it is made, while
+/// a moved object keeps the memory resource of its source. The names, symbols and tags are
+/// interned strings (see InternedString.hpp), which are stored once in a global pool shared by
+/// all databases instead. The indexes of a Database object and the temporaries of parsing and
+/// loading use the global heap.
+///
+/// The memory resource is selected per thread. The worker threads of ParallelLoader, CSVImporter
+/// and AsyncDatabase use the memory resource of the thread that started them. Any other thread,
+/// including the watching thread of ReloadableDatabase, uses the default memory resource unless
+/// it creates its own MemoryResourceScope object.
+class MemoryResourceScope
+{
+public:
+    /// Construct a MemoryResourceScope object with given memory resource.
+    explicit MemoryResourceScope(std::pmr::memory_resource* resource);
+
+    /// Destroy this MemoryResourceScope object and restore the previous memory resource.
+    ~MemoryResourceScope();
+
+    /// Disable copy construction of MemoryResourceScope objects.
+    MemoryResourceScope(const MemoryResourceScope&) = delete;
+
+    /// Disable copy assignment of MemoryResourceScope objects.
+    auto operator=(const MemoryResourceScope&) -> MemoryResourceScope& = delete;
+
+private:
+    /// The memory resource active before this scope was created.
+    std::pmr::memory_resource* previous;
+};
+
+/// Construct a shared object of type T allocated from the current memory resource.
+/// The object and its control block are allocated in a single block of memory.
+template <typename T, typename... Args>
+auto allocateShared(Args&&... args) -> std::shared_ptr<T>
+{
+    return std::allocate_shared<T>(std::pmr::polymorphic_allocator<T>(memoryResource()), std::forward<Args>(args)...);
+}
+
+} // namespace Atomik
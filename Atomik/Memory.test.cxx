@@ -0,0 +1,186 @@
+// Atomik is a library that implements basic chemical concepts such as elements, substances, and reactions.
+//
+// Copyright (C) 2018-2019 Allan Leal and Reaktoro Contributors
+//
+// This library is free software; you can redistribute it and/or
+// modify it under the terms of the GNU Lesser General Public
+// License as published by the Free Software Foundation; either
+// version 2.1 of the License, or (at your option) any later version.
+//
+// This library is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+// Lesser General Public License for more details.
+//
+// You should have received a copy of the GNU Lesser General Public License
+// along with this library. If not, see <http://www.gnu.org/licenses/>.
+
+// Catch includes
+#include <catch2/catch.hpp>
+
+// C++ includes
+#include <atomic>
+#include <cstddef>
+#include <optional>
+
+// Atomik includes
+#include <Atomik/AllocationCounter.test.hpp>
+#include <Atomik/Elements.hpp>
+#include <Atomik/Memory.hpp>
+#include <Atomik/ParallelLoader.hpp>
+#include <Atomik/StringList.hpp>
+#include <Atomik/Substance.hpp>
+#include <Atomik/Substances.hpp>
+using namespace Atomik;
+
+namespace {
+
+/// A memory resource that counts the allocations made through it.
+class CountingResource : public std::pmr::memory_resource
+{
+public:
+    std::atomic<std::size_t> allocations = 0;
+    std::atomic<std::size_t> deallocations = 0;
+
+private:
+    auto do_allocate(std::size_t bytes, std::size_t alignment) -> void* override
+    {
+        ++allocations;
+        return std::pmr::new_delete_resource()->allocate(bytes, alignment);
+    }
+
+    auto do_deallocate(void* p, std::size_t bytes, std::size_t alignment) -> void override
+    {
+        ++deallocations;
+        std::pmr::new_delete_resource()->deallocate(p, bytes, alignment);
+    }
+
+    auto do_is_equal(const std::pmr::memory_resource& other) const noexcept -> bool override
+    {
+        return this == &other;
+    }
+};
+
+} // namespace
+
+TEST_CASE("Testing MemoryResourceScope", "[Memory]")
+{
+    CountingResource resource;
+
+    REQUIRE(memoryResource() == std::pmr::get_default_resource());
+
+    {
+        MemoryResourceScope scope(&resource);
+
+        REQUIRE(memoryResource() == &resource);
+
+        Substances substances("H2O CO2 Na+ Cl-");
+
+        REQUIRE(resource.allocations > 0);
+        REQUIRE(substances.size() == 4);
+        REQUIRE(substances[0].molarMass() == Approx(0.01801528));
+        REQUIRE(substances[3].charge() == -1);
+    }
+
+    REQUIRE(memoryResource() == std::pmr::get_default_resource());
+    REQUIRE(resource.allocations == resource.deallocations);
+
+    std::pmr::monotonic_buffer_resource arena;
+    std::size_t allocations = resource.allocations;
+
+    {
+        MemoryResourceScope outer(&resource);
+        {
+            MemoryResourceScope inner(&arena);
+            Substance substance("CaCO3");
+            REQUIRE(substance.molarMass() == Approx(0.1000869));
+        }
+        REQUIRE(memoryResource() == &resource);
+    }
+
+    REQUIRE(resource.allocations == allocations);
+}
+
+TEST_CASE("Testing MemoryResourceScope in worker threads", "[Memory]")
+{
+    CountingResource resource;
+
+    std::string text;
+    for(auto i = 0; i < 8; ++i)
+        text += "- name: S" + std::to_string(i) + "\n"
+                "  formula:\n"
+                "    formula: H2O\n"
+                "    symbols: [H, O]\n"
+                "    coefficients: [2, 1]\n"
+                "  tags: []\n";
+
+    {
+        MemoryResourceScope scope(&resource);
+
+        // Every substance loaded by the worker threads allocates at least its internal state from the resource
+        const auto substances = parallelLoadSubstancesYAML(text, 4);
+
+        REQUIRE(substances.size() == 8);
+        REQUIRE(resource.allocations >= 8 * 4);
+    }
+
+    REQUIRE(resource.allocations == resource.deallocations);
+}
+
+TEST_CASE("Testing MemoryResourceScope without a heap fallback", "[Memory]")
+{
+    const StringList formulas = "H2O CO2 CaCO3 Na+ Cl- (NH4)2Fe(SO4)2.6H2O";
+
+    auto build = [&]()
+    {
+        Substance::Args args;
+        args.name = "Calcite";
+        args.formula = SubstanceFormula("CaCO3");
+        args.elements = Substance("CaCO3").elements();
+        args.type = "mineral";
+        args.tags = { "carbonate", "mineral" };
+
+        Substances substances(formulas);
+        substances.append(Substance(args));
+        return substances;
+    };
+
+    // Build the database once so that its strings are interned and the default elements created on the heap beforehand
+    build();
+
+    // An arena that cannot grow, so that any allocation beyond its buffer throws
+    alignas(std::max_align_t) static std::byte buffer[1 << 16];
+    std::pmr::monotonic_buffer_resource arena(buffer, sizeof(buffer), std::pmr::null_memory_resource());
+
+    MemoryResourceScope scope(&arena);
+
+    std::optional<Elements> elements;
+    std::optional<Substances> substances;
+
+    // Every container kept by the database comes from the arena, so the heap only sees temporaries
+    const auto built = countAllocations([&]()
+    {
+        elements = Elements::PeriodicTable().withSymbols("H C O Na Cl");
+        substances = build();
+        *substances = substances->withTag("mineral");
+    });
+    REQUIRE(built.allocations == built.deallocations);
+
+    REQUIRE(elements->size() == 5);
+    REQUIRE(elements->data().get_allocator().resource() == &arena);
+    REQUIRE(substances->size() == 1);
+    REQUIRE(substances->data().get_allocator().resource() == &arena);
+    REQUIRE((*substances)[0].molarMass() == Approx(0.1000869));
+    REQUIRE((*substances)[0].tags().get_allocator().resource() == &arena);
+    REQUIRE((*substances)[0].formula().symbols().get_allocator().resource() == &arena);
+    REQUIRE((*substances)[0].elements().coefficients().get_allocator().resource() == &arena);
+    REQUIRE((*substances)[0].elements().elements().data().get_allocator().resource() == &arena);
+
+    // Destroying the database returns nothing to the heap
+    const auto released = countAllocations([&]()
+    {
+        substances.reset();
+        elements.reset();
+    });
+    REQUIRE(released.deallocations == 0);
+}
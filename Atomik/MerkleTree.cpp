@@ -0,0 +1,261 @@
+// Atomik is a library that implements basic chemical concepts such as elements, substances, and reactions.
+//
+// Copyright (C) 2018-2019 Allan Leal and Reaktoro Contributors
+//
+// This library is free software; you can redistribute it and/or
+// modify it under the terms of the GNU Lesser General Public
+// License as published by the Free Software Foundation; either
+// version 2.1 of the License, or (at your option) any later version.
+//
+// This library is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+// Lesser General Public License for more details.
+//
+// You should have received a copy of the GNU Lesser General Public License
+// along with this library. If not, see <http://www.gnu.org/licenses/>.
+
+#include "MerkleTree.hpp"
+
+// C++ includes
+#include <algorithm>
+#include <cstring>
+
+// Atomik includes
+#include <Atomik/BinaryDatabase.hpp>
+#include <Atomik/Elements.hpp>
+#include <Atomik/Substances.hpp>
+
+namespace Atomik {
+namespace {
+
+/// The number of children of each node of the tree.
+constexpr unsigned fanout = 16;
+
+/// The number of key hash bits selecting a child of a node.
+constexpr unsigned bitsPerLevel = 4;
+
+/// Return a well-mixed 64-bit value (the finalizer of SplitMix64).
+auto mix(std::uint64_t x) -> std::uint64_t
+{
+    x ^= x >> 30;
+    x *= 0xbf58476d1ce4e5b9ull;
+    x ^= x >> 27;
+    x *= 0x94d049bb133111ebull;
+    return x ^ (x >> 31);
+}
+
+/// Return the hash contributed to the nodes of the tree by a record.
+auto leafHash(std::uint64_t keyHash, std::uint64_t hash) -> std::uint64_t
+{
+    return mix(keyHash ^ mix(hash));
+}
+
+/// Return the prefix of a key hash at a given level of the tree.
+auto prefixOf(std::uint64_t keyHash, unsigned level) -> std::uint64_t
+{
+    return level ? keyHash >> (64 - bitsPerLevel * level) : 0;
+}
+
+/// Return the identifier of a node in the tree.
+auto nodeId(unsigned level, std::uint64_t prefix) -> std::uint64_t
+{
+    return (prefix << 3) | level;
+}
+
+/// A type used to build the canonical bytes of a record whose hash is computed.
+class HashInput
+{
+public:
+    /// Append a string followed by a separator.
+    auto string(std::string_view str) -> HashInput&
+    {
+        m_bytes.append(str);
+        m_bytes.push_back('\0');
+        return *this;
+    }
+
+    /// Append the bytes of a number.
+    template<typename T>
+    auto number(T value) -> HashInput&
+    {
+        char bytes[sizeof(T)];
+        std::memcpy(bytes, &value, sizeof(T));
+        m_bytes.append(bytes, sizeof(T));
+        return *this;
+    }
+
+    /// Return the hash of the appended bytes.
+    auto hash() const -> std::uint64_t
+    {
+        return BinaryFormat::hash(m_bytes);
+    }
+
+private:
+    /// The appended bytes.
+    std::string m_bytes;
+};
+
+} // namespace
+
+auto contentHash(const Element& element) -> std::uint64_t
+{
+    HashInput input;
+    input.string(element.symbol().view()).string(element.name().view());
+    input.number(std::uint64_t(element.atomicNumber())).number(element.atomicWeight()).number(element.electronegativity());
+    input.number(std::uint64_t(element.tags().size()));
+    for(const auto& tag : element.tags())
+        input.string(tag.view());
+    return input.hash();
+}
+
+auto contentHash(const Substance& substance) -> std::uint64_t
+{
+    // The composition is sorted, since the order of the symbols in a formula is not significant
+    const auto& formula = substance.formula();
+    std::vector<std::pair<std::string_view, double>> composition;
+    composition.reserve(formula.symbols().size());
+    for(auto i = 0u; i < formula.symbols().size(); ++i)
+        composition.emplace_back(formula.symbols()[i].view(), formula.coefficients()[i]);
+    std::sort(composition.begin(), composition.end());
+
+    HashInput input;
+    input.string(substance.name().view()).string(substance.formula().formula()).string(substance.type().view());
+    input.number(std::uint64_t(composition.size()));
+    for(const auto& [symbol, coefficient] : composition)
+        input.string(symbol).number(coefficient);
+    input.number(std::uint64_t(substance.tags().size()));
+    for(const auto& tag : substance.tags())
+        input.string(tag.view());
+    return input.hash();
+}
+
+MerkleTree::MerkleTree()
+{}
+
+MerkleTree::MerkleTree(const Elements& elements)
+{
+    for(const auto& element : elements)
+        insert(element.symbol().view(), contentHash(element));
+}
+
+MerkleTree::MerkleTree(const Substances& substances)
+{
+    for(const auto& substance : substances)
+        insert(substance.name().view(), contentHash(substance));
+}
+
+auto MerkleTree::insert(std::string_view key, std::uint64_t hash) -> void
+{
+    const auto keyHash = BinaryFormat::hash(key);
+    auto& records = m_buckets[prefixOf(keyHash, depth)];
+    const auto iter = std::find_if(records.begin(), records.end(), [&](const Record& record) { return record.key == key; });
+    if(iter != records.end())
+    {
+        propagate(keyHash, -leafHash(keyHash, iter->hash));
+        iter->hash = hash;
+    }
+    else
+    {
+        records.push_back({ std::string(key), keyHash, hash });
+        ++m_size;
+    }
+    propagate(keyHash, leafHash(keyHash, hash));
+}
+
+auto MerkleTree::erase(std::string_view key) -> bool
+{
+    const auto keyHash = BinaryFormat::hash(key);
+    const auto bucketIter = m_buckets.find(prefixOf(keyHash, depth));
+    if(bucketIter == m_buckets.end())
+        return false;
+    auto& records = bucketIter->second;
+    const auto iter = std::find_if(records.begin(), records.end(), [&](const Record& record) { return record.key == key; });
+    if(iter == records.end())
+        return false;
+    propagate(keyHash, -leafHash(keyHash, iter->hash));
+    records.erase(iter);
+    if(records.empty())
+        m_buckets.erase(bucketIter);
+    --m_size;
+    return true;
+}
+
+auto MerkleTree::find(std::string_view key) const -> std::optional<std::uint64_t>
+{
+    for(const auto& record : bucket(prefixOf(BinaryFormat::hash(key), depth)))
+        if(record.key == key)
+            return record.hash;
+    return {};
+}
+
+auto MerkleTree::size() const -> std::size_t
+{
+    return m_size;
+}
+
+auto MerkleTree::root() const -> std::uint64_t
+{
+    return node(0, 0);
+}
+
+auto MerkleTree::node(unsigned level, std::uint64_t prefix) const -> std::uint64_t
+{
+    const auto iter = m_nodes.find(nodeId(level, prefix));
+    return iter != m_nodes.end() ? iter->second : 0;
+}
+
+auto MerkleTree::bucket(std::uint64_t prefix) const -> const std::vector<Record>&
+{
+    static const std::vector<Record> empty;
+    const auto iter = m_buckets.find(prefix);
+    return iter != m_buckets.end() ? iter->second : empty;
+}
+
+auto MerkleTree::propagate(std::uint64_t keyHash, std::uint64_t delta) -> void
+{
+    for(auto level = 0u; level <= depth; ++level)
+    {
+        const auto iter = m_nodes.emplace(nodeId(level, prefixOf(keyHash, level)), 0).first;
+        iter->second += delta;
+        if(iter->second == 0)
+            m_nodes.erase(iter);
+    }
+}
+
+auto diff(const MerkleTree& from, const MerkleTree& to) -> RecordChanges
+{
+    RecordChanges changes;
+
+    const auto compareBuckets = [&](std::uint64_t prefix)
+    {
+        const auto& before = from.bucket(prefix);
+        const auto& after = to.bucket(prefix);
+        for(const auto& record : after)
+        {
+            const auto iter = std::find_if(before.begin(), before.end(), [&](const auto& other) { return other.key == record.key; });
+            if(iter == before.end())
+                changes.added.push_back(record.key);
+            else if(iter->hash != record.hash)
+                changes.modified.push_back(record.key);
+        }
+        for(const auto& record : before)
+            if(std::none_of(after.begin(), after.end(), [&](const auto& other) { return other.key == record.key; }))
+                changes.removed.push_back(record.key);
+    };
+
+    const auto visit = [&](const auto& self, unsigned level, std::uint64_t prefix) -> void
+    {
+        if(from.node(level, prefix) == to.node(level, prefix))
+            return;
+        if(level == MerkleTree::depth)
+            return compareBuckets(prefix);
+        for(auto child = 0u; child < fanout; ++child)
+            self(self, level + 1, prefix * fanout + child);
+    };
+
+    visit(visit, 0, 0);
+    return changes;
+}
+
+} // namespace Atomik
@@ -0,0 +1,138 @@
+// Atomik is a library that implements basic chemical concepts such as elements, substances, and reactions.
+//
+// Copyright (C) 2018-2019 Allan Leal and Reaktoro Contributors
+//
+// This library is free software; you can redistribute it and/or
+// modify it under the terms of the GNU Lesser General Public
+// License as published by the Free Software Foundation; either
+// version 2.1 of the License, or (at your option) any later version.
+//
+// This library is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+// Lesser General Public License for more details.
+//
+// You should have received a copy of the GNU Lesser General Public License
+// along with this library. If not, see <http://www.gnu.org/licenses/>.
+
+#pragma once
+
+// C++ includes
+#include <cstdint>
+#include <optional>
+#include <string>
+#include <string_view>
+#include <unordered_map>
+#include <vector>
+
+namespace Atomik {
+
+// Forward declarations
+class Element;
+class Elements;
+class Substance;
+class Substances;
+
+/// Return the hash of the content of an element (its symbol, name, numeric attributes, and tags).
+auto contentHash(const Element& element) -> std::uint64_t;
+
+/// Return the hash of the content of a substance (its name, formula, composition, type, and tags).
+auto contentHash(const Substance& substance) -> std::uint64_t;
+
+/// The keys of the records that differ between two versions of a collection.
+struct RecordChanges
+{
+    /// The keys of the records only in the new version.
+    std::vector<std::string> added;
+
+    /// The keys of the records only in the old version.
+    std::vector<std::string> removed;
+
+    /// The keys of the records in both versions with different contents.
+    std::vector<std::string> modified;
+
+    /// Return true if there are no changes.
+    auto empty() const -> bool { return added.empty() && removed.empty() && modified.empty(); }
+};
+
+/// A type used to maintain a hierarchical hash of a collection of keyed records.
+/// Records are placed in 16^depth buckets by the leading bits of the hash of their key (element
+/// symbols or substance names), and each node of the tree of fan-out 16 above the buckets stores
+/// the wrapping sum of the mixed key and content hashes of the records below it. The hash of a
+/// node is thus independent of the order of the records, and inserting or erasing a record
+/// updates only the `depth + 1` nodes on its path. Two trees are compared by `diff` descending
+/// only into the nodes whose hashes differ, so its cost grows with the number of changes:
+/// ~~~
+/// using namespace Atomik;
+/// MerkleTree before(substances), after(updated);
+/// auto changes = diff(before, after); // the names of the added, removed, and modified substances
+/// ~~~
+class MerkleTree
+{
+public:
+    /// The number of levels of the tree below its root.
+    static constexpr unsigned depth = 4;
+
+    /// Construct a default MerkleTree object.
+    MerkleTree();
+
+    /// Construct a MerkleTree object with given elements keyed by symbol.
+    explicit MerkleTree(const Elements& elements);
+
+    /// Construct a MerkleTree object with given substances keyed by name.
+    explicit MerkleTree(const Substances& substances);
+
+    /// Insert a record with given key and content hash, replacing the record with the same key if any.
+    auto insert(std::string_view key, std::uint64_t hash) -> void;
+
+    /// Erase the record with given key, returning false if there is none.
+    auto erase(std::string_view key) -> bool;
+
+    /// Return the content hash of the record with given key, if any.
+    auto find(std::string_view key) const -> std::optional<std::uint64_t>;
+
+    /// Return the number of records in the tree.
+    auto size() const -> std::size_t;
+
+    /// Return the hash of all records in the tree.
+    auto root() const -> std::uint64_t;
+
+    /// Return the hash of the node at given level (zero for the root) with given key hash prefix.
+    auto node(unsigned level, std::uint64_t prefix) const -> std::uint64_t;
+
+private:
+    /// A record in a bucket of the tree.
+    struct Record
+    {
+        /// The key of the record.
+        std::string key;
+
+        /// The hash of the key of the record.
+        std::uint64_t keyHash;
+
+        /// The hash of the content of the record.
+        std::uint64_t hash;
+    };
+
+    /// Return the records in the bucket with given prefix (empty if there are none).
+    auto bucket(std::uint64_t prefix) const -> const std::vector<Record>&;
+
+    /// Add a (possibly negated) leaf hash to the nodes on the path of a key hash.
+    auto propagate(std::uint64_t keyHash, std::uint64_t delta) -> void;
+
+    /// The hashes of the non-empty nodes by level and prefix.
+    std::unordered_map<std::uint64_t, std::uint64_t> m_nodes;
+
+    /// The records in the non-empty buckets by prefix.
+    std::unordered_map<std::uint64_t, std::vector<Record>> m_buckets;
+
+    /// The number of records in the tree.
+    std::size_t m_size = 0;
+
+    friend auto diff(const MerkleTree& from, const MerkleTree& to) -> RecordChanges;
+};
+
+/// Return the changes from one version of a collection to another, visiting only the subtrees with changes.
+auto diff(const MerkleTree& from, const MerkleTree& to) -> RecordChanges;
+
+} // namespace Atomik
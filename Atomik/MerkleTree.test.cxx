@@ -0,0 +1,91 @@
+// Atomik is a library that implements basic chemical concepts such as elements, substances, and reactions.
+//
+// Copyright (C) 2018-2019 Allan Leal and Reaktoro Contributors
+//
+// This library is free software; you can redistribute it and/or
+// modify it under the terms of the GNU Lesser General Public
+// License as published by the Free Software Foundation; either
+// version 2.1 of the License, or (at your option) any later version.
+//
+// This library is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+// Lesser General Public License for more details.
+//
+// You should have received a copy of the GNU Lesser General Public License
+// along with this library. If not, see <http://www.gnu.org/licenses/>.
+// Catch includes
+#include <catch2/catch.hpp>
+
+// Atomik includes
+#include <Atomik/Elements.hpp>
+#include <Atomik/MerkleTree.hpp>
+#include <Atomik/Substances.hpp>
+using namespace Atomik;
+
+TEST_CASE("Testing MerkleTree", "[MerkleTree]")
+{
+    std::vector<Substance> many;
+    for(auto i = 0u; i < 5000; ++i)
+        many.push_back(Substance("H2O").replaceName("Substance" + std::to_string(i)).replaceTags({"aqueous"}));
+    const Substances substances(many);
+
+    SECTION("Testing content hashes")
+    {
+        const auto water = Substance("H2O").replaceName("H2O(aq)").replaceTags({"aqueous"});
+        REQUIRE(contentHash(water) == contentHash(Substance("H2O").replaceName("H2O(aq)").replaceTags({"aqueous"})));
+        REQUIRE(contentHash(water) != contentHash(Substance("H2O").replaceName("H2O(g)").replaceTags({"aqueous"})));
+        REQUIRE(contentHash(water) != contentHash(Substance("H2O").replaceName("H2O(aq)").replaceTags({"neutral"})));
+        REQUIRE(contentHash(water) != contentHash(Substance("H2O2").replaceName("H2O(aq)").replaceTags({"aqueous"})));
+
+        const auto elements = Elements::PeriodicTable();
+        REQUIRE(contentHash(elements[0]) == contentHash(Element(elements[0])));
+        REQUIRE(contentHash(elements[0]) != contentHash(elements[0].replaceAtomicWeight(1.0)));
+    }
+
+    SECTION("Testing tree hashes")
+    {
+        const MerkleTree tree(substances);
+        REQUIRE(tree.size() == substances.size());
+        REQUIRE(tree.find("Substance42") == contentHash(substances[42]));
+        REQUIRE_FALSE(tree.find("Substance5000"));
+
+        // The root does not depend on the order of the records
+        std::vector<Substance> reversed(many.rbegin(), many.rend());
+        REQUIRE(MerkleTree(Substances(reversed)).root() == tree.root());
+
+        // Inserting and erasing a record restores the root
+        auto updated = tree;
+        updated.insert("Extra", 42);
+        REQUIRE(updated.root() != tree.root());
+        REQUIRE(updated.erase("Extra"));
+        REQUIRE_FALSE(updated.erase("Extra"));
+        REQUIRE(updated.root() == tree.root());
+        REQUIRE(updated.size() == tree.size());
+
+        REQUIRE(MerkleTree().root() == 0);
+        REQUIRE(diff(tree, tree).empty());
+    }
+
+    SECTION("Testing diffs")
+    {
+        const MerkleTree before(substances);
+        auto after = before;
+        after.insert("Substance10", contentHash(Substance(substances[10]).replaceTags({"changed"})));
+        after.insert("Substance4000", contentHash(Substance(substances[4000]).replaceName("x")));
+        after.erase("Substance7");
+        after.insert("New", 1);
+
+        const auto changes = diff(before, after);
+        REQUIRE(changes.added == std::vector<std::string>{"New"});
+        REQUIRE(changes.removed == std::vector<std::string>{"Substance7"});
+        auto modified = changes.modified;
+        std::sort(modified.begin(), modified.end());
+        REQUIRE(modified == std::vector<std::string>{"Substance10", "Substance4000"});
+
+        const auto reverse = diff(after, before);
+        REQUIRE(reverse.added == std::vector<std::string>{"Substance7"});
+        REQUIRE(reverse.removed == std::vector<std::string>{"New"});
+        REQUIRE(reverse.modified.size() == 2);
+    }
+}
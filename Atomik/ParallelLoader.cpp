@@ -0,0 +1,288 @@
+// Atomik is a library that implements basic chemical concepts such as elements, substances, and reactions.
+//
+// Copyright (C) 2018-2019 Allan Leal and Reaktoro Contributors
+//
+// This library is free software; you can redistribute it and/or
+// modify it under the terms of the GNU Lesser General Public
+// License as published by the Free Software Foundation; either
+// version 2.1 of the License, or (at your option) any later version.
+//
+// This library is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+// Lesser General Public License for more details.
+//
+// You should have received a copy of the GNU Lesser General Public License
+// along with this library. If not, see <http://www.gnu.org/licenses/>.
+
+#include "ParallelLoader.hpp"
+
+// C++ includes
+#include <algorithm>
+#include <future>
+#include <string>
+#include <thread>
+#include <vector>
+
+// Atomik includes
+#include <Atomik/Elements.hpp>
+#include <Atomik/Exception.hpp>
+#include <Atomik/Memory.hpp>
+#include <Atomik/Serialization.hpp>
+#include <Atomik/Substances.hpp>
+#include <Atomik/Tracing.hpp>
+
+namespace Atomik {
+namespace {
+
+/// Return record-aligned chunks of a text, or the whole text if it has no records.
+template<typename Wrap>
+auto chunks(std::string_view text, const RecordSpans& spans, std::size_t numChunks, const Wrap& wrap) -> std::vector<std::string>
+{
+    ATOMIK_TRACE("split chunks");
+
+    if(spans.begins.empty())
+        return { std::string(text) };
+
+    numChunks = std::min(numChunks, spans.begins.size());
+
+    std::vector<std::string> res;
+    res.reserve(numChunks);
+    for(std::size_t i = 0; i < numChunks; ++i)
+    {
+        const auto first = spans.begins.size() * i / numChunks;
+        const auto last = spans.begins.size() * (i + 1) / numChunks - 1;
+        res.push_back(wrap(text.substr(spans.begins[first], spans.ends[last] - spans.begins[first])));
+    }
+    return res;
+}
+
+/// Parse the chunks of a text on several threads and return their records concatenated in order.
+template<typename Container, typename Parse>
+auto parseChunks(const std::vector<std::string>& chunks, const Parse& parse) -> Container
+{
+    const auto resource = memoryResource();
+    std::vector<std::future<Container>> futures;
+    futures.reserve(chunks.size());
+    for(const auto& chunk : chunks)
+        futures.push_back(std::async(std::launch::async, [&]()
+        {
+            ATOMIK_TRACE_THREAD("ParallelLoader worker");
+            MemoryResourceScope scope(resource);
+            ATOMIK_TRACE("parse chunk");
+            return parse(chunk);
+        }));
+
+    std::vector<Container> results;
+    results.reserve(futures.size());
+    for(auto& future : futures)
+        results.push_back(future.get());
+
+    ATOMIK_TRACE("concatenate chunks");
+    if(results.size() == 1)
+        return std::move(results.front());
+    Container items;
+    for(const auto& result : results)
+        for(const auto& item : result)
+            items.append(item);
+    return items;
+}
+
+/// Return the chunks of a YAML text.
+auto yamlChunks(std::string_view text, std::size_t numThreads) -> std::vector<std::string>
+{
+    return chunks(text, yamlRecordSpans(text), threadCount(numThreads), [](std::string_view chunk) { return std::string(chunk); });
+}
+
+/// Return the chunks of a JSON text.
+auto jsonChunks(std::string_view text, std::size_t numThreads) -> std::vector<std::string>
+{
+    return chunks(text, jsonRecordSpans(text), threadCount(numThreads), [](std::string_view chunk) { return "[" + std::string(chunk) + "]"; });
+}
+
+} // namespace
+
+auto threadCount(std::size_t numThreads) -> std::size_t
+{
+    return numThreads ? numThreads : std::max(1u, std::thread::hardware_concurrency());
+}
+
+auto yamlRecordSpans(std::string_view text) -> RecordSpans
+{
+    RecordSpans spans;
+    std::size_t indentation = std::string_view::npos;
+    for(std::size_t pos = 0, eol = 0; pos < text.size(); pos = eol + 1)
+    {
+        eol = std::min(text.find('\n', pos), text.size());
+        auto line = text.substr(pos, eol - pos);
+        if(!line.empty() && line.back() == '\r')
+            line.remove_suffix(1);
+        const auto indent = std::min(line.find_first_not_of(' '), line.size());
+        const auto content = line.substr(indent);
+        const auto entry = !content.empty() && content[0] == '-' && (content.size() == 1 || content[1] == ' ');
+
+        if(content.empty() || content[0] == '#')
+            continue;
+        if(indentation == std::string_view::npos && spans.begins.empty() && line == "---")
+            continue; // the start of the document
+        if(indentation == std::string_view::npos)
+            indentation = indent;
+        if(indent < indentation || (indent == indentation && !entry))
+            return {}; // not a single block sequence (e.g., a flow sequence, a mapping, or several documents)
+        if(indent == indentation)
+        {
+            if(!spans.begins.empty())
+                spans.ends.push_back(pos);
+            spans.begins.push_back(pos);
+        }
+    }
+    if(!spans.begins.empty())
+        spans.ends.push_back(text.size());
+    return spans;
+}
+
+auto yamlRecordValue(std::string_view record, std::string_view key) -> std::optional<std::string>
+{
+    const auto parsed = [&]() -> std::optional<std::string>
+    {
+        const auto node = YAML::Load(std::string(record))[0];
+        if(node.IsMap() && node[std::string(key)])
+            return node[std::string(key)].as<std::string>();
+        return {};
+    };
+
+    // The column of the keys of the mapping, set by its first key (which follows the `-` of the record)
+    auto column = std::string_view::npos;
+    std::optional<std::string_view> found;
+    for(std::size_t pos = 0, eol = 0; pos < record.size(); pos = eol + 1)
+    {
+        eol = std::min(record.find('\n', pos), record.size());
+        auto line = record.substr(pos, eol - pos);
+        if(!line.empty() && line.back() == '\r')
+            line.remove_suffix(1);
+        auto indent = std::min(line.find_first_not_of(' '), line.size());
+        if(pos == 0 && indent < line.size() && line[indent] == '-')
+            indent = std::min(line.find_first_not_of(' ', indent + 1), line.size());
+        const auto content = line.substr(indent);
+
+        if(content.empty() || content[0] == '#')
+            continue;
+        if(column == std::string_view::npos)
+            column = indent;
+        if(found)
+        {
+            if(indent > column)
+                return parsed(); // the value continues in the next lines
+            break;
+        }
+        if(indent < column || content.find_first_of("{}[]-?&*!|>'\"%@`", 0) == 0)
+            return parsed(); // not a mapping in block style with simple keys
+        if(indent > column)
+            continue; // a line of a nested value
+        if(content.size() > key.size() && content.substr(0, key.size()) == key && content[key.size()] == ':')
+        {
+            auto value = content.substr(key.size() + 1);
+            if(!value.empty() && value[0] != ' ' && value[0] != '\t')
+                continue; // a key with the same prefix
+            value.remove_prefix(std::min(value.find_first_not_of(" \t"), value.size()));
+            found = value;
+        }
+    }
+
+    if(!found)
+        return column == std::string_view::npos ? parsed() : std::nullopt;
+
+    auto value = *found;
+    if(value.empty() || value.find_first_of("{}[]&*!|>%@`", 0) == 0)
+        return parsed(); // a value that is not a scalar on a single line
+
+    if(value[0] == '"' || value[0] == '\'')
+    {
+        try { return YAML::Load(std::string(value)).as<std::string>(); }
+        catch(const YAML::Exception&) { return parsed(); } // a quoted scalar spanning several lines
+    }
+
+    if(const auto comment = value.find(" #"); comment != std::string_view::npos)
+        value = value.substr(0, comment);
+    value.remove_suffix(value.size() - std::min(value.find_last_not_of(" \t") + 1, value.size()));
+    return std::string(value);
+}
+
+auto jsonRecordSpans(std::string_view text) -> RecordSpans
+{
+    RecordSpans spans;
+    auto isSpace = [](char c) { return c == ' ' || c == '\t' || c == '\n' || c == '\r'; };
+
+    std::size_t pos = 0;
+    while(pos < text.size() && isSpace(text[pos]))
+        ++pos;
+    if(pos == text.size() || text[pos] != '[')
+        return {};
+
+    auto depth = 0;
+    auto inString = false;
+    auto escaped = false;
+    auto expectingRecord = true;
+    for(++pos; pos < text.size(); ++pos)
+    {
+        const auto c = text[pos];
+        if(inString)
+        {
+            if(escaped) escaped = false;
+            else if(c == '\\') escaped = true;
+            else if(c == '"') inString = false;
+            continue;
+        }
+        if(depth == 0 && expectingRecord && !isSpace(c) && c != ']')
+        {
+            spans.begins.push_back(pos);
+            expectingRecord = false;
+        }
+        if(c == '"') inString = true;
+        else if(c == '{' || c == '[') ++depth;
+        else if(c == '}' || (c == ']' && depth > 0)) --depth;
+        else if(depth == 0 && (c == ',' || c == ']'))
+        {
+            if(spans.ends.size() < spans.begins.size())
+                spans.ends.push_back(pos);
+            if(c == ']')
+                return spans;
+            expectingRecord = true;
+        }
+    }
+    return {}; // the array is not terminated, so let the parser report the error
+}
+
+auto parallelLoadElementsYAML(std::string_view text, std::size_t numThreads) -> Elements
+{
+    ATOMIK_TRACE("parallelLoadElementsYAML");
+    return parseChunks<Elements>(yamlChunks(text, numThreads), [](const std::string& chunk) {
+        return YAML::Load(chunk).as<Elements>();
+    });
+}
+
+auto parallelLoadSubstancesYAML(std::string_view text, std::size_t numThreads) -> Substances
+{
+    ATOMIK_TRACE("parallelLoadSubstancesYAML");
+    return parseChunks<Substances>(yamlChunks(text, numThreads), [](const std::string& chunk) {
+        return YAML::Load(chunk).as<Substances>();
+    });
+}
+
+auto parallelLoadElementsJSON(std::string_view text, std::size_t numThreads) -> Elements
+{
+    ATOMIK_TRACE("parallelLoadElementsJSON");
+    return parseChunks<Elements>(jsonChunks(text, numThreads), [](const std::string& chunk) {
+        return json::parse(chunk).get<Elements>();
+    });
+}
+
+auto parallelLoadSubstancesJSON(std::string_view text, std::size_t numThreads) -> Substances
+{
+    ATOMIK_TRACE("parallelLoadSubstancesJSON");
+    return parseChunks<Substances>(jsonChunks(text, numThreads), [](const std::string& chunk) {
+        return json::parse(chunk).get<Substances>();
+    });
+}
+
+} // namespace Atomik
@@ -0,0 +1,87 @@
+// Atomik is a library that implements basic chemical concepts such as elements, substances, and reactions.
+//
+// Copyright (C) 2018-2019 Allan Leal and Reaktoro Contributors
+//
+// This library is free software; you can redistribute it and/or
+// modify it under the terms of the GNU Lesser General Public
+// License as published by the Free Software Foundation; either
+// version 2.1 of the License, or (at your option) any later version.
+//
+// This library is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+// Lesser General Public License for more details.
+//
+// You should have received a copy of the GNU Lesser General Public License
+// along with this library. If not, see <http://www.gnu.org/licenses/>.
+
+#pragma once
+
+// C++ includes
+#include <cstddef>
+#include <optional>
+#include <string>
+#include <string_view>
+#include <vector>
+
+namespace Atomik {
+
+// Forward declarations
+class Elements;
+class Substances;
+
+/// A type used to represent the records of a top-level sequence located in a text.
+struct RecordSpans
+{
+    /// The offsets in the text where the records begin.
+    std::vector<std::size_t> begins;
+
+    /// The offsets in the text where the records end.
+    std::vector<std::size_t> ends;
+};
+
+/// Return the number of threads used by the parallel loaders for a requested number (if zero, the number of hardware threads).
+auto threadCount(std::size_t numThreads) -> std::size_t;
+
+/// Return the records of the top-level block sequence of a YAML text, or none if the text is not such a sequence.
+/// Each record begins at a line with the indentation of the sequence and starting with `-`, and ends where the next one begins.
+auto yamlRecordSpans(std::string_view text) -> RecordSpans;
+
+/// Return the scalar value of a key in the mapping of a YAML record located with `yamlRecordSpans`, if the record has such key.
+/// The value is read from the lines of the record at the indentation of its mapping, without parsing the record, when it is
+/// a plain or quoted scalar on a single line. Otherwise (e.g., for records in flow style or multi-line values), the record is parsed.
+/// This permits the names of the substances in a large file to be indexed at a fraction of the cost of parsing the file.
+auto yamlRecordValue(std::string_view record, std::string_view key) -> std::optional<std::string>;
+
+/// Return the records of the top-level array of a JSON text, or none if the text is not such an array.
+auto jsonRecordSpans(std::string_view text) -> RecordSpans;
+
+/// Return the elements of a YAML sequence, deserializing chunks of records on several threads.
+/// The text is split at the entries of its top-level block sequence into record-aligned chunks, each chunk is
+/// parsed with `operator>>` on its own thread, and the results are concatenated in their original order.
+/// A document that is not a top-level block sequence (e.g., in flow style) is parsed on a single thread.
+/// Anchors and aliases must not refer to other records, since records may be parsed in different chunks.
+/// @param text The YAML text of the sequence of elements.
+/// @param numThreads The number of threads to use (if zero, the number of hardware threads).
+auto parallelLoadElementsYAML(std::string_view text, std::size_t numThreads = 0) -> Elements;
+
+/// Return the substances of a YAML sequence, deserializing chunks of records on several threads.
+/// The chunks are split and parsed as in `parallelLoadElementsYAML`.
+/// @param text The YAML text of the sequence of substances.
+/// @param numThreads The number of threads to use (if zero, the number of hardware threads).
+auto parallelLoadSubstancesYAML(std::string_view text, std::size_t numThreads = 0) -> Substances;
+
+/// Return the elements of a JSON array, deserializing chunks of records on several threads.
+/// The text is split at the top-level commas of the array into record-aligned chunks, each chunk is
+/// parsed with `from_json` on its own thread, and the results are concatenated in their original order.
+/// @param text The JSON text of the array of elements.
+/// @param numThreads The number of threads to use (if zero, the number of hardware threads).
+auto parallelLoadElementsJSON(std::string_view text, std::size_t numThreads = 0) -> Elements;
+
+/// Return the substances of a JSON array, deserializing chunks of records on several threads.
+/// The chunks are split and parsed as in `parallelLoadElementsJSON`.
+/// @param text The JSON text of the array of substances.
+/// @param numThreads The number of threads to use (if zero, the number of hardware threads).
+auto parallelLoadSubstancesJSON(std::string_view text, std::size_t numThreads = 0) -> Substances;
+
+} // namespace Atomik
@@ -0,0 +1,107 @@
+// Atomik is a library that implements basic chemical concepts such as elements, substances, and reactions.
+//
+// Copyright (C) 2018-2019 Allan Leal and Reaktoro Contributors
+//
+// This library is free software; you can redistribute it and/or
+// modify it under the terms of the GNU Lesser General Public
+// License as published by the Free Software Foundation; either
+// version 2.1 of the License, or (at your option) any later version.
+//
+// This library is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+// Lesser General Public License for more details.
+//
+// You should have received a copy of the GNU Lesser General Public License
+// along with this library. If not, see <http://www.gnu.org/licenses/>.
+
+// Catch includes
+#include <catch2/catch.hpp>
+
+// C++ includes
+#include <sstream>
+
+// Atomik includes
+#include <Atomik/Elements.hpp>
+#include <Atomik/ParallelLoader.hpp>
+#include <Atomik/Serialization.hpp>
+#include <Atomik/Substances.hpp>
+using namespace Atomik;
+
+TEST_CASE("Testing ParallelLoader", "[ParallelLoader]")
+{
+    std::vector<Substance> data;
+    for(auto i = 0; i < 100; ++i)
+        data.push_back(Substance(i % 2 ? "CaCO3" : "HCO3-").replaceName("S[" + std::to_string(i) + "], \"quoted\" {x}").replaceTags({"tag" + std::to_string(i % 3)}));
+    const Substances substances(data);
+
+    auto requireEqual = [](const Substances& loaded, const Substances& expected)
+    {
+        REQUIRE(loaded.size() == expected.size());
+        for(auto i = 0u; i < loaded.size(); ++i)
+            REQUIRE(loaded[i] == expected[i]);
+    };
+
+    SECTION("Testing YAML chunks")
+    {
+        YAML::Node node;
+        node << substances;
+        std::stringstream ss;
+        ss << "# a comment before the sequence\n---\n" << node << "\n";
+
+        requireEqual(parallelLoadSubstancesYAML(ss.str(), 3), substances);
+        requireEqual(parallelLoadSubstancesYAML(ss.str(), 1000), substances);
+        requireEqual(parallelLoadSubstancesYAML(ss.str()), substances);
+
+        // Test a flow sequence, which cannot be split, is parsed on a single thread
+        YAML::Emitter emitter;
+        emitter << YAML::Flow << node;
+        requireEqual(parallelLoadSubstancesYAML(emitter.c_str(), 4), substances);
+
+        // Test an indented sequence of elements
+        const auto text = "  - symbol: H\n    name: Hydrogen\n    atomicNumber: 1\n    atomicWeight: 0.001007940\n    electronegativity: 2.20\n"
+                          "  - symbol: O\n    name: Oxygen\n    atomicNumber: 8\n    atomicWeight: 0.015999400\n    electronegativity: 3.44\n";
+        const auto elements = parallelLoadElementsYAML(text, 2);
+        REQUIRE(elements.size() == 2);
+        REQUIRE(elements[1].name() == "Oxygen");
+
+        REQUIRE_THROWS(parallelLoadSubstancesYAML("- name: H2O\n- formula: [", 2));
+    }
+
+    SECTION("Testing YAML record values")
+    {
+        YAML::Node node;
+        node << substances;
+        std::stringstream ss;
+        ss << node;
+        const auto text = ss.str();
+        const auto spans = yamlRecordSpans(text);
+        REQUIRE(spans.begins.size() == substances.size());
+        for(auto i = 0u; i < spans.begins.size(); ++i)
+            REQUIRE(yamlRecordValue(text.substr(spans.begins[i], spans.ends[i] - spans.begins[i]), "name") == substances[i].name().str());
+
+        REQUIRE(yamlRecordValue("- name: H2O(aq)  # water\n  formula:\n    name: nested\n", "name") == "H2O(aq)");
+        REQUIRE(yamlRecordValue("-\n  formula: H2O\n  name: 'H2O (aq)'\n", "name") == "H2O (aq)");
+        REQUIRE(yamlRecordValue("- names: [a]\n  name2: b\n  name:   H+\n", "name") == "H+");
+        REQUIRE(yamlRecordValue("- {name: H2O(aq), tags: []}\n", "name") == "H2O(aq)");
+        REQUIRE(yamlRecordValue("- name: |\n    H2O\n", "name") == "H2O\n");
+        REQUIRE(yamlRecordValue("- name: long\n    name\n", "name") == "long name");
+        REQUIRE(yamlRecordValue("- name: \"multi\n    line\"\n", "name") == "multi line");
+        REQUIRE_FALSE(yamlRecordValue("- formula: H2O\n  tags: [name]\n", "name"));
+    }
+
+    SECTION("Testing JSON chunks")
+    {
+        json j = substances;
+        const auto text = j.dump(2);
+
+        requireEqual(parallelLoadSubstancesJSON(text, 3), substances);
+        requireEqual(parallelLoadSubstancesJSON(j.dump(), 7), substances);
+        REQUIRE(parallelLoadSubstancesJSON(" [ ] ", 4).size() == 0);
+
+        json ej = Elements({ Element({ .symbol = "Na", .name = "Sodium", .atomicNumber = 11, .atomicWeight = 0.022989768, .electronegativity = 0.93, .tags = {} }) });
+        REQUIRE(parallelLoadElementsJSON(ej.dump(), 2)[0].symbol() == "Na");
+
+        REQUIRE_THROWS(parallelLoadSubstancesJSON(text.substr(0, text.size() / 2), 2));
+    }
+}
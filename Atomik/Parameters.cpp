@@ -110,14 +110,14 @@ Parameters::Parameters()
 
 auto Parameters::set(const std::string& name) -> ParamValue&
 {
-    auto [iter, success] = index.insert({ name, index.size() });
+    auto [iter, success] = index.insert({ InternedString(name), index.size() });
 
     return success ? ( values.push_back(0.0), values.back() ) : values[iter->second];
 }
 
 auto Parameters::get(const std::string& name) -> ParamValue&
 {
-    auto iter = index.find(name);
+    auto iter = index.find(InternedString::find(name));
     error(iter == index.end(), "There is no parameter with name `", name, "`.");
     return  values[iter->second];
 }
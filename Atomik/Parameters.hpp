@@ -19,12 +19,15 @@
 
 // C++ includes
 #include <string>
+#include <string_view>
+#include <type_traits>
 #include <unordered_map>
 #include <variant>
 #include <vector>
 
 // Atomik includes
 #include <Atomik/Index.hpp>
+#include <Atomik/InternedString.hpp>
 #include <Atomik/StringUtils.hpp>
 
 namespace Atomik {
@@ -127,21 +130,36 @@ public:
 
     /// Set a new parameter with given subnames.
     template <typename... Args>
-    auto set(const std::string& first, const Args&... others) -> ParamValue& { return set(stringfy(".", first, others...)); }
+    auto set(const std::string& first, const Args&... others) -> ParamValue& { return set(key(first, others...)); }
 
     /// Return a parameter with given name.
     auto get(const std::string& name) -> ParamValue&;
 
     /// Return a parameter with given subnames.
     template <typename... Args>
-    auto get(const std::string& first, const Args&... others) -> ParamValue& { return get(stringfy(".", first, others...)); }
+    auto get(const std::string& first, const Args&... others) -> ParamValue& { return get(key(first, others...)); }
 
 private:
     /// The values of the parameters.
     std::vector<ParamValue> values;
 
-    /// The mapping from parameters names to their indices.
-    std::unordered_map<std::string, Index> index;
+    /// The mapping from parameters names (interned) to their indices.
+    std::unordered_map<InternedString, Index> index;
+
+    /// Return the name of a parameter with given subnames joined by `.`.
+    template <typename... Args>
+    static auto key(const std::string& first, const Args&... others) -> std::string
+    {
+        if constexpr((std::is_convertible_v<const Args&, std::string_view> && ...))
+        {
+            std::string res;
+            res.reserve(first.size() + (sizeof...(others) + ... + std::string_view(others).size()));
+            res += first;
+            ((res += '.', res += std::string_view(others)), ...);
+            return res;
+        }
+        else return stringfy(".", first, others...);
+    }
 };
 
 } // namespace Atomik
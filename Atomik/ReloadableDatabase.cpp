@@ -0,0 +1,198 @@
+// Atomik is a library that implements basic chemical concepts such as elements, substances, and reactions.
+//
+// Copyright (C) 2018-2019 Allan Leal and Reaktoro Contributors
+//
+// This library is free software; you can redistribute it and/or
+// modify it under the terms of the GNU Lesser General Public
+// License as published by the Free Software Foundation; either
+// version 2.1 of the License, or (at your option) any later version.
+//
+// This library is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+// Lesser General Public License for more details.
+//
+// You should have received a copy of the GNU Lesser General Public License
+// along with this library. If not, see <http://www.gnu.org/licenses/>.
+
+#include "ReloadableDatabase.hpp"
+
+// C++ includes
+#include <chrono>
+#include <filesystem>
+#include <vector>
+
+// Linux includes
+#ifdef __linux__
+#include <poll.h>
+#include <sys/inotify.h>
+#include <unistd.h>
+#endif
+
+// Atomik includes
+#include <Atomik/Exception.hpp>
+#include <Atomik/Serialization.hpp>
+
+namespace Atomik {
+namespace {
+
+/// The interval at which the watching thread checks whether it should stop (and polls files without inotify).
+constexpr auto watchInterval = std::chrono::milliseconds(200);
+
+/// The delay used to coalesce the several events issued by editors while saving a file.
+constexpr auto settleDelay = std::chrono::milliseconds(50);
+
+/// Return the paths of the watched files (ignoring empty ones).
+auto watchedPaths(const std::string& elementsPath, const std::string& substancesPath) -> std::vector<std::filesystem::path>
+{
+    std::vector<std::filesystem::path> paths;
+    for(const auto& path : { elementsPath, substancesPath })
+        if(!path.empty())
+            paths.emplace_back(path);
+    return paths;
+}
+
+#ifndef __linux__
+/// Return the modification time of a file, or its default value if the file does not exist.
+auto modificationTime(const std::filesystem::path& path) -> std::filesystem::file_time_type
+{
+    std::error_code ec;
+    const auto time = std::filesystem::last_write_time(path, ec);
+    return ec ? std::filesystem::file_time_type() : time;
+}
+#endif
+
+} // namespace
+
+ReloadableDatabase::ReloadableDatabase(std::string elementsPath, std::string substancesPath)
+: m_elementsPath(std::move(elementsPath)), m_substancesPath(std::move(substancesPath)), m_database(load()), m_stop(false)
+{
+#ifdef __linux__
+    // Watch the directories rather than the files, since editors often replace a file by renaming another one
+    m_inotify = inotify_init1(IN_NONBLOCK | IN_CLOEXEC);
+    error(m_inotify < 0, "Could not initialize inotify to watch the database files.");
+    for(const auto& path : watchedPaths(m_elementsPath, m_substancesPath))
+    {
+        const auto directory = path.has_parent_path() ? path.parent_path() : std::filesystem::path(".");
+        const auto watch = inotify_add_watch(m_inotify, directory.c_str(), IN_CLOSE_WRITE | IN_MOVED_TO | IN_CREATE);
+        if(watch < 0) close(m_inotify);
+        error(watch < 0, "Could not watch the directory `", directory.string(), "` of the database file `", path.string(), "`.");
+    }
+#endif
+
+    m_watcher = std::thread([this]() { watch(); });
+}
+
+ReloadableDatabase::~ReloadableDatabase()
+{
+    m_stop = true;
+    m_watcher.join();
+#ifdef __linux__
+    close(m_inotify);
+#endif
+}
+
+auto ReloadableDatabase::snapshot() const -> VersionedDatabase::Snapshot
+{
+    return m_database.snapshot();
+}
+
+auto ReloadableDatabase::version() const -> std::uint64_t
+{
+    return m_database.version();
+}
+
+auto ReloadableDatabase::reload() -> std::uint64_t
+{
+    return m_database.publish(load());
+}
+
+auto ReloadableDatabase::lastError() const -> std::string
+{
+    std::lock_guard lock(m_errorMutex);
+    return m_lastError;
+}
+
+auto ReloadableDatabase::load() const -> Database
+{
+    const auto elements = m_elementsPath.empty() ? Elements::PeriodicTable() : loadElementsFile(m_elementsPath);
+    const auto substances = loadSubstancesFile(m_substancesPath);
+    return Database(elements, substances);
+}
+
+auto ReloadableDatabase::reloadInBackground() -> void
+{
+    std::string message;
+    try {
+        reload();
+    }
+    catch(const std::exception& e) {
+        message = e.what();
+    }
+    std::lock_guard lock(m_errorMutex);
+    m_lastError = std::move(message);
+}
+
+auto ReloadableDatabase::watch() -> void
+{
+    const auto paths = watchedPaths(m_elementsPath, m_substancesPath);
+
+#ifdef __linux__
+    std::vector<std::string> filenames;
+    for(const auto& path : paths)
+        filenames.push_back(path.filename().string());
+
+    // Return true if any pending inotify event concerns one of the watched files
+    auto changed = [&]()
+    {
+        alignas(inotify_event) char buffer[4096];
+        auto found = false;
+        ssize_t length;
+        while((length = read(m_inotify, buffer, sizeof(buffer))) > 0)
+        {
+            for(auto ptr = buffer; ptr < buffer + length; )
+            {
+                const auto* event = reinterpret_cast<const inotify_event*>(ptr);
+                if(event->len > 0)
+                    for(const auto& filename : filenames)
+                        found = found || filename == event->name;
+                ptr += sizeof(inotify_event) + event->len;
+            }
+        }
+        return found;
+    };
+
+    pollfd fds{ m_inotify, POLLIN, 0 };
+    while(!m_stop)
+    {
+        if(poll(&fds, 1, watchInterval.count()) <= 0 || !changed())
+            continue;
+        std::this_thread::sleep_for(settleDelay);
+        changed();
+        reloadInBackground();
+    }
+#else
+    std::vector<std::filesystem::file_time_type> times;
+    for(const auto& path : paths)
+        times.push_back(modificationTime(path));
+
+    while(!m_stop)
+    {
+        std::this_thread::sleep_for(watchInterval);
+        auto modified = false;
+        for(auto i = 0u; i < paths.size(); ++i)
+        {
+            const auto time = modificationTime(paths[i]);
+            modified = modified || time != times[i];
+            times[i] = time;
+        }
+        if(modified)
+        {
+            std::this_thread::sleep_for(settleDelay);
+            reloadInBackground();
+        }
+    }
+#endif
+}
+
+} // namespace Atomik
@@ -0,0 +1,110 @@
+// Atomik is a library that implements basic chemical concepts such as elements, substances, and reactions.
+//
+// Copyright (C) 2018-2019 Allan Leal and Reaktoro Contributors
+//
+// This library is free software; you can redistribute it and/or
+// modify it under the terms of the GNU Lesser General Public
+// License as published by the Free Software Foundation; either
+// version 2.1 of the License, or (at your option) any later version.
+//
+// This library is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+// Lesser General Public License for more details.
+//
+// You should have received a copy of the GNU Lesser General Public License
+// along with this library. If not, see <http://www.gnu.org/licenses/>.
+
+#pragma once
+
+// C++ includes
+#include <atomic>
+#include <cstdint>
+#include <mutex>
+#include <string>
+#include <thread>
+
+// Atomik includes
+#include <Atomik/VersionedDatabase.hpp>
+
+namespace Atomik {
+
+/// A type used to keep a database in sync with the YAML files it was loaded from.
+/// The elements and substances files are watched in a background thread (with inotify on Linux,
+/// and by polling their modification times elsewhere). When any of them changes, the files are
+/// parsed again, the indexes of a new Database object are built, and the new version is published
+/// atomically. Queries in flight keep using the snapshot they started with:
+/// ~~~
+/// using namespace Atomik;
+/// ReloadableDatabase reloadable("data/elements.yml", "species.yml");
+/// // in any thread ...
+/// auto snapshot = reloadable.snapshot();
+/// auto id = snapshot->substanceWithName("H2O(aq)");
+/// ~~~
+/// If a changed file cannot be loaded, the previous version is kept and the error is
+/// reported by `lastError()` until a subsequent reload succeeds.
+class ReloadableDatabase
+{
+public:
+    /// Construct a ReloadableDatabase object loading and watching given files.
+    /// @param elementsPath The path to the YAML file of elements (if empty, the periodic table is used and not watched).
+    /// @param substancesPath The path to the YAML file of substances.
+    /// @throw std::runtime_error When the files cannot be loaded initially.
+    ReloadableDatabase(std::string elementsPath, std::string substancesPath);
+
+    /// Destroy this ReloadableDatabase object, stopping the watching thread.
+    ~ReloadableDatabase();
+
+    ReloadableDatabase(const ReloadableDatabase&) = delete;
+
+    auto operator=(const ReloadableDatabase&) -> ReloadableDatabase& = delete;
+
+    /// Return a snapshot of the latest loaded version of the database.
+    auto snapshot() const -> VersionedDatabase::Snapshot;
+
+    /// Return the number of the latest loaded version of the database.
+    auto version() const -> std::uint64_t;
+
+    /// Load the files again and publish a new version of the database, returning its number.
+    /// @throw std::runtime_error When the files cannot be loaded (the current version is kept).
+    auto reload() -> std::uint64_t;
+
+    /// Return the error message of the last failed background reload (empty if it succeeded).
+    auto lastError() const -> std::string;
+
+private:
+    /// Load the database from the watched files.
+    auto load() const -> Database;
+
+    /// Watch the files and reload them on changes until stopped.
+    auto watch() -> void;
+
+    /// Reload the files in the watching thread, recording any error instead of throwing it.
+    auto reloadInBackground() -> void;
+
+    /// The path to the YAML file of elements.
+    const std::string m_elementsPath;
+
+    /// The path to the YAML file of substances.
+    const std::string m_substancesPath;
+
+    /// The published versions of the database.
+    VersionedDatabase m_database;
+
+    /// The error message of the last failed background reload.
+    std::string m_lastError;
+
+    /// The mutex protecting `m_lastError`.
+    mutable std::mutex m_errorMutex;
+
+    /// True when the watching thread should stop.
+    std::atomic<bool> m_stop;
+
+    /// The inotify file descriptor watching the directories of the files (Linux only).
+    int m_inotify = -1;
+
+    /// The thread watching the files.
+    std::thread m_watcher;
+};
+
+} // namespace Atomik
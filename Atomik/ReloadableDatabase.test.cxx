@@ -0,0 +1,89 @@
+// Atomik is a library that implements basic chemical concepts such as elements, substances, and reactions.
+//
+// Copyright (C) 2018-2019 Allan Leal and Reaktoro Contributors
+//
+// This library is free software; you can redistribute it and/or
+// modify it under the terms of the GNU Lesser General Public
+// License as published by the Free Software Foundation; either
+// version 2.1 of the License, or (at your option) any later version.
+//
+// This library is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+// Lesser General Public License for more details.
+//
+// You should have received a copy of the GNU Lesser General Public License
+// along with this library. If not, see <http://www.gnu.org/licenses/>.
+
+// Catch includes
+#include <catch2/catch.hpp>
+
+// C++ includes
+#include <chrono>
+#include <filesystem>
+#include <fstream>
+#include <thread>
+
+// Atomik includes
+#include <Atomik/ReloadableDatabase.hpp>
+#include <Atomik/Serialization.hpp>
+using namespace Atomik;
+
+namespace {
+
+/// Write given substances to a YAML file, replacing it atomically as editors do.
+auto writeSubstances(const std::filesystem::path& path, const Substances& substances) -> void
+{
+    YAML::Node node;
+    node << substances;
+    const auto temporary = path.string() + ".tmp";
+    std::ofstream(temporary) << node;
+    std::filesystem::rename(temporary, path);
+}
+
+/// Wait until the database reaches a given version, up to a few seconds.
+auto waitForVersion(const ReloadableDatabase& db, std::uint64_t version) -> bool
+{
+    for(auto i = 0; i < 100 && db.version() < version; ++i)
+        std::this_thread::sleep_for(std::chrono::milliseconds(50));
+    return db.version() >= version;
+}
+
+} // namespace
+
+TEST_CASE("Testing ReloadableDatabase", "[ReloadableDatabase]")
+{
+    const auto directory = std::filesystem::temp_directory_path() / "atomik-reloadable-database-test";
+    std::filesystem::create_directories(directory);
+    const auto path = directory / "substances.yml";
+
+    writeSubstances(path, Substances({ Substance("H2O").replaceName("H2O(aq)"), Substance("CO2").replaceName("CO2(g)") }));
+
+    {
+        ReloadableDatabase reloadable("", path.string());
+
+        const auto first = reloadable.snapshot();
+        REQUIRE(first.version() == 0);
+        REQUIRE(first->substances().size() == 2);
+
+        // Test the database is reloaded when its file changes
+        writeSubstances(path, Substances({ Substance("H2O").replaceName("H2O(aq)"), Substance("CO2").replaceName("CO2(g)"), Substance("CH4").replaceName("CH4(g)") }));
+        REQUIRE(waitForVersion(reloadable, 1));
+        REQUIRE(reloadable.snapshot()->hasSubstance("CH4(g)"));
+        REQUIRE(reloadable.lastError().empty());
+
+        // Test snapshots taken earlier are unchanged
+        REQUIRE(first->substances().size() == 2);
+        REQUIRE_FALSE(first->hasSubstance("CH4(g)"));
+
+        // Test an invalid file keeps the current version and reports the error
+        std::ofstream(path) << "- formula: [";
+        for(auto i = 0; i < 100 && reloadable.lastError().empty(); ++i)
+            std::this_thread::sleep_for(std::chrono::milliseconds(50));
+        REQUIRE_FALSE(reloadable.lastError().empty());
+        REQUIRE(reloadable.snapshot()->substances().size() == 3);
+        REQUIRE_THROWS(reloadable.reload());
+    }
+
+    std::filesystem::remove_all(directory);
+}
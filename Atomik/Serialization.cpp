@@ -17,12 +17,106 @@
 
 #include "Serialization.hpp"
 
+// C++ includes
+#include <fstream>
+#include <sstream>
+
 // Atomik includes
+#include <Atomik/Database.hpp>
+#include <Atomik/DatabaseDelta.hpp>
 #include <Atomik/Element.hpp>
 #include <Atomik/Elements.hpp>
-#include <Atomik/SubstanceFormula.hpp>
+#include <Atomik/Exception.hpp>
+#include <Atomik/Instrumentation.hpp>
+#include <Atomik/InternedString.hpp>
+#include <Atomik/SnapshotCache.hpp>
+#include <Atomik/StringList.hpp>
 #include <Atomik/Substance.hpp>
+#include <Atomik/SubstanceElements.hpp>
+#include <Atomik/SubstanceFormula.hpp>
 #include <Atomik/Substances.hpp>
+#include <Atomik/Tracing.hpp>
+
+namespace Atomik {
+namespace {
+
+/// Return the elements of a substance with given formula using the default database of elements.
+auto substanceElements(const SubstanceFormula& formula) -> SubstanceElements
+{
+    return SubstanceElements({
+        .elements = Elements::Default().withSymbols(formula.symbols()),
+        .coefficients = formula.coefficients(),
+        .oxidationStates = {}
+    });
+}
+
+/// Return the arguments of a substance deserialized from a YAML node, without its elements.
+auto substanceArgs(const Node& node) -> Substance::Args
+{
+    Substance::Args args;
+    set(node, "formula", args.formula);
+    set(node, "name"   , args.name);
+    set(node, "tags"   , args.tags);
+    return args;
+}
+
+/// Return the arguments of a substance deserialized from a JSON object, without its elements.
+auto substanceArgs(const json& j) -> Substance::Args
+{
+    Substance::Args args;
+    j.at("formula").get_to(args.formula);
+    j.at("name").get_to(args.name);
+    j.at("tags").get_to(args.tags);
+    return args;
+}
+
+/// Return the substances with given arguments, resolving their elements with the default database of elements.
+/// The elements of all substances are resolved in a single tracing span, which shows this stage of the conversion of
+/// a file without recording a span per substance.
+auto substancesWith(std::vector<Substance::Args>&& records) -> Substances
+{
+    {
+        ATOMIK_TRACE("resolve elements");
+        for(auto& args : records)
+            args.elements = substanceElements(args.formula);
+    }
+    Substances substances;
+    for(auto& args : records)
+        substances.append(Substance(std::move(args)));
+    return substances;
+}
+
+/// Return the content of a text file.
+auto readFile(const std::string& path) -> std::string
+{
+    ATOMIK_TRACE_DETAIL("read file", path);
+    std::ifstream file(path, std::ios::binary);
+    error(!file, "Could not open the file `", path, "`.");
+    std::stringstream ss;
+    ss << file.rdbuf();
+    return ss.str();
+}
+
+/// Return the result of a function, recording it as a tracing span with given name.
+template<typename Function>
+auto traced([[maybe_unused]] const char* name, const Function& function)
+{
+    ATOMIK_TRACE(name);
+    return function();
+}
+
+/// Return the element symbols and their coefficients in a deserialized formula.
+auto formulaElements(std::vector<std::string>&& symbols, const std::vector<double>& coefficients)
+{
+    error(symbols.size() != coefficients.size(), "The number of symbols and coefficients in a formula must be the same.");
+    std::unordered_map<std::string, double> elements;
+    for(auto i = 0u; i < symbols.size(); ++i)
+        elements.emplace(std::move(symbols[i]), coefficients[i]);
+    return elements;
+}
+
+} // namespace
+} // namespace Atomik
 
 namespace YAML {
 
@@ -31,18 +125,18 @@ using namespace Atomik;
 auto operator<<(Node& node, const SubstanceFormula& obj) -> void
 {
     node["formula"]      = obj.formula();
-    node["symbols"]      = obj.symbols();
+    node["symbols"]      = strings(obj.symbols());
     node["coefficients"] = obj.coefficients();
 }
 
 auto operator<<(Node& node, const Element& obj) -> void
 {
-    node["symbol"]            = obj.symbol();
-    node["name"]              = obj.name();
+    node["symbol"]            = obj.symbol().str();
+    node["name"]              = obj.name().str();
     node["atomicNumber"]      = obj.atomicNumber();
     node["atomicWeight"]      = obj.atomicWeight();
     node["electronegativity"] = obj.electronegativity();
-    node["tags"]              = obj.tags();
+    node["tags"]              = strings(obj.tags());
 }
 
 auto operator<<(Node& node, const Elements& obj) -> void
@@ -53,8 +147,8 @@ auto operator<<(Node& node, const Elements& obj) -> void
 auto operator<<(Node& node, const Substance& obj) -> void
 {
     node["formula"] = obj.formula();
-    node["name"]    = obj.name();
-    node["tags"]    = obj.tags();
+    node["name"]    = obj.name().str();
+    node["tags"]    = strings(obj.tags());
 }
 
 auto operator<<(Node& node, const Substances& obj) -> void
@@ -62,13 +156,24 @@ auto operator<<(Node& node, const Substances& obj) -> void
     node = obj.data();
 }
 
+auto operator<<(Node& node, const DatabaseDelta& obj) -> void
+{
+    node["elements"]          = obj.elements.data();
+    node["removedElements"]   = obj.removedElements;
+    node["substances"]        = obj.substances.data();
+    node["removedSubstances"] = obj.removedSubstances;
+}
+
 auto operator>>(const Node& node, SubstanceFormula& obj) -> void
 {
-    SubstanceFormula::Data data;
-    set(node, "formula"     , data.formula);
-    set(node, "symbols"     , data.symbols);
-    set(node, "coefficients", data.coefficients);
-    obj = SubstanceFormula(data);
+    SubstanceFormula::Args args;
+    std::vector<std::string> symbols;
+    std::vector<double> coefficients;
+    set(node, "formula"     , args.formula);
+    set(node, "symbols"     , symbols);
+    set(node, "coefficients", coefficients);
+    args.elements = formulaElements(std::move(symbols), coefficients);
+    obj = SubstanceFormula(std::move(args));
 }
 
 auto operator>>(const Node& node, ElementData& obj) -> void
@@ -78,7 +183,7 @@ auto operator>>(const Node& node, ElementData& obj) -> void
     set(node, "atomicNumber"     , obj.atomicNumber);
     set(node, "atomicWeight"     , obj.atomicWeight);
     set(node, "electronegativity", obj.electronegativity);
-    set(node, "tags"             , obj.tags);
+    if(node["tags"]) set(node, "tags", obj.tags);
 }
 
 auto operator>>(const Node& node, Element& obj) -> void
@@ -88,70 +193,126 @@ auto operator>>(const Node& node, Element& obj) -> void
 
 auto operator>>(const Node& node, Elements& obj) -> void
 {
-    obj = Elements(node.as<std::vector<Element>>());
+    Elements elements;
+    for(const auto& child : node)
+        elements.append(child.as<ElementData>());
+    obj = std::move(elements);
 }
 
 auto operator>>(const Node& node, Substance& obj) -> void
 {
-    Substance::Data data;
-    set(node, "formula", data.formula);
-    set(node, "name"   , data.name);
-    set(node, "tags"   , data.tags);
-    obj = Substance(data);
+    auto args = substanceArgs(node);
+    args.elements = substanceElements(args.formula);
+    obj = Substance(std::move(args));
 }
 
 auto operator>>(const Node& node, Substances& obj) -> void
 {
-    obj = Substances(node.as<std::vector<Substance>>());
+    std::vector<Substance::Args> records;
+    records.reserve(node.size());
+    for(const auto& child : node)
+        records.push_back(substanceArgs(child));
+    obj = substancesWith(std::move(records));
+}
+
+auto operator>>(const Node& node, DatabaseDelta& obj) -> void
+{
+    set(node, "elements"         , obj.elements);
+    set(node, "removedElements"  , obj.removedElements);
+    set(node, "substances"       , obj.substances);
+    set(node, "removedSubstances", obj.removedSubstances);
 }
 
 } // YAML
 
 namespace Atomik {
 
-auto to_json(json& j, const SubstanceFormula& obj)
+auto to_json(json& j, const SubstanceFormula& obj) -> void
 {
     j["formula"]      = obj.formula();
-    j["symbols"]      = obj.symbols();
+    j["symbols"]      = strings(obj.symbols());
     j["coefficients"] = obj.coefficients();
 }
 
-auto to_json(json& j, const Element& obj)
+auto to_json(json& j, const Element& obj) -> void
 {
-    j["symbol"]            = obj.symbol();
-    j["name"]              = obj.name();
+    j["symbol"]            = obj.symbol().str();
+    j["name"]              = obj.name().str();
     j["atomicNumber"]      = obj.atomicNumber();
     j["atomicWeight"]      = obj.atomicWeight();
     j["electronegativity"] = obj.electronegativity();
-    j["tags"]              = obj.tags();
+    j["tags"]              = strings(obj.tags());
 }
 
-auto to_json(json& j, const Elements& obj)
+auto to_json(json& j, const Elements& obj) -> void
 {
     for (const auto& element : obj)
         j.push_back(element);
 }
 
-auto to_json(json& j, const Substance& obj)
+auto to_json(json& j, const Substance& obj) -> void
 {
     j["formula"] = obj.formula();
-    j["name"]    = obj.name();
-    j["tags"]    = obj.tags();
+    j["name"]    = obj.name().str();
+    j["tags"]    = strings(obj.tags());
 }
 
-auto to_json(json& j, const Substances& obj)
+auto to_json(json& j, const Substances& obj) -> void
 {
     for (const auto& substance : obj)
         j.push_back(substance);
 }
 
+auto to_json(json& j, const DatabaseDelta& obj) -> void
+{
+    j["elements"]          = obj.elements.data();
+    j["removedElements"]   = obj.removedElements;
+    j["substances"]        = obj.substances.data();
+    j["removedSubstances"] = obj.removedSubstances;
+}
+
+auto to_json(json& j, const InstrumentationSnapshot& obj) -> void
+{
+    j["enabled"] = instrumentationEnabled();
+    j["counters"] = json::object();
+    for(const auto& counter : obj.counters)
+        j["counters"][counter.name] = counter.value;
+    j["timers"] = json::object();
+    for(const auto& timer : obj.timers)
+    {
+        // Trailing empty buckets are omitted, bucket i counting latencies in [2^i, 2^(i+1)) ns
+        auto nbuckets = timer.buckets.size();
+        while(nbuckets > 0 && timer.buckets[nbuckets - 1] == 0)
+            --nbuckets;
+        j["timers"][timer.name] = {
+            { "count", timer.count },
+            { "totalNs", timer.totalNs },
+            { "meanNs", timer.meanNs() },
+            { "p50Ns", timer.quantileNs(0.50) },
+            { "p99Ns", timer.quantileNs(0.99) },
+            { "maxNs", timer.maxNs },
+            { "buckets", std::vector<std::uint64_t>(timer.buckets.begin(), timer.buckets.begin() + nbuckets) },
+        };
+    }
+    j["caches"] = json::object();
+    for(const auto& cache : obj.caches)
+        j["caches"][cache.name] = {
+            { "hits", cache.hits },
+            { "misses", cache.misses },
+            { "hitRate", cache.hitRate() },
+        };
+}
+
 auto from_json(const json& j, SubstanceFormula& obj) -> void
 {
-    SubstanceFormula::Data data;
-    j.at("formula").get_to(data.formula);
-    j.at("symbols").get_to(data.symbols);
-    j.at("coefficients").get_to(data.coefficients);
-    obj = SubstanceFormula(data);
+    SubstanceFormula::Args args;
+    std::vector<std::string> symbols;
+    std::vector<double> coefficients;
+    j.at("formula").get_to(args.formula);
+    j.at("symbols").get_to(symbols);
+    j.at("coefficients").get_to(coefficients);
+    args.elements = formulaElements(std::move(symbols), coefficients);
+    obj = SubstanceFormula(std::move(args));
 }
 
 auto from_json(const json& j, ElementData& obj) -> void
@@ -172,22 +333,66 @@ auto from_json(const json& j, Element& obj) -> void
 auto from_json(const json& j, Elements& obj) -> void
 {
     for(const auto& item : j)
-        obj.append(item.get<Element>());
+        obj.append(item.get<ElementData>());
 }
 
 auto from_json(const json& j, Substance& obj) -> void
 {
-    Substance::Data data;
-    j.at("formula").get_to(data.formula);
-    j.at("name").get_to(data.name);
-    j.at("tags").get_to(data.tags);
-    obj = Substance(data);
+    auto args = substanceArgs(j);
+    args.elements = substanceElements(args.formula);
+    obj = Substance(std::move(args));
 }
 
 auto from_json(const json& j, Substances& obj) -> void
 {
+    std::vector<Substance::Args> records;
+    records.reserve(j.size());
     for(const auto& item : j)
-        obj.append(item.get<Substance>());
+        records.push_back(substanceArgs(item));
+    for(auto& substance : substancesWith(std::move(records)))
+        obj.append(substance);
+}
+
+auto from_json(const json& j, DatabaseDelta& obj) -> void
+{
+    j.at("elements").get_to(obj.elements);
+    j.at("removedElements").get_to(obj.removedElements);
+    j.at("substances").get_to(obj.substances);
+    j.at("removedSubstances").get_to(obj.removedSubstances);
+}
+
+auto loadElementsFile(const std::string& path) -> Elements
+{
+    ATOMIK_TIME(Timer::LoadElementsFile);
+    ATOMIK_TRACE_DETAIL("loadElementsFile", path);
+    const auto content = readFile(path);
+    auto snapshot = readSnapshot("elements", content);
+    ATOMIK_CACHE(Cache::Snapshots, snapshot.has_value());
+    if(snapshot)
+        return snapshot->elements();
+    const auto node = traced("parse YAML", [&]() { return YAML::Load(content); });
+    const auto elements = traced("convert elements", [&]() { return node.as<Elements>(); });
+    if(!snapshotCacheDirectory().empty())
+        writeSnapshot("elements", content, Database(elements, Substances()));
+    return elements;
+}
+
+auto loadSubstancesFile(const std::string& path) -> Substances
+{
+    // The snapshot stores the substances with the default database of elements, which
+    // is also the one resolving the elements of the substances when parsing the file
+    ATOMIK_TIME(Timer::LoadSubstancesFile);
+    ATOMIK_TRACE_DETAIL("loadSubstancesFile", path);
+    const auto content = readFile(path);
+    auto snapshot = readSnapshot("substances", content);
+    ATOMIK_CACHE(Cache::Snapshots, snapshot.has_value());
+    if(snapshot)
+        return snapshot->substances();
+    const auto node = traced("parse YAML", [&]() { return YAML::Load(content); });
+    const auto substances = traced("convert substances", [&]() { return node.as<Substances>(); });
+    if(!snapshotCacheDirectory().empty())
+        writeSnapshot("substances", content, Database(Elements::Default(), substances));
+    return substances;
 }
 
-} // Atomik
\ No newline at end of file
+} // Atomik
@@ -30,17 +30,19 @@ namespace YAML {
 
 using namespace Atomik;
 
-auto operator<<(Node& node, const Formula& obj) -> void;
+auto operator<<(Node& node, const SubstanceFormula& obj) -> void;
 auto operator<<(Node& node, const Element& obj) -> void;
 auto operator<<(Node& node, const Elements& obj) -> void;
 auto operator<<(Node& node, const Substance& obj) -> void;
 auto operator<<(Node& node, const Substances& obj) -> void;
+auto operator<<(Node& node, const DatabaseDelta& obj) -> void;
 
-auto operator>>(const Node& node, Formula& obj) -> void;
+auto operator>>(const Node& node, SubstanceFormula& obj) -> void;
 auto operator>>(const Node& node, Element& obj) -> void;
 auto operator>>(const Node& node, Elements& obj) -> void;
 auto operator>>(const Node& node, Substance& obj) -> void;
 auto operator>>(const Node& node, Substances& obj) -> void;
+auto operator>>(const Node& node, DatabaseDelta& obj) -> void;
 
 } // namespace YAML
 
@@ -48,16 +50,25 @@ namespace Atomik {
 
 using Json::json;
 
-auto to_json(json& j, const Formula& obj);
-auto to_json(json& j, const Element& obj);
-auto to_json(json& j, const Elements& obj);
-auto to_json(json& j, const Substance& obj);
-auto to_json(json& j, const Substances& obj);
+auto to_json(json& j, const SubstanceFormula& obj) -> void;
+auto to_json(json& j, const Element& obj) -> void;
+auto to_json(json& j, const Elements& obj) -> void;
+auto to_json(json& j, const Substance& obj) -> void;
+auto to_json(json& j, const Substances& obj) -> void;
+auto to_json(json& j, const DatabaseDelta& obj) -> void;
+auto to_json(json& j, const InstrumentationSnapshot& obj) -> void;
 
-auto from_json(const json& j, Formula& obj) -> void;
+auto from_json(const json& j, SubstanceFormula& obj) -> void;
 auto from_json(const json& j, Element& obj) -> void;
 auto from_json(const json& j, Elements& obj) -> void;
 auto from_json(const json& j, Substance& obj) -> void;
 auto from_json(const json& j, Substances& obj) -> void;
+auto from_json(const json& j, DatabaseDelta& obj) -> void;
+
+/// Load elements from a YAML file, using its binary snapshot if the snapshot cache is enabled (see `enableSnapshotCache`).
+auto loadElementsFile(const std::string& path) -> Elements;
+
+/// Load substances from a YAML file, using its binary snapshot if the snapshot cache is enabled (see `enableSnapshotCache`).
+auto loadSubstancesFile(const std::string& path) -> Substances;
 
 } // namespace Atomik
\ No newline at end of file
@@ -21,7 +21,7 @@
 // Atomik includes
 #include <Atomik/Element.hpp>
 #include <Atomik/Elements.hpp>
-#include <Atomik/Formula.hpp>
+#include <Atomik/SubstanceFormula.hpp>
 #include <Atomik/Serialization.hpp>
 #include <Atomik/Substance.hpp>
 #include <Atomik/Substances.hpp>
@@ -31,7 +31,7 @@ using namespace Json;
 namespace strings {
 
 std::string formula = R"xyz(
-label: CO2
+formula: CO2
 symbols: [C, O]
 coefficients: [1, 2]
 )xyz";
@@ -48,7 +48,7 @@ tags: [ group1 ]
 std::string substance = R"xyz(
 name: Calcite
 formula:
-  label: CaCO3
+  formula: CaCO3
   symbols: [C, Ca, O]
   coefficients: [1, 1, 3]
 tags: [mineral, solid]
@@ -80,35 +80,35 @@ std::string elements = R"xyz(
 std::string substances = R"xyz(
 - name: H2O(aq)
   formula:
-    label: H2O
+    formula: H2O
     symbols: [H, O]
     coefficients: [2, 1]
   tags: [ aqueous ]
 
 - name: Na+(aq)
   formula:
-    label: Na+
+    formula: Na+
     symbols: [Na, Z]
     coefficients: [1, 1]
   tags: [ aqueous ]
 
 - name: Cl-(aq)
   formula:
-    label: Cl-
+    formula: Cl-
     symbols: [Cl, Z]
     coefficients: [1, -1]
   tags: [ aqueous ]
 
 - name: H2O(g)
   formula:
-    label: H2O
+    formula: H2O
     symbols: [H, O]
     coefficients: [2, 1]
   tags: [ gaseous ]
 
 - name: CO2(g)
   formula:
-    label: CO2
+    formula: CO2
     symbols: [C, O]
     coefficients: [1, 2]
   tags: [ gaseous ]
@@ -119,9 +119,9 @@ std::string substances = R"xyz(
 
 TEST_CASE("Testing SerializationYAML", "[SerializationYAML]")
 {
-    Formula formula = yaml(strings::formula);
+    SubstanceFormula formula = yaml(strings::formula);
 
-    CHECK( formula.str() == "CO2" );
+    CHECK( formula.formula() == "CO2" );
     CHECK( formula.symbols().size() == 2 );
     CHECK( formula.coefficient("C") == 1 );
     CHECK( formula.coefficient("O") == 2 );
@@ -138,7 +138,7 @@ TEST_CASE("Testing SerializationYAML", "[SerializationYAML]")
 
     Substance substance = yaml(strings::substance);
 
-    CHECK( substance.formula().equivalent("CaCO3") );
+    CHECK( substance.formula().equivalent(SubstanceFormula("CaCO3")) );
     CHECK( substance.name() == "Calcite" );
     CHECK( substance.tags().size() == 2 );
     CHECK( substance.tags().at(0) == "mineral" );
@@ -171,27 +171,27 @@ TEST_CASE("Testing SerializationYAML", "[SerializationYAML]")
     CHECK( substances.size() == 5 );
 
     CHECK( substances[0].name() == "H2O(aq)" );
-    CHECK( substances[0].formula().equivalent("H2O") );
+    CHECK( substances[0].formula().equivalent(SubstanceFormula("H2O")) );
     CHECK( substances[0].tags().size() == 1 );
     CHECK( substances[0].tags().at(0) == "aqueous" );
 
     CHECK( substances[1].name() == "Na+(aq)" );
-    CHECK( substances[1].formula().equivalent("Na+") );
+    CHECK( substances[1].formula().equivalent(SubstanceFormula("Na+")) );
     CHECK( substances[1].tags().size() == 1 );
     CHECK( substances[1].tags().at(0) == "aqueous" );
 
     CHECK( substances[2].name() == "Cl-(aq)" );
-    CHECK( substances[2].formula().equivalent("Cl-") );
+    CHECK( substances[2].formula().equivalent(SubstanceFormula("Cl-")) );
     CHECK( substances[2].tags().size() == 1 );
     CHECK( substances[2].tags().at(0) == "aqueous" );
 
     CHECK( substances[3].name() == "H2O(g)" );
-    CHECK( substances[3].formula().equivalent("H2O") );
+    CHECK( substances[3].formula().equivalent(SubstanceFormula("H2O")) );
     CHECK( substances[3].tags().size() == 1 );
     CHECK( substances[3].tags().at(0) == "gaseous" );
 
     CHECK( substances[4].name() == "CO2(g)" );
-    CHECK( substances[4].formula().equivalent("CO2") );
+    CHECK( substances[4].formula().equivalent(SubstanceFormula("CO2")) );
     CHECK( substances[4].tags().size() == 1 );
     CHECK( substances[4].tags().at(0) == "gaseous" );
 }
@@ -199,7 +199,7 @@ TEST_CASE("Testing SerializationYAML", "[SerializationYAML]")
 
 json j_formula = R"xyz(
 {
-  "label": "CO2",
+  "formula": "CO2",
   "symbols": ["C", "O"],
   "coefficients": [1, 2]
 }
@@ -220,7 +220,7 @@ json j_substance = R"xyz(
 {
   "name": "Calcite",
   "formula": {
-    "label": "CaCO3",
+    "formula": "CaCO3",
     "symbols": ["C", "Ca", "O"],
     "coefficients": [1, 1, 3]
   },
@@ -262,7 +262,7 @@ json j_substances = R"xyz(
   {
     "name": "H2O(aq)",
     "formula": {
-      "label": "H2O",
+      "formula": "H2O",
       "symbols": ["H", "O"],
       "coefficients": [2, 1]
     },
@@ -271,7 +271,7 @@ json j_substances = R"xyz(
   {
     "name": "Na+(aq)",
     "formula": {
-      "label": "Na+",
+      "formula": "Na+",
       "symbols": ["Na", "Z"],
       "coefficients": [1, 1]
     },
@@ -280,7 +280,7 @@ json j_substances = R"xyz(
   {
     "name": "Cl-(aq)",
     "formula": {
-      "label": "Cl-",
+      "formula": "Cl-",
       "symbols": ["Cl", "Z"],
       "coefficients": [1, -1]
     },
@@ -289,7 +289,7 @@ json j_substances = R"xyz(
   {
     "name": "H2O(g)",
     "formula": {
-      "label": "H2O",
+      "formula": "H2O",
       "symbols": ["H", "O"],
       "coefficients": [2, 1]
     },
@@ -298,7 +298,7 @@ json j_substances = R"xyz(
   {
     "name": "CO2(g)",
     "formula": {
-      "label": "CO2",
+      "formula": "CO2",
       "symbols": ["C", "O"],
       "coefficients": [1, 2]
     },
@@ -310,9 +310,9 @@ json j_substances = R"xyz(
 
 TEST_CASE("Testing SerializationJSON", "[SerializationJSON]")
 {
-    Formula formula = j_formula.get<Formula>();
+    SubstanceFormula formula = j_formula.get<SubstanceFormula>();
 
-    CHECK( formula.str() == "CO2" );
+    CHECK( formula.formula() == "CO2" );
     CHECK( formula.symbols().size() == 2 );
     CHECK( formula.coefficient("C") == 1 );
     CHECK( formula.coefficient("O") == 2 );
@@ -329,7 +329,7 @@ TEST_CASE("Testing SerializationJSON", "[SerializationJSON]")
 
     Substance substance = j_substance;
 
-    CHECK( substance.formula().equivalent("CaCO3") );
+    CHECK( substance.formula().equivalent(SubstanceFormula("CaCO3")) );
     CHECK( substance.name() == "Calcite" );
     CHECK( substance.tags().size() == 2 );
     CHECK( substance.tags().at(0) == "mineral" );
@@ -362,27 +362,27 @@ TEST_CASE("Testing SerializationJSON", "[SerializationJSON]")
     CHECK( substances.size() == 5 );
 
     CHECK( substances[0].name() == "H2O(aq)" );
-    CHECK( substances[0].formula().equivalent("H2O") );
+    CHECK( substances[0].formula().equivalent(SubstanceFormula("H2O")) );
     CHECK( substances[0].tags().size() == 1 );
     CHECK( substances[0].tags().at(0) == "aqueous" );
 
     CHECK( substances[1].name() == "Na+(aq)" );
-    CHECK( substances[1].formula().equivalent("Na+") );
+    CHECK( substances[1].formula().equivalent(SubstanceFormula("Na+")) );
     CHECK( substances[1].tags().size() == 1 );
     CHECK( substances[1].tags().at(0) == "aqueous" );
 
     CHECK( substances[2].name() == "Cl-(aq)" );
-    CHECK( substances[2].formula().equivalent("Cl-") );
+    CHECK( substances[2].formula().equivalent(SubstanceFormula("Cl-")) );
     CHECK( substances[2].tags().size() == 1 );
     CHECK( substances[2].tags().at(0) == "aqueous" );
 
     CHECK( substances[3].name() == "H2O(g)" );
-    CHECK( substances[3].formula().equivalent("H2O") );
+    CHECK( substances[3].formula().equivalent(SubstanceFormula("H2O")) );
     CHECK( substances[3].tags().size() == 1 );
     CHECK( substances[3].tags().at(0) == "gaseous" );
 
     CHECK( substances[4].name() == "CO2(g)" );
-    CHECK( substances[4].formula().equivalent("CO2") );
+    CHECK( substances[4].formula().equivalent(SubstanceFormula("CO2")) );
     CHECK( substances[4].tags().size() == 1 );
     CHECK( substances[4].tags().at(0) == "gaseous" );
 }
@@ -0,0 +1,113 @@
+// Atomik is a library that implements basic chemical concepts such as elements, substances, and reactions.
+//
+// Copyright (C) 2018-2019 Allan Leal and Reaktoro Contributors
+//
+// This library is free software; you can redistribute it and/or
+// modify it under the terms of the GNU Lesser General Public
+// License as published by the Free Software Foundation; either
+// version 2.1 of the License, or (at your option) any later version.
+//
+// This library is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+// Lesser General Public License for more details.
+//
+// You should have received a copy of the GNU Lesser General Public License
+// along with this library. If not, see <http://www.gnu.org/licenses/>.
+
+#include "SnapshotCache.hpp"
+
+// C++ includes
+#include <cstdio>
+#include <cstdlib>
+#include <filesystem>
+#include <mutex>
+
+// Atomik includes
+#include <Atomik/BinaryDatabase.hpp>
+#include <Atomik/Tracing.hpp>
+
+#ifndef ATOMIK_VERSION
+#define ATOMIK_VERSION "0.1"
+#endif
+
+namespace Atomik {
+namespace {
+
+/// Return the mutex protecting the directory of the snapshot cache.
+auto cacheMutex() -> std::mutex&
+{
+    static std::mutex mutex;
+    return mutex;
+}
+
+/// Return the directory of the snapshot cache (initialized from the environment).
+auto cacheDirectory() -> std::string&
+{
+    static std::string directory = []() -> std::string {
+        const auto env = std::getenv("ATOMIK_SNAPSHOT_CACHE");
+        return env ? env : "";
+    }();
+    return directory;
+}
+
+} // namespace
+
+auto enableSnapshotCache(const std::string& directory) -> void
+{
+    std::lock_guard lock(cacheMutex());
+    cacheDirectory() = directory;
+}
+
+auto disableSnapshotCache() -> void
+{
+    std::lock_guard lock(cacheMutex());
+    cacheDirectory().clear();
+}
+
+auto snapshotCacheDirectory() -> std::string
+{
+    std::lock_guard lock(cacheMutex());
+    return cacheDirectory();
+}
+
+auto snapshotPath(std::string_view kind, std::string_view content) -> std::string
+{
+    const auto directory = snapshotCacheDirectory();
+    if(directory.empty())
+        return {};
+    char key[64];
+    std::snprintf(key, sizeof(key), "-%016llx-%llu-v", static_cast<unsigned long long>(BinaryFormat::hash(content)), static_cast<unsigned long long>(content.size()));
+    const auto filename = std::string(kind) + key + ATOMIK_VERSION + "-b" + std::to_string(BinaryFormat::version) + ".atomikdb";
+    return (std::filesystem::path(directory) / filename).string();
+}
+
+auto readSnapshot(std::string_view kind, std::string_view content) -> std::optional<Database>
+{
+    ATOMIK_TRACE("read snapshot");
+    const auto path = snapshotPath(kind, content);
+    std::error_code ec;
+    if(path.empty() || !std::filesystem::exists(path, ec))
+        return {};
+    try {
+        return MappedDatabase(path).database();
+    }
+    catch(const std::exception&) {
+        return {}; // an invalid snapshot is replaced after the source is parsed again
+    }
+}
+
+auto writeSnapshot(std::string_view kind, std::string_view content, const Database& db) -> void
+{
+    ATOMIK_TRACE("write snapshot");
+    const auto path = snapshotPath(kind, content);
+    if(path.empty())
+        return;
+    try {
+        std::filesystem::create_directories(std::filesystem::path(path).parent_path());
+        writeBinaryDatabase(db, path);
+    }
+    catch(const std::exception&) {}
+}
+
+} // namespace Atomik
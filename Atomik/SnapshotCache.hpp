@@ -0,0 +1,53 @@
+// Atomik is a library that implements basic chemical concepts such as elements, substances, and reactions.
+//
+// Copyright (C) 2018-2019 Allan Leal and Reaktoro Contributors
+//
+// This library is free software; you can redistribute it and/or
+// modify it under the terms of the GNU Lesser General Public
+// License as published by the Free Software Foundation; either
+// version 2.1 of the License, or (at your option) any later version.
+//
+// This library is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+// Lesser General Public License for more details.
+//
+// You should have received a copy of the GNU Lesser General Public License
+// along with this library. If not, see <http://www.gnu.org/licenses/>.
+
+#pragma once
+
+// C++ includes
+#include <optional>
+#include <string>
+#include <string_view>
+
+// Atomik includes
+#include <Atomik/Database.hpp>
+
+namespace Atomik {
+
+/// Enable the cache of binary snapshots of text databases, storing the snapshots in a given directory.
+/// The cache is disabled by default, unless the environment variable `ATOMIK_SNAPSHOT_CACHE` names a directory.
+/// Once enabled, `loadElementsFile` and `loadSubstancesFile` write a binary snapshot of every file they parse
+/// and use it in later loads of a file with the same content.
+auto enableSnapshotCache(const std::string& directory) -> void;
+
+/// Disable the cache of binary snapshots of text databases (existing snapshots are kept on disk).
+auto disableSnapshotCache() -> void;
+
+/// Return the directory of the snapshot cache, or an empty string if the cache is disabled.
+auto snapshotCacheDirectory() -> std::string;
+
+/// Return the path of the snapshot of a source of given kind and content, or an empty string if the cache is disabled.
+/// The path depends on the hash and size of the content, the library version, and the binary format version.
+auto snapshotPath(std::string_view kind, std::string_view content) -> std::string;
+
+/// Return the database in the snapshot of a source of given kind and content, if the cache has a valid one.
+auto readSnapshot(std::string_view kind, std::string_view content) -> std::optional<Database>;
+
+/// Store the database parsed from a source of given kind and content in the snapshot cache (if enabled).
+/// Failures are ignored, since the cache only avoids parsing the source again.
+auto writeSnapshot(std::string_view kind, std::string_view content, const Database& db) -> void;
+
+} // namespace Atomik
@@ -0,0 +1,120 @@
+// Atomik is a library that implements basic chemical concepts such as elements, substances, and reactions.
+//
+// Copyright (C) 2018-2019 Allan Leal and Reaktoro Contributors
+//
+// This library is free software; you can redistribute it and/or
+// modify it under the terms of the GNU Lesser General Public
+// License as published by the Free Software Foundation; either
+// version 2.1 of the License, or (at your option) any later version.
+//
+// This library is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+// Lesser General Public License for more details.
+//
+// You should have received a copy of the GNU Lesser General Public License
+// along with this library. If not, see <http://www.gnu.org/licenses/>.
+// Catch includes
+#include <catch2/catch.hpp>
+
+// C++ includes
+#include <filesystem>
+#include <fstream>
+
+// Atomik includes
+#include <Atomik/Elements.hpp>
+#include <Atomik/Serialization.hpp>
+#include <Atomik/SnapshotCache.hpp>
+#include <Atomik/StreamingWriter.hpp>
+#include <Atomik/Substances.hpp>
+using namespace Atomik;
+
+TEST_CASE("Testing SnapshotCache", "[SnapshotCache]")
+{
+    namespace fs = std::filesystem;
+
+    const auto directory = fs::temp_directory_path() / "SnapshotCache.test";
+    const auto cache = directory / "cache";
+    const auto elementsPath = (directory / "elements.yml").string();
+    const auto substancesPath = (directory / "substances.yml").string();
+    fs::remove_all(directory);
+    fs::create_directories(directory);
+
+    const Substances substances({
+        Substance("H2O").replaceName("H2O(aq)").replaceTags({"aqueous", "neutral"}),
+        Substance("HCO3-").replaceName("HCO3-(aq)").replaceTags({"aqueous", "charged"}),
+        Substance("CaCO3").replaceName("Calcite").replaceTags({}),
+    });
+
+    const auto elements = Elements::PeriodicTable();
+
+    const auto save = [&](const auto& items, const std::string& path)
+    {
+        std::ofstream out(path);
+        writeYAML(out, items);
+    };
+
+    const auto numSnapshots = [&]()
+    {
+        return fs::exists(cache) ? std::distance(fs::directory_iterator(cache), fs::directory_iterator()) : 0;
+    };
+
+    const auto checkSubstances = [&](const Substances& loaded, const Substances& expected)
+    {
+        REQUIRE(loaded.size() == expected.size());
+        for(auto i = 0u; i < loaded.size(); ++i)
+            REQUIRE(loaded[i] == expected[i]);
+    };
+
+    save(substances, substancesPath);
+    save(elements, elementsPath);
+
+    SECTION("Testing loading without the cache")
+    {
+        disableSnapshotCache();
+        REQUIRE(snapshotCacheDirectory().empty());
+        REQUIRE(snapshotPath("substances", "content").empty());
+        checkSubstances(loadSubstancesFile(substancesPath), substances);
+        REQUIRE(numSnapshots() == 0);
+    }
+
+    SECTION("Testing loading with the cache")
+    {
+        enableSnapshotCache(cache.string());
+        REQUIRE(snapshotCacheDirectory() == cache.string());
+
+        checkSubstances(loadSubstancesFile(substancesPath), substances);
+        REQUIRE(numSnapshots() == 1);
+        checkSubstances(loadSubstancesFile(substancesPath), substances);
+        REQUIRE(numSnapshots() == 1);
+
+        const auto loadedElements = loadElementsFile(elementsPath);
+        REQUIRE(numSnapshots() == 2);
+        const auto cachedElements = loadElementsFile(elementsPath);
+        REQUIRE(cachedElements.size() == elements.size());
+        for(auto i = 0u; i < elements.size(); ++i)
+        {
+            REQUIRE(loadedElements[i] == elements[i]);
+            REQUIRE(cachedElements[i] == elements[i]);
+        }
+
+        // A changed source is parsed again and gets its own snapshot
+        const Substances changed({ Substance("CO2").replaceName("CO2(g)").replaceTags({"gaseous"}) });
+        save(changed, substancesPath);
+        checkSubstances(loadSubstancesFile(substancesPath), changed);
+        REQUIRE(numSnapshots() == 3);
+
+        // An invalid snapshot is ignored and replaced
+        std::ifstream in(substancesPath);
+        const std::string content((std::istreambuf_iterator<char>(in)), std::istreambuf_iterator<char>());
+        std::ofstream(snapshotPath("substances", content)) << "invalid";
+        checkSubstances(loadSubstancesFile(substancesPath), changed);
+        REQUIRE(readSnapshot("substances", content).has_value());
+
+        disableSnapshotCache();
+    }
+
+    REQUIRE_THROWS(loadSubstancesFile((directory / "missing.yml").string()));
+
+    fs::remove_all(directory);
+}
@@ -0,0 +1,324 @@
+// Atomik is a library that implements basic chemical concepts such as elements, substances, and reactions.
+//
+// Copyright (C) 2018-2019 Allan Leal and Reaktoro Contributors
+//
+// This library is free software; you can redistribute it and/or
+// modify it under the terms of the GNU Lesser General Public
+// License as published by the Free Software Foundation; either
+// version 2.1 of the License, or (at your option) any later version.
+//
+// This library is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+// Lesser General Public License for more details.
+//
+// You should have received a copy of the GNU Lesser General Public License
+// along with this library. If not, see <http://www.gnu.org/licenses/>.
+
+#include "StreamingLoader.hpp"
+
+// C++ includes
+#include <optional>
+#include <vector>
+
+// yaml-cpp includes
+#include <yaml-cpp/eventhandler.h>
+#include <yaml-cpp/parser.h>
+
+// Atomik includes
+#include <Atomik/Elements.hpp>
+#include <Atomik/Exception.hpp>
+#include <Atomik/Serialization.hpp>
+#include <Atomik/Substances.hpp>
+#include <Atomik/Tracing.hpp>
+
+namespace Atomik {
+namespace {
+
+/// A type used to assemble the records of a top-level YAML sequence from parsing events.
+/// Only the record being assembled is kept; it is handed over as soon as it is complete.
+class YAMLRecordHandler : public YAML::EventHandler
+{
+public:
+    /// Construct a YAMLRecordHandler object that calls a function with each complete record.
+    explicit YAMLRecordHandler(std::function<void(const YAML::Node&)> onRecord)
+    : m_onRecord(std::move(onRecord))
+    {}
+
+    auto OnDocumentStart(const YAML::Mark&) -> void override {}
+
+    auto OnDocumentEnd() -> void override {}
+
+    auto OnNull(const YAML::Mark&, YAML::anchor_t) -> void override
+    {
+        value(YAML::Node());
+    }
+
+    auto OnAlias(const YAML::Mark& mark, YAML::anchor_t) -> void override
+    {
+        error(true, "Could not stream the YAML records because aliases are not supported (line ", mark.line + 1, ").");
+    }
+
+    auto OnScalar(const YAML::Mark&, const std::string&, YAML::anchor_t, const std::string& scalar) -> void override
+    {
+        value(YAML::Node(scalar));
+    }
+
+    auto OnSequenceStart(const YAML::Mark& mark, const std::string&, YAML::anchor_t, YAML::EmitterStyle::value) -> void override
+    {
+        start(mark, YAML::NodeType::Sequence);
+    }
+
+    auto OnSequenceEnd() -> void override
+    {
+        end();
+    }
+
+    auto OnMapStart(const YAML::Mark& mark, const std::string&, YAML::anchor_t, YAML::EmitterStyle::value) -> void override
+    {
+        start(mark, YAML::NodeType::Map);
+    }
+
+    auto OnMapEnd() -> void override
+    {
+        end();
+    }
+
+private:
+    /// A node being assembled, with the pending key if it is a map.
+    struct Level
+    {
+        YAML::Node node;
+        std::optional<std::string> key;
+    };
+
+    /// Start a new sequence or map node.
+    auto start(const YAML::Mark& mark, YAML::NodeType::value type) -> void
+    {
+        if(!m_inSequence)
+        {
+            error(type != YAML::NodeType::Sequence, "Could not stream the YAML records because the document is not a sequence (line ", mark.line + 1, ").");
+            m_inSequence = true;
+            return;
+        }
+        m_levels.push_back({ YAML::Node(type), {} });
+    }
+
+    /// End the current sequence or map node.
+    auto end() -> void
+    {
+        if(m_levels.empty())
+        {
+            m_inSequence = false;
+            return;
+        }
+        auto node = std::move(m_levels.back().node);
+        m_levels.pop_back();
+        value(node);
+    }
+
+    /// Add a complete node to the node being assembled, or hand it over if it is a record.
+    auto value(const YAML::Node& node) -> void
+    {
+        if(m_levels.empty())
+        {
+            error(!m_inSequence, "Could not stream the YAML records because the document is not a sequence.");
+            m_onRecord(node);
+            return;
+        }
+        auto& level = m_levels.back();
+        if(level.node.IsSequence())
+            level.node.push_back(node);
+        else if(!level.key)
+            level.key = node.as<std::string>();
+        else
+        {
+            level.node[*level.key] = node;
+            level.key.reset();
+        }
+    }
+
+    /// The function called with each complete record.
+    std::function<void(const YAML::Node&)> m_onRecord;
+
+    /// The nodes being assembled, from the record down to the innermost node.
+    std::vector<Level> m_levels;
+
+    /// True while inside the top-level sequence.
+    bool m_inSequence = false;
+};
+
+/// A type used to assemble the records of a top-level JSON array from parsing events.
+/// Only the record being assembled is kept; it is handed over as soon as it is complete.
+class JSONRecordHandler : public Json::json_sax<json>
+{
+public:
+    /// Construct a JSONRecordHandler object that calls a function with each complete record.
+    explicit JSONRecordHandler(std::function<void(const json&)> onRecord)
+    : m_onRecord(std::move(onRecord))
+    {}
+
+    auto null() -> bool override { return value(nullptr); }
+
+    auto boolean(bool val) -> bool override { return value(val); }
+
+    auto number_integer(number_integer_t val) -> bool override { return value(val); }
+
+    auto number_unsigned(number_unsigned_t val) -> bool override { return value(val); }
+
+    auto number_float(number_float_t val, const string_t&) -> bool override { return value(val); }
+
+    auto string(string_t& val) -> bool override { return value(std::move(val)); }
+
+    auto binary(binary_t& val) -> bool override { return value(json::binary(std::move(val))); }
+
+    auto start_object(std::size_t) -> bool override { return start(json::object()); }
+
+    auto key(string_t& val) -> bool override
+    {
+        m_levels.back().key = std::move(val);
+        return true;
+    }
+
+    auto end_object() -> bool override { return end(); }
+
+    auto start_array(std::size_t) -> bool override { return start(json::array()); }
+
+    auto end_array() -> bool override { return end(); }
+
+    auto parse_error(std::size_t, const std::string&, const Json::detail::exception& ex) -> bool override
+    {
+        error(true, "Could not stream the JSON records because of a parsing error: ", ex.what());
+        return false;
+    }
+
+private:
+    /// A value being assembled, with the pending key if it is an object.
+    struct Level
+    {
+        json node;
+        std::string key;
+    };
+
+    /// Start a new array or object value.
+    auto start(json node) -> bool
+    {
+        if(!m_inArray)
+        {
+            error(!node.is_array(), "Could not stream the JSON records because the document is not an array.");
+            m_inArray = true;
+            return true;
+        }
+        m_levels.push_back({ std::move(node), {} });
+        return true;
+    }
+
+    /// End the current array or object value.
+    auto end() -> bool
+    {
+        if(m_levels.empty())
+        {
+            m_inArray = false;
+            return true;
+        }
+        auto node = std::move(m_levels.back().node);
+        m_levels.pop_back();
+        return value(std::move(node));
+    }
+
+    /// Add a complete value to the value being assembled, or hand it over if it is a record.
+    auto value(json node) -> bool
+    {
+        if(m_levels.empty())
+        {
+            error(!m_inArray, "Could not stream the JSON records because the document is not an array.");
+            m_onRecord(node);
+            return true;
+        }
+        auto& level = m_levels.back();
+        if(level.node.is_array())
+            level.node.push_back(std::move(node));
+        else level.node[level.key] = std::move(node);
+        return true;
+    }
+
+    /// The function called with each complete record.
+    std::function<void(const json&)> m_onRecord;
+
+    /// The values being assembled, from the record down to the innermost value.
+    std::vector<Level> m_levels;
+
+    /// True while inside the top-level array.
+    bool m_inArray = false;
+};
+
+/// Call a function with each record of a YAML sequence read from a stream.
+auto streamYAML(std::istream& input, std::function<void(const YAML::Node&)> onRecord) -> void
+{
+    YAML::Parser parser(input);
+    YAMLRecordHandler handler(std::move(onRecord));
+    parser.HandleNextDocument(handler);
+}
+
+/// Call a function with each record of a JSON array read from a stream.
+auto streamJSON(std::istream& input, std::function<void(const json&)> onRecord) -> void
+{
+    JSONRecordHandler handler(std::move(onRecord));
+    json::sax_parse(input, &handler);
+}
+
+} // namespace
+
+auto streamElementsYAML(std::istream& input, const std::function<void(Element&&)>& function) -> void
+{
+    streamYAML(input, [&](const YAML::Node& node) { function(node.as<Element>()); });
+}
+
+auto streamSubstancesYAML(std::istream& input, const std::function<void(Substance&&)>& function) -> void
+{
+    streamYAML(input, [&](const YAML::Node& node) { function(node.as<Substance>()); });
+}
+
+auto streamElementsJSON(std::istream& input, const std::function<void(Element&&)>& function) -> void
+{
+    streamJSON(input, [&](const json& j) { function(j.get<Element>()); });
+}
+
+auto streamSubstancesJSON(std::istream& input, const std::function<void(Substance&&)>& function) -> void
+{
+    streamJSON(input, [&](const json& j) { function(j.get<Substance>()); });
+}
+
+auto loadElementsYAML(std::istream& input) -> Elements
+{
+    ATOMIK_TRACE("loadElementsYAML");
+    Elements elements;
+    streamElementsYAML(input, [&](Element&& element) { elements.append(std::move(element)); });
+    return elements;
+}
+
+auto loadSubstancesYAML(std::istream& input) -> Substances
+{
+    ATOMIK_TRACE("loadSubstancesYAML");
+    Substances substances;
+    streamSubstancesYAML(input, [&](Substance&& substance) { substances.append(std::move(substance)); });
+    return substances;
+}
+
+auto loadElementsJSON(std::istream& input) -> Elements
+{
+    ATOMIK_TRACE("loadElementsJSON");
+    Elements elements;
+    streamElementsJSON(input, [&](Element&& element) { elements.append(std::move(element)); });
+    return elements;
+}
+
+auto loadSubstancesJSON(std::istream& input) -> Substances
+{
+    ATOMIK_TRACE("loadSubstancesJSON");
+    Substances substances;
+    streamSubstancesJSON(input, [&](Substance&& substance) { substances.append(std::move(substance)); });
+    return substances;
+}
+
+} // namespace Atomik
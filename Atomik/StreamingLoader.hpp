@@ -0,0 +1,67 @@
+// Atomik is a library that implements basic chemical concepts such as elements, substances, and reactions.
+//
+// Copyright (C) 2018-2019 Allan Leal and Reaktoro Contributors
+//
+// This library is free software; you can redistribute it and/or
+// modify it under the terms of the GNU Lesser General Public
+// License as published by the Free Software Foundation; either
+// version 2.1 of the License, or (at your option) any later version.
+//
+// This library is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+// Lesser General Public License for more details.
+//
+// You should have received a copy of the GNU Lesser General Public License
+// along with this library. If not, see <http://www.gnu.org/licenses/>.
+
+#pragma once
+
+// C++ includes
+#include <functional>
+#include <istream>
+
+// Atomik includes
+#include <Atomik/Element.hpp>
+#include <Atomik/Substance.hpp>
+
+namespace Atomik {
+
+// Forward declarations
+class Elements;
+class Substances;
+
+/// Call a function with each element of a YAML sequence read from a stream.
+/// The stream is parsed as a sequence of events rather than into a document tree, and only the record
+/// being read is kept in memory. Each record has the same schema as in `operator>>(const Node&, Element&)`.
+auto streamElementsYAML(std::istream& input, const std::function<void(Element&&)>& function) -> void;
+
+/// Call a function with each substance of a YAML sequence read from a stream.
+/// The stream is parsed as a sequence of events rather than into a document tree, and only the record
+/// being read is kept in memory. Each record has the same schema as in `operator>>(const Node&, Substance&)`.
+/// The function can, for example, append the substances to a SubstancesBuilder object.
+auto streamSubstancesYAML(std::istream& input, const std::function<void(Substance&&)>& function) -> void;
+
+/// Call a function with each element of a JSON array read from a stream.
+/// The stream is parsed as a sequence of events rather than into a document tree, and only the record
+/// being read is kept in memory. Each record has the same schema as in `from_json(const json&, Element&)`.
+auto streamElementsJSON(std::istream& input, const std::function<void(Element&&)>& function) -> void;
+
+/// Call a function with each substance of a JSON array read from a stream.
+/// The stream is parsed as a sequence of events rather than into a document tree, and only the record
+/// being read is kept in memory. Each record has the same schema as in `from_json(const json&, Substance&)`.
+auto streamSubstancesJSON(std::istream& input, const std::function<void(Substance&&)>& function) -> void;
+
+/// Return the elements of a YAML sequence read from a stream one record at a time.
+auto loadElementsYAML(std::istream& input) -> Elements;
+
+/// Return the substances of a YAML sequence read from a stream one record at a time.
+auto loadSubstancesYAML(std::istream& input) -> Substances;
+
+/// Return the elements of a JSON array read from a stream one record at a time.
+auto loadElementsJSON(std::istream& input) -> Elements;
+
+/// Return the substances of a JSON array read from a stream one record at a time.
+auto loadSubstancesJSON(std::istream& input) -> Substances;
+
+} // namespace Atomik
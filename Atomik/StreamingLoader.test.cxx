@@ -0,0 +1,90 @@
+// Atomik is a library that implements basic chemical concepts such as elements, substances, and reactions.
+//
+// Copyright (C) 2018-2019 Allan Leal and Reaktoro Contributors
+//
+// This library is free software; you can redistribute it and/or
+// modify it under the terms of the GNU Lesser General Public
+// License as published by the Free Software Foundation; either
+// version 2.1 of the License, or (at your option) any later version.
+//
+// This library is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+// Lesser General Public License for more details.
+//
+// You should have received a copy of the GNU Lesser General Public License
+// along with this library. If not, see <http://www.gnu.org/licenses/>.
+
+// Catch includes
+#include <catch2/catch.hpp>
+
+// C++ includes
+#include <fstream>
+#include <sstream>
+
+// Atomik includes
+#include <Atomik/Elements.hpp>
+#include <Atomik/Serialization.hpp>
+#include <Atomik/StreamingLoader.hpp>
+#include <Atomik/Substances.hpp>
+#include <Atomik/SubstancesBuilder.hpp>
+using namespace Atomik;
+
+TEST_CASE("Testing StreamingLoader", "[StreamingLoader]")
+{
+    const Substances substances({
+        Substance("H2O").replaceName("H2O(aq)").replaceTags({"aqueous", "neutral"}),
+        Substance("HCO3-").replaceName("HCO3-(aq)").replaceTags({"aqueous", "charged"}),
+        Substance("CaCO3").replaceName("Calcite").replaceTags({}),
+    });
+
+    const auto tagged = Elements({ Element({ .symbol = "Na", .name = "Sodium", .atomicNumber = 11, .atomicWeight = 0.022989768, .electronegativity = 0.93, .tags = {"alkali"} }) });
+
+    SECTION("Testing YAML streaming")
+    {
+        YAML::Node node;
+        node << substances;
+        std::stringstream ss;
+        ss << node;
+
+        const auto loaded = loadSubstancesYAML(ss);
+        REQUIRE(loaded.size() == substances.size());
+        for(auto i = 0u; i < loaded.size(); ++i)
+            REQUIRE(loaded[i] == substances[i]);
+
+        YAML::Node enode;
+        enode << tagged;
+        std::stringstream ess;
+        ess << enode;
+        const auto loadedElements = loadElementsYAML(ess);
+        REQUIRE(loadedElements.size() == 1);
+        REQUIRE(loadedElements[0] == tagged[0]);
+
+        std::stringstream invalid("name: not a sequence");
+        REQUIRE_THROWS(loadSubstancesYAML(invalid));
+    }
+
+    SECTION("Testing JSON streaming into a builder")
+    {
+        json j = substances;
+        std::stringstream ss;
+        ss << j;
+
+        SubstancesBuilder builder;
+        streamSubstancesJSON(ss, [&](Substance&& substance) { builder.append(std::move(substance)); });
+        const auto loaded = builder.seal();
+        REQUIRE(loaded.size() == substances.size());
+        for(auto i = 0u; i < loaded.size(); ++i)
+            REQUIRE(loaded[i] == substances[i]);
+
+        json ej = tagged;
+        std::stringstream ess;
+        ess << ej;
+        const auto loadedElements = loadElementsJSON(ess);
+        REQUIRE(loadedElements.size() == 1);
+        REQUIRE(loadedElements[0] == tagged[0]);
+
+        std::stringstream invalid("[{\"name\": ");
+        REQUIRE_THROWS(loadSubstancesJSON(invalid));
+    }
+}
@@ -0,0 +1,395 @@
+// Atomik is a library that implements basic chemical concepts such as elements, substances, and reactions.
+//
+// Copyright (C) 2018-2019 Allan Leal and Reaktoro Contributors
+//
+// This library is free software; you can redistribute it and/or
+// modify it under the terms of the GNU Lesser General Public
+// License as published by the Free Software Foundation; either
+// version 2.1 of the License, or (at your option) any later version.
+//
+// This library is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+// Lesser General Public License for more details.
+//
+// You should have received a copy of the GNU Lesser General Public License
+// along with this library. If not, see <http://www.gnu.org/licenses/>.
+
+#include "StreamingWriter.hpp"
+
+// C++ includes
+#include <cctype>
+#include <cerrno>
+#include <charconv>
+#include <cmath>
+#include <memory_resource>
+#include <string>
+#include <string_view>
+#include <vector>
+
+// POSIX includes
+#if defined(_WIN32)
+#include <io.h>
+#else
+#include <unistd.h>
+#endif
+
+// Atomik includes
+#include <Atomik/Elements.hpp>
+#include <Atomik/Exception.hpp>
+#include <Atomik/InternedString.hpp>
+#include <Atomik/Substances.hpp>
+
+namespace Atomik {
+namespace {
+
+/// The number of characters accumulated before the output is flushed.
+constexpr std::size_t bufferCapacity = 1 << 16;
+
+/// A type used to accumulate formatted text and flush it to a stream or file descriptor in large blocks.
+class OutputBuffer
+{
+public:
+    /// Construct an OutputBuffer object writing to a stream.
+    explicit OutputBuffer(std::ostream& out) : m_out(&out) { m_buffer.reserve(bufferCapacity + 64); }
+
+    /// Construct an OutputBuffer object writing to a file descriptor.
+    explicit OutputBuffer(int fd) : m_fd(fd) { m_buffer.reserve(bufferCapacity + 64); }
+
+    /// Flush the remaining text (errors are reported only by an explicit call to `flush`).
+    ~OutputBuffer() { try { flush(); } catch(...) {} }
+
+    /// Append text to the buffer.
+    auto operator<<(std::string_view str) -> OutputBuffer&
+    {
+        m_buffer.append(str);
+        if(m_buffer.size() >= bufferCapacity)
+            flush();
+        return *this;
+    }
+
+    /// Append a character to the buffer.
+    auto operator<<(char c) -> OutputBuffer&
+    {
+        m_buffer.push_back(c);
+        return *this;
+    }
+
+    /// Append an unsigned integer to the buffer.
+    auto operator<<(std::size_t value) -> OutputBuffer&
+    {
+        char chars[24];
+        const auto res = std::to_chars(chars, chars + sizeof(chars), value);
+        return *this << std::string_view(chars, res.ptr - chars);
+    }
+
+    /// Append the shortest representation of a finite floating-point number that reads back to the same value.
+    /// @param decimalPoint Whether to append `.0` to integral values (as JSON writers conventionally do).
+    auto number(double value, bool decimalPoint) -> OutputBuffer&
+    {
+        char chars[32];
+        const auto res = std::to_chars(chars, chars + sizeof(chars), value);
+        const std::string_view str(chars, res.ptr - chars);
+        *this << str;
+        if(decimalPoint && str.find_first_of(".e") == std::string_view::npos)
+            *this << ".0";
+        return *this;
+    }
+
+    /// Write the accumulated text to the output.
+    auto flush() -> void
+    {
+        if(m_out)
+        {
+            m_out->write(m_buffer.data(), m_buffer.size());
+            error(!*m_out, "Could not write the serialized data to the output stream.");
+        }
+        else
+        {
+            for(std::size_t written = 0; written < m_buffer.size(); )
+            {
+#if defined(_WIN32)
+                const auto count = _write(m_fd, m_buffer.data() + written, unsigned(m_buffer.size() - written));
+#else
+                const auto count = write(m_fd, m_buffer.data() + written, m_buffer.size() - written);
+#endif
+                if(count < 0 && errno == EINTR)
+                    continue; // interrupted by a signal before writing anything
+                error(count < 0, "Could not write the serialized data to the file descriptor ", m_fd, ".");
+                written += count;
+            }
+        }
+        m_buffer.clear();
+    }
+
+private:
+    /// The text accumulated since the last flush.
+    std::string m_buffer;
+
+    /// The stream to write to (if not writing to a file descriptor).
+    std::ostream* m_out = nullptr;
+
+    /// The file descriptor to write to (if not writing to a stream).
+    int m_fd = -1;
+};
+
+/// The plain YAML scalars that YAML 1.1 or 1.2 readers resolve as booleans or nulls rather than strings.
+constexpr std::string_view nonStringYAML[] = {
+    "y", "Y", "yes", "Yes", "YES", "n", "N", "no", "No", "NO",
+    "true", "True", "TRUE", "false", "False", "FALSE",
+    "on", "On", "ON", "off", "Off", "OFF",
+    "null", "Null", "NULL",
+};
+
+/// Return true if a string can be written as a plain YAML scalar that reads back as the same string.
+/// Strings that other YAML readers would resolve as booleans, nulls or numbers (e.g., `yes`, `NO`, `null`, `1e5`) are quoted.
+auto isPlainYAML(std::string_view str) -> bool
+{
+    if(str.empty() || str.front() == '-' || str.front() == '.' || str.front() == '+')
+        return false;
+    if(std::isdigit(static_cast<unsigned char>(str.front())))
+        return false; // a possible number, such as `12`, `0x1F` or `1e5`
+    for(const auto word : nonStringYAML)
+        if(str == word)
+            return false;
+    for(const auto c : str)
+        if(!std::isalnum(static_cast<unsigned char>(c)) && c != '_' && c != '.' && c != '(' && c != ')' && c != '+' && c != '-')
+            return false;
+    return true;
+}
+
+/// Append a string as a double-quoted string with the escapes common to YAML and JSON.
+auto quoted(OutputBuffer& out, std::string_view str) -> void
+{
+    static constexpr char hex[] = "0123456789abcdef";
+    out << '"';
+    for(const auto c : str)
+    {
+        switch(c)
+        {
+        case '"': out << "\\\""; break;
+        case '\\': out << "\\\\"; break;
+        case '\n': out << "\\n"; break;
+        case '\r': out << "\\r"; break;
+        case '\t': out << "\\t"; break;
+        default:
+            if(static_cast<unsigned char>(c) < 0x20)
+                out << "\\u00" << hex[c >> 4] << hex[c & 0xf];
+            else out << c;
+        }
+    }
+    out << '"';
+}
+
+/// A type used to write elements and substances in YAML format.
+struct YAMLFormat
+{
+    OutputBuffer& out;
+
+    auto string(InternedString str) -> void
+    {
+        string(str.view());
+    }
+
+    auto string(std::string_view str) -> void
+    {
+        if(isPlainYAML(str)) out << str;
+        else quoted(out, str);
+    }
+
+    auto number(double value) -> void
+    {
+        if(std::isnan(value)) out << ".nan";
+        else if(std::isinf(value)) out << (value > 0 ? ".inf" : "-.inf");
+        else out.number(value, false);
+    }
+
+    template<typename Strings>
+    auto strings(const Strings& strs) -> void
+    {
+        out << '[';
+        for(auto i = 0u; i < strs.size(); ++i)
+        {
+            if(i) out << ", ";
+            string(strs[i]);
+        }
+        out << ']';
+    }
+
+    auto numbers(const std::pmr::vector<double>& values) -> void
+    {
+        out << '[';
+        for(auto i = 0u; i < values.size(); ++i)
+        {
+            if(i) out << ", ";
+            number(values[i]);
+        }
+        out << ']';
+    }
+
+    auto write(const Element& element) -> void
+    {
+        out << "- symbol: "; string(element.symbol());
+        out << "\n  name: "; string(element.name());
+        out << "\n  atomicNumber: " << element.atomicNumber();
+        out << "\n  atomicWeight: "; number(element.atomicWeight());
+        out << "\n  electronegativity: "; number(element.electronegativity());
+        out << "\n  tags: "; strings(element.tags());
+        out << '\n';
+    }
+
+    auto write(const Substance& substance) -> void
+    {
+        const auto& formula = substance.formula();
+        out << "- formula:\n    formula: "; string(formula.formula());
+        out << "\n    symbols: "; strings(formula.symbols());
+        out << "\n    coefficients: "; numbers(formula.coefficients());
+        out << "\n  name: "; string(substance.name());
+        out << "\n  tags: "; strings(substance.tags());
+        out << '\n';
+    }
+
+    template<typename Items>
+    auto writeAll(const Items& items) -> void
+    {
+        if(items.size() == 0)
+            out << "[]\n";
+        for(const auto& item : items)
+            write(item);
+        out.flush();
+    }
+};
+
+/// A type used to write elements and substances in JSON format.
+struct JSONFormat
+{
+    OutputBuffer& out;
+
+    auto string(InternedString str) -> void
+    {
+        string(str.view());
+    }
+
+    auto string(std::string_view str) -> void
+    {
+        quoted(out, str);
+    }
+
+    auto number(double value) -> void
+    {
+        if(std::isfinite(value)) out.number(value, true);
+        else out << "null";
+    }
+
+    template<typename Strings>
+    auto strings(const Strings& strs) -> void
+    {
+        out << '[';
+        for(auto i = 0u; i < strs.size(); ++i)
+        {
+            if(i) out << ',';
+            string(strs[i]);
+        }
+        out << ']';
+    }
+
+    auto numbers(const std::pmr::vector<double>& values) -> void
+    {
+        out << '[';
+        for(auto i = 0u; i < values.size(); ++i)
+        {
+            if(i) out << ',';
+            number(values[i]);
+        }
+        out << ']';
+    }
+
+    auto write(const Element& element) -> void
+    {
+        out << "{\"atomicNumber\":" << element.atomicNumber();
+        out << ",\"atomicWeight\":"; number(element.atomicWeight());
+        out << ",\"electronegativity\":"; number(element.electronegativity());
+        out << ",\"name\":"; string(element.name());
+        out << ",\"symbol\":"; string(element.symbol());
+        out << ",\"tags\":"; strings(element.tags());
+        out << '}';
+    }
+
+    auto write(const Substance& substance) -> void
+    {
+        const auto& formula = substance.formula();
+        out << "{\"formula\":{\"coefficients\":"; numbers(formula.coefficients());
+        out << ",\"formula\":"; string(formula.formula());
+        out << ",\"symbols\":"; strings(formula.symbols());
+        out << "},\"name\":"; string(substance.name());
+        out << ",\"tags\":"; strings(substance.tags());
+        out << '}';
+    }
+
+    template<typename Items>
+    auto writeAll(const Items& items) -> void
+    {
+        out << '[';
+        auto first = true;
+        for(const auto& item : items)
+        {
+            if(!first) out << ',';
+            write(item);
+            first = false;
+        }
+        out << "]\n";
+        out.flush();
+    }
+};
+
+/// Write items to an output in a given format.
+template<typename Format, typename Output, typename Items>
+auto writeTo(Output&& output, const Items& items) -> void
+{
+    OutputBuffer buffer(output);
+    Format{ buffer }.writeAll(items);
+}
+
+} // namespace
+
+auto writeYAML(std::ostream& out, const Elements& elements) -> void
+{
+    writeTo<YAMLFormat>(out, elements);
+}
+
+auto writeYAML(std::ostream& out, const Substances& substances) -> void
+{
+    writeTo<YAMLFormat>(out, substances);
+}
+
+auto writeJSON(std::ostream& out, const Elements& elements) -> void
+{
+    writeTo<JSONFormat>(out, elements);
+}
+
+auto writeJSON(std::ostream& out, const Substances& substances) -> void
+{
+    writeTo<JSONFormat>(out, substances);
+}
+
+auto writeYAML(int fd, const Elements& elements) -> void
+{
+    writeTo<YAMLFormat>(fd, elements);
+}
+
+auto writeYAML(int fd, const Substances& substances) -> void
+{
+    writeTo<YAMLFormat>(fd, substances);
+}
+
+auto writeJSON(int fd, const Elements& elements) -> void
+{
+    writeTo<JSONFormat>(fd, elements);
+}
+
+auto writeJSON(int fd, const Substances& substances) -> void
+{
+    writeTo<JSONFormat>(fd, substances);
+}
+
+} // namespace Atomik
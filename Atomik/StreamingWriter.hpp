@@ -0,0 +1,61 @@
+// Atomik is a library that implements basic chemical concepts such as elements, substances, and reactions.
+//
+// Copyright (C) 2018-2019 Allan Leal and Reaktoro Contributors
+//
+// This library is free software; you can redistribute it and/or
+// modify it under the terms of the GNU Lesser General Public
+// License as published by the Free Software Foundation; either
+// version 2.1 of the License, or (at your option) any later version.
+//
+// This library is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+// Lesser General Public License for more details.
+//
+// You should have received a copy of the GNU Lesser General Public License
+// along with this library. If not, see <http://www.gnu.org/licenses/>.
+
+#pragma once
+
+// C++ includes
+#include <ostream>
+
+namespace Atomik {
+
+// Forward declarations
+class Elements;
+class Substances;
+
+/// Write elements in YAML format to a stream, without building a document tree.
+/// The output follows the same schema as `operator<<(Node&, const Elements&)` and can be read back with `operator>>`.
+auto writeYAML(std::ostream& out, const Elements& elements) -> void;
+
+/// Write substances in YAML format to a stream, without building a document tree.
+/// The output follows the same schema as `operator<<(Node&, const Substances&)` and can be read back with `operator>>`.
+auto writeYAML(std::ostream& out, const Substances& substances) -> void;
+
+/// Write elements in JSON format to a stream, without building a document tree.
+/// The output follows the same schema as `to_json(json&, const Elements&)` and can be read back with `from_json`.
+auto writeJSON(std::ostream& out, const Elements& elements) -> void;
+
+/// Write substances in JSON format to a stream, without building a document tree.
+/// The output follows the same schema as `to_json(json&, const Substances&)` and can be read back with `from_json`.
+auto writeJSON(std::ostream& out, const Substances& substances) -> void;
+
+/// Write elements in YAML format to a file descriptor, without building a document tree.
+/// @throw std::runtime_error When the output cannot be written.
+auto writeYAML(int fd, const Elements& elements) -> void;
+
+/// Write substances in YAML format to a file descriptor, without building a document tree.
+/// @throw std::runtime_error When the output cannot be written.
+auto writeYAML(int fd, const Substances& substances) -> void;
+
+/// Write elements in JSON format to a file descriptor, without building a document tree.
+/// @throw std::runtime_error When the output cannot be written.
+auto writeJSON(int fd, const Elements& elements) -> void;
+
+/// Write substances in JSON format to a file descriptor, without building a document tree.
+/// @throw std::runtime_error When the output cannot be written.
+auto writeJSON(int fd, const Substances& substances) -> void;
+
+} // namespace Atomik
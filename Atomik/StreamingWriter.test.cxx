@@ -0,0 +1,160 @@
+// Atomik is a library that implements basic chemical concepts such as elements, substances, and reactions.
+//
+// Copyright (C) 2018-2019 Allan Leal and Reaktoro Contributors
+//
+// This library is free software; you can redistribute it and/or
+// modify it under the terms of the GNU Lesser General Public
+// License as published by the Free Software Foundation; either
+// version 2.1 of the License, or (at your option) any later version.
+//
+// This library is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+// Lesser General Public License for more details.
+//
+// You should have received a copy of the GNU Lesser General Public License
+// along with this library. If not, see <http://www.gnu.org/licenses/>.
+// Catch includes
+#include <catch2/catch.hpp>
+
+// C++ includes
+#include <cstdio>
+#include <fstream>
+#include <sstream>
+#include <thread>
+
+// Atomik includes
+#include <Atomik/Elements.hpp>
+#include <Atomik/Serialization.hpp>
+#include <Atomik/StreamingLoader.hpp>
+#include <Atomik/StreamingWriter.hpp>
+#include <Atomik/Substances.hpp>
+
+// POSIX includes
+#if !defined(_WIN32)
+#include <pthread.h>
+#include <signal.h>
+#include <unistd.h>
+#endif
+using namespace Atomik;
+
+TEST_CASE("Testing StreamingWriter", "[StreamingWriter]")
+{
+    const Substances substances({
+        Substance("H2O").replaceName("H2O(aq)").replaceTags({"aqueous", "neutral"}),
+        Substance("HCO3-").replaceName("HCO3-(aq)").replaceTags({"aqueous", "charged"}),
+        Substance("CaCO3").replaceName("Calcite: \"trigonal\"").replaceTags({}),
+        Substance("Na+").replaceName("null").replaceTags({"- dash", "line\nbreak"}),
+    });
+
+    const auto elements = Elements::PeriodicTable();
+
+    SECTION("Testing YAML output")
+    {
+        std::stringstream ss;
+        writeYAML(ss, substances);
+        Substances loaded;
+        YAML::Load(ss.str()) >> loaded;
+        REQUIRE(loaded.size() == substances.size());
+        for(auto i = 0u; i < loaded.size(); ++i)
+            REQUIRE(loaded[i] == substances[i]);
+
+        std::stringstream ess;
+        writeYAML(ess, elements);
+        const auto loadedElements = loadElementsYAML(ess);
+        REQUIRE(loadedElements.size() == elements.size());
+        for(auto i = 0u; i < loadedElements.size(); ++i)
+            REQUIRE(loadedElements[i] == elements[i]);
+
+        // Test names that other YAML readers would resolve as booleans, nulls or numbers are quoted
+        const std::vector<std::string> names = { "yes", "NO", "true", "Off", "y", "~", "1e5", "0x1F", "+1", "H2O" };
+        std::vector<Substance> special;
+        for(const auto& name : names)
+            special.push_back(Substance("H2O").replaceName(name));
+        std::stringstream sss;
+        writeYAML(sss, Substances(special));
+        const auto node = YAML::Load(sss.str());
+        for(auto i = 0u; i < names.size(); ++i)
+        {
+            REQUIRE(node[i]["name"].as<std::string>() == names[i]);
+            REQUIRE(node[i]["name"].Tag() == (names[i] == "H2O" ? "?" : "!")); // the tag of plain scalars is `?`, and of quoted ones `!`
+        }
+    }
+
+    SECTION("Testing JSON output")
+    {
+        std::stringstream ss;
+        writeJSON(ss, substances);
+        REQUIRE(json::parse(ss.str()) == json(substances));
+
+        std::stringstream ess;
+        writeJSON(ess, elements);
+        REQUIRE(json::parse(ess.str()) == json(elements));
+        Elements loadedElements = json::parse(ess.str());
+        REQUIRE(loadedElements.size() == elements.size());
+        for(auto i = 0u; i < loadedElements.size(); ++i)
+            REQUIRE(loadedElements[i] == elements[i]);
+    }
+
+    SECTION("Testing output to a file descriptor")
+    {
+        const auto path = "StreamingWriter.test.json";
+        auto file = std::fopen(path, "w");
+        REQUIRE(file);
+        writeJSON(fileno(file), substances);
+        std::fclose(file);
+
+        std::ifstream in(path);
+        const auto loaded = loadSubstancesJSON(in);
+        REQUIRE(loaded.size() == substances.size());
+        for(auto i = 0u; i < loaded.size(); ++i)
+            REQUIRE(loaded[i] == substances[i]);
+        std::remove(path);
+    }
+
+#if !defined(_WIN32)
+    SECTION("Testing output to a file descriptor interrupted by a signal")
+    {
+        // Install a handler without SA_RESTART so a blocked write fails with EINTR
+        struct sigaction action = {}, previous = {};
+        action.sa_handler = [](int) {};
+        sigemptyset(&action.sa_mask);
+        REQUIRE(sigaction(SIGUSR1, &action, &previous) == 0);
+
+        std::vector<Substance> many;
+        for(auto i = 0; i < 4000; ++i)
+            many.push_back(Substance("CaCO3").replaceName("Calcite" + std::to_string(i)));
+        const Substances large(many);
+
+        std::stringstream expected;
+        writeJSON(expected, large);
+
+        int fds[2];
+        REQUIRE(pipe(fds) == 0);
+
+        // The writer blocks once the pipe is full, and is interrupted before the reader drains it
+        bool failed = false;
+        std::thread writer([&]() {
+            try { writeJSON(fds[1], large); }
+            catch(...) { failed = true; }
+            close(fds[1]);
+        });
+        for(auto i = 0; i < 10; ++i)
+        {
+            std::this_thread::sleep_for(std::chrono::milliseconds(5));
+            pthread_kill(writer.native_handle(), SIGUSR1);
+        }
+
+        std::string output;
+        char buffer[4096];
+        for(auto count = read(fds[0], buffer, sizeof(buffer)); count > 0; count = read(fds[0], buffer, sizeof(buffer)))
+            output.append(buffer, count);
+        writer.join();
+        close(fds[0]);
+        sigaction(SIGUSR1, &previous, nullptr);
+
+        REQUIRE_FALSE(failed);
+        REQUIRE(output == expected.str());
+    }
+#endif
+}
@@ -17,27 +17,25 @@
 
 #include "Substance.hpp"
 
+// C++ includes
+#include <algorithm>
+
 // Atomik includes
 #include <Atomik/Algorithms.hpp>
 #include <Atomik/Elements.hpp>
 #include <Atomik/Exception.hpp>
 #include <Atomik/Extract.hpp>
+#include <Atomik/Memory.hpp>
 #include <Atomik/StringList.hpp>
 #include <Atomik/SubstanceElements.hpp>
 #include <Atomik/SubstanceFormula.hpp>
 
 namespace Atomik {
-namespace {
-
-/// The default database of elements
-const Elements periodicElements = Elements::PeriodicTable();
-
-} // namespace
 
 struct Substance::Impl
 {
     /// The name of the substance such as `H2O(aq)`, `O2(g)`, `H+(aq)`.
-    std::string name;
+    InternedString name;
 
     /// The chemical formula of the substance such as `H2O`, `O2`, `H+`.
     SubstanceFormula formula;
@@ -46,15 +44,24 @@ struct Substance::Impl
     SubstanceElements elements;
 
     /// The type of the substance such as `aqueous`, `gaseous`, `liquid`, "mineral", etc..
-    std::string type;
+    InternedString type;
 
     /// The tags of the substance such as `organic`, `mineral`.
-    std::vector<std::string> tags;
+    std::pmr::vector<InternedString> tags{memoryResource()};
 
     /// Construct a default Substance::Impl instance
     Impl()
     {}
 
+    /// Construct a copy of a Substance::Impl instance with its tags allocated from the current memory resource
+    Impl(const Impl& other)
+    : name(other.name),
+      formula(other.formula),
+      elements(other.elements),
+      type(other.type),
+      tags(other.tags, memoryResource())
+    {}
+
     /// Construct a Substance::Impl instance
     Impl(const std::string& formulaStr, const Elements& db)
     : name(formulaStr),
@@ -70,110 +77,114 @@ struct Substance::Impl
     }
 
     /// Construct a Substance::Impl instance
-    Impl(const Args& args)
-    : name(args.name),
-      formula(args.formula),
-      elements(args.elements),
-      type(args.type),
-      tags(args.tags)
+    Impl(Args args)
+    : name(std::move(args.name)),
+      formula(std::move(args.formula)),
+      elements(std::move(args.elements)),
+      type(std::move(args.type)),
+      tags(intern(std::move(args.tags)))
+    {
+    }
+
+    /// Return the numeric data of the substance to be stored in the Substance object.
+    auto hot() const -> Hot
     {
+        const auto& coefficients = elements.coefficients();
+        Hot res;
+        res.molarMass = elements.molarMass();
+        res.charge = formula.charge();
+        res.numElements = coefficients.size();
+        if(res.numElements <= Hot::numInlineCoefficients)
+            std::copy(coefficients.begin(), coefficients.end(), res.inlineCoefficients);
+        else
+            res.coefficients = coefficients.data();
+        return res;
     }
 };
 
 Substance::Substance()
-: pimpl(new Impl())
+: pimpl(allocateShared<Impl>()), hot(pimpl->hot())
 {}
 
 Substance::Substance(const std::string& formula)
-: pimpl(new Impl(formula, periodicElements))
+: pimpl(allocateShared<Impl>(formula, Elements::Default())), hot(pimpl->hot())
 {}
 
 Substance::Substance(const std::string& formula, const Elements& db)
-: pimpl(new Impl(formula, db))
+: pimpl(allocateShared<Impl>(formula, db)), hot(pimpl->hot())
 {}
 
 Substance::Substance(const Args& args)
-: pimpl(new Impl(args))
+: pimpl(allocateShared<Impl>(args)), hot(pimpl->hot())
+{}
+
+Substance::Substance(Args&& args)
+: pimpl(allocateShared<Impl>(std::move(args))), hot(pimpl->hot())
+{}
+
+Substance::Substance(std::shared_ptr<Impl> pimpl)
+: pimpl(std::move(pimpl)), hot(this->pimpl->hot())
 {}
 
 auto Substance::replaceFormula(const std::string& formula) -> Substance
 {
-    return replaceFormula(formula, elements());
+    return replaceFormula(formula, Elements::Default());
 }
 
 auto Substance::replaceFormula(const std::string& formula, const Elements& db) -> Substance
 {
-    auto attributes = pimpl->attributes;
-    attributes.formula = formula;
-    return Substance(attributes, db);
+    auto impl = allocateShared<Impl>(*pimpl);
+    impl->formula = SubstanceFormula(formula);
+    impl->elements = SubstanceElements({
+        .elements = db.withSymbols(impl->formula.symbols()),
+        .coefficients = impl->formula.coefficients(),
+        .oxidationStates = {}
+    });
+    return Substance(std::move(impl));
 }
 
 auto Substance::replaceName(const std::string& name) -> Substance
 {
-    Substance res;
-    res.pimpl = std::make_shared<Impl>(*pimpl);
-    res.pimpl->name = name;
-    return res;
-    // auto attributes = pimpl->attributes;
-    // attributes.name = name;
-    // return Substance(attributes, elements());
+    auto impl = allocateShared<Impl>(*pimpl);
+    impl->name = InternedString(name);
+    return Substance(std::move(impl));
 }
 
 auto Substance::replaceTags(std::vector<std::string> tags) -> Substance
 {
-    auto attributes = pimpl->attributes;
-    attributes.tags = std::move(tags);
-    return Substance(attributes, elements());
+    auto impl = allocateShared<Impl>(*pimpl);
+    impl->tags = intern(tags);
+    return Substance(std::move(impl));
 }
 
-auto Substance::name() const -> std::string
+auto Substance::name() const -> InternedString
 {
-    return pimpl->attributes.name;
+    return pimpl->name;
 }
 
-auto Substance::formula() const -> const Formula&
+auto Substance::formula() const -> const SubstanceFormula&
 {
-    return pimpl->attributes.formula;
+    return pimpl->formula;
 }
 
-auto Substance::tags() const -> const std::vector<std::string>&
-{
-    return pimpl->attributes.tags;
-}
-
-auto Substance::elements() const -> const Elements&
+auto Substance::elements() const -> const SubstanceElements&
 {
     return pimpl->elements;
 }
 
-auto Substance::symbols() const -> const std::vector<std::string>&
-{
-    return formula().symbols();
-}
-
-auto Substance::coefficients() const -> const std::vector<double>&
-{
-    return formula().coefficients();
-}
-
-auto Substance::coefficient(const std::string& symbol) const -> double
-{
-    return formula().coefficient(symbol);
-}
-
-auto Substance::charge() const -> double
+auto Substance::type() const -> InternedString
 {
-    return formula().charge();
+    return pimpl->type;
 }
 
-auto Substance::molarMass() const -> double
+auto Substance::tags() const -> const std::pmr::vector<InternedString>&
 {
-    return pimpl->molarMass;
+    return pimpl->tags;
 }
 
 auto Substance::hasTag(const std::string& tag) const -> bool
 {
-    return index(tags(), tag) < tags().size();
+    return contains(tags(), InternedString::find(tag));
 }
 
 auto operator<(const Substance& lhs, const Substance& rhs) -> bool
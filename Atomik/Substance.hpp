@@ -19,18 +19,21 @@
 
 // C++ includes
 #include <memory>
+#include <memory_resource>
 #include <string>
 #include <vector>
 #include <unordered_map>
 
 // Atomik includes
+#include <Atomik/Index.hpp>
+#include <Atomik/InternedString.hpp>
+#include <Atomik/SubstanceElements.hpp>
+#include <Atomik/SubstanceFormula.hpp>
 
 namespace Atomik {
 
 // Forward declarations
 class Elements;
-class SubstanceElements;
-class SubstanceFormula;
 
 /// A type used to represent a chemical substance and its attributes.
 class Substance
@@ -40,19 +43,19 @@ public:
     struct Args
     {
         /// The name of the substance such as `H2O(aq)`, `O2(g)`, `H+(aq)`.
-        const std::string& name;
+        std::string name;
 
         /// The chemical formula of the substance such as `H2O`, `O2`, `H+`.
-        const SubstanceFormula& formula;
+        SubstanceFormula formula;
 
         /// The elements of the substance.
-        const SubstanceElements& elements;
+        SubstanceElements elements;
 
         /// The type of the substance such as `aqueous`, `gaseous`, `liquid`, "mineral", etc..
-        const std::string& type;
+        std::string type;
 
         /// The tags of the substance such as `organic`, `mineral`.
-        const std::vector<std::string>& tags;
+        std::vector<std::string> tags;
     };
 
     /// Construct a default Substance object.
@@ -72,6 +75,10 @@ public:
     /// @param args The arguments to construct the substance.
     Substance(const Args& args);
 
+    /// Construct a Substance object by taking ownership of given data.
+    /// @param args The arguments to construct the substance.
+    Substance(Args&& args);
+
     /// Return a duplicate of this Substance object with replaced formula attribute.
     auto replaceFormula(const std::string& formula) -> Substance;
 
@@ -85,7 +92,7 @@ public:
     auto replaceTags(std::vector<std::string> tags) -> Substance;
 
     /// Return the name of the substance if provided, otherwise, its formula.
-    auto name() const -> const std::string&;
+    auto name() const -> InternedString;
 
     /// Return the chemical formula of the substance.
     auto formula() const -> const SubstanceFormula&;
@@ -93,22 +100,67 @@ public:
     /// Return the elements of the substance.
     auto elements() const -> const SubstanceElements&;
 
+    /// Return the type of the substance (e.g., `aqueous`, `gaseous`, `liquid`, `mineral`).
+    auto type() const -> InternedString;
+
     /// Return the tags of the substance (e.g., `organic`, `mineral`).
-    auto tags() const -> const std::vector<std::string>&;
+    auto tags() const -> const std::pmr::vector<InternedString>&;
 
     /// Return the electric charge of the substance.
-    auto charge() const -> double;
+    inline auto charge() const -> double { return hot.charge; }
 
     /// Return the molar mass of the substance (in unit of kg/mol).
-    auto molarMass() const -> double;
+    inline auto molarMass() const -> double { return hot.molarMass; }
+
+    /// Return the number of elements in the substance.
+    inline auto numElements() const -> std::size_t { return hot.numElements; }
+
+    /// Return the coefficient of the element with given index in `elements()`.
+    inline auto coefficient(Index ielement) const -> double
+    {
+        return hot.numElements <= Hot::numInlineCoefficients ? hot.inlineCoefficients[ielement] : hot.coefficients[ielement];
+    }
 
     /// Return true if the substance has a given tag.
     auto hasTag(const std::string& tag) const -> bool;
 
 private:
+    /// The numeric data of the substance used in performance critical loops.
+    /// This data is stored in the Substance object itself, so that it can be accessed without
+    /// going through the less frequently used data in Impl. The coefficients are stored inline
+    /// too, unless the substance has more than `numInlineCoefficients` elements.
+    struct Hot
+    {
+        /// The number of coefficients stored inline, which keeps a Substance object within 64 bytes.
+        static constexpr std::size_t numInlineCoefficients = 3;
+
+        /// The molar mass of the substance (in unit of kg/mol).
+        double molarMass = 0.0;
+
+        /// The electric charge of the substance.
+        double charge = 0.0;
+
+        /// The number of elements in the substance.
+        std::size_t numElements = 0;
+
+        union
+        {
+            /// The coefficients of the elements in the substance, if there are at most `numInlineCoefficients` of them.
+            double inlineCoefficients[numInlineCoefficients] = {};
+
+            /// The coefficients of the elements in the substance otherwise (owned by Impl).
+            const double* coefficients;
+        };
+    };
+
     struct Impl;
 
+    /// Construct a Substance object with given internal state.
+    explicit Substance(std::shared_ptr<Impl> pimpl);
+
     std::shared_ptr<Impl> pimpl;
+
+    Hot hot;
 };
 
 /// Compare two Substance objects for less than
@@ -21,44 +21,55 @@
 // Atomik includes
 #include <Atomik/Elements.hpp>
 #include <Atomik/Extract.hpp>
-#include <Atomik/Formula.hpp>
+#include <Atomik/SubstanceFormula.hpp>
 #include <Atomik/Substance.hpp>
 using namespace Atomik;
 
+namespace {
+
+/// Return a Substance object constructed from its arguments, with its elements resolved from the formula.
+auto substanceWith(const std::string& formula, const std::string& name, std::vector<std::string> tags) -> Substance
+{
+    return Substance({ name, SubstanceFormula(formula), Substance(formula).elements(), "aqueous", std::move(tags) });
+}
+
+} // namespace
+
 TEST_CASE("Testing Substance class", "[Substance]")
 {
     Substance substance;
 
     // Test Substance::Substance(formula) constructor
     substance = Substance("H2O");
-    REQUIRE(substance.formula().equivalent("H2O"));
+    REQUIRE(substance.formula().equivalent(SubstanceFormula("H2O")));
     REQUIRE(substance.name() == "H2O");
     REQUIRE(substance.tags().empty());
     REQUIRE(substance.molarMass() == Approx(0.01801528));
     REQUIRE(substance.charge() == 0);
-    REQUIRE(substance.symbols().size() == 2);
-    REQUIRE(substance.symbols() == Extract::symbols(substance.elements()));
-    REQUIRE(substance.coefficient("H") == 2);
-    REQUIRE(substance.coefficient("O") == 1);
-
-    // Test Substance::Substance(attributes) constructor
-    substance = Substance({"Na+", "Na+(aq)", {"aqueous", "cation", "charged"}});
-    REQUIRE(substance.formula().equivalent("Na+"));
+    REQUIRE(substance.elements().symbols().size() == 2);
+    REQUIRE(strings(substance.elements().symbols()) == Extract::symbols(substance.elements().elements()));
+    REQUIRE(substance.formula().coefficient("H") == 2);
+    REQUIRE(substance.formula().coefficient("O") == 1);
+
+    // Test Substance::Substance(args) constructor
+    substance = substanceWith("Na+", "Na+(aq)", {"aqueous", "cation", "charged"});
+    REQUIRE(substance.formula().equivalent(SubstanceFormula("Na+")));
     REQUIRE(substance.name() == "Na+(aq)");
+    REQUIRE(substance.type() == "aqueous");
     REQUIRE(substance.tags().size() == 3);
     REQUIRE(substance.hasTag("aqueous"));
     REQUIRE(substance.hasTag("cation"));
     REQUIRE(substance.hasTag("charged"));
     REQUIRE(substance.molarMass() == Approx(0.022989769));
     REQUIRE(substance.charge() == 1);
-    REQUIRE(substance.symbols().size() == 2);
-    REQUIRE(substance.symbols() == Extract::symbols(substance.elements()));
-    REQUIRE(substance.coefficient("Na") == 1);
-    REQUIRE(substance.coefficient("Z") == 1);
-
-    // Test Substance::Substance(attributes) constructor
-    substance = Substance({"Cl-", "Cl-(aq)", {"aqueous", "anion", "charged"}});
-    REQUIRE(substance.formula().equivalent("Cl-"));
+    REQUIRE(substance.elements().symbols().size() == 2);
+    REQUIRE(strings(substance.elements().symbols()) == Extract::symbols(substance.elements().elements()));
+    REQUIRE(substance.formula().coefficient("Na") == 1);
+    REQUIRE(substance.formula().coefficient("Z") == 1);
+
+    // Test Substance::Substance(args) constructor
+    substance = substanceWith("Cl-", "Cl-(aq)", {"aqueous", "anion", "charged"});
+    REQUIRE(substance.formula().equivalent(SubstanceFormula("Cl-")));
     REQUIRE(substance.name() == "Cl-(aq)");
     REQUIRE(substance.tags().size() == 3);
     REQUIRE(substance.hasTag("aqueous"));
@@ -66,14 +77,14 @@ TEST_CASE("Testing Substance class", "[Substance]")
     REQUIRE(substance.hasTag("charged"));
     REQUIRE(substance.molarMass() == Approx(0.035453));
     REQUIRE(substance.charge() == -1);
-    REQUIRE(substance.symbols().size() == 2);
-    REQUIRE(substance.symbols() == Extract::symbols(substance.elements()));
-    REQUIRE(substance.coefficient("Cl") == 1);
-    REQUIRE(substance.coefficient("Z") == -1);
-
-    // Test Substance::Substance(attributes) constructor
-    substance = Substance({"CO3--", "CO3--(aq)", {"aqueous", "anion", "charged"}});
-    REQUIRE(substance.formula().equivalent("CO3-2"));
+    REQUIRE(substance.elements().symbols().size() == 2);
+    REQUIRE(strings(substance.elements().symbols()) == Extract::symbols(substance.elements().elements()));
+    REQUIRE(substance.formula().coefficient("Cl") == 1);
+    REQUIRE(substance.formula().coefficient("Z") == -1);
+
+    // Test Substance::Substance(args) constructor
+    substance = substanceWith("CO3--", "CO3--(aq)", {"aqueous", "anion", "charged"});
+    REQUIRE(substance.formula().equivalent(SubstanceFormula("CO3-2")));
     REQUIRE(substance.name() == "CO3--(aq)");
     REQUIRE(substance.tags().size() == 3);
     REQUIRE(substance.hasTag("aqueous"));
@@ -81,55 +92,55 @@ TEST_CASE("Testing Substance class", "[Substance]")
     REQUIRE(substance.hasTag("charged"));
     REQUIRE(substance.molarMass() == Approx(0.0600092));
     REQUIRE(substance.charge() == -2);
-    REQUIRE(substance.symbols().size() == 3);
-    REQUIRE(substance.symbols() == Extract::symbols(substance.elements()));
-    REQUIRE(substance.coefficient("C") == 1);
-    REQUIRE(substance.coefficient("O") == 3);
-    REQUIRE(substance.coefficient("Z") == -2);
+    REQUIRE(substance.elements().symbols().size() == 3);
+    REQUIRE(strings(substance.elements().symbols()) == Extract::symbols(substance.elements().elements()));
+    REQUIRE(substance.formula().coefficient("C") == 1);
+    REQUIRE(substance.formula().coefficient("O") == 3);
+    REQUIRE(substance.formula().coefficient("Z") == -2);
 
     // Test Substance::replaceFormula method with Substance::Substance(formula) constructor
     substance = Substance("CaCO3").replaceFormula("Ca(CO3)");
-    REQUIRE(substance.formula().equivalent("Ca(CO3)"));
+    REQUIRE(substance.formula().equivalent(SubstanceFormula("Ca(CO3)")));
     REQUIRE(substance.name() == "CaCO3");
     REQUIRE(substance.tags().empty());
     REQUIRE(substance.molarMass() == Approx(0.1000869));
     REQUIRE(substance.charge() == 0);
-    REQUIRE(substance.symbols().size() == 3);
-    REQUIRE(substance.symbols() == Extract::symbols(substance.elements()));
-    REQUIRE(substance.coefficient("C") == 1);
-    REQUIRE(substance.coefficient("Ca") == 1);
-    REQUIRE(substance.coefficient("O") == 3);
+    REQUIRE(substance.elements().symbols().size() == 3);
+    REQUIRE(strings(substance.elements().symbols()) == Extract::symbols(substance.elements().elements()));
+    REQUIRE(substance.formula().coefficient("C") == 1);
+    REQUIRE(substance.formula().coefficient("Ca") == 1);
+    REQUIRE(substance.formula().coefficient("O") == 3);
 
     // Test Substance::replaceName method with Substance::Substance(formula) constructor
     substance = Substance("H+").replaceName("H+(aq)");
-    REQUIRE(substance.formula().equivalent("H+"));
+    REQUIRE(substance.formula().equivalent(SubstanceFormula("H+")));
     REQUIRE(substance.name() == "H+(aq)");
     REQUIRE(substance.tags().empty());
     REQUIRE(substance.molarMass() == Approx(0.00100794));
     REQUIRE(substance.charge() == 1);
-    REQUIRE(substance.symbols().size() == 2);
-    REQUIRE(substance.symbols() == Extract::symbols(substance.elements()));
-    REQUIRE(substance.coefficient("H") == 1);
-    REQUIRE(substance.coefficient("Z") == 1);
+    REQUIRE(substance.elements().symbols().size() == 2);
+    REQUIRE(strings(substance.elements().symbols()) == Extract::symbols(substance.elements().elements()));
+    REQUIRE(substance.formula().coefficient("H") == 1);
+    REQUIRE(substance.formula().coefficient("Z") == 1);
 
     // Test Substance::replaceTags method with Substance::Substance(formula) constructor
     substance = Substance("HCO3-").replaceTags({"aqueous"});
-    REQUIRE(substance.formula().equivalent("HCO3-"));
+    REQUIRE(substance.formula().equivalent(SubstanceFormula("HCO3-")));
     REQUIRE(substance.name() == "HCO3-");
     REQUIRE(substance.tags().size() == 1);
     REQUIRE(substance.hasTag("aqueous"));
     REQUIRE(substance.molarMass() == Approx(0.0610168));
     REQUIRE(substance.charge() == -1);
-    REQUIRE(substance.symbols().size() == 4);
-    REQUIRE(substance.symbols() == Extract::symbols(substance.elements()));
-    REQUIRE(substance.coefficient("C") == 1);
-    REQUIRE(substance.coefficient("H") == 1);
-    REQUIRE(substance.coefficient("O") == 3);
-    REQUIRE(substance.coefficient("Z") == -1);
+    REQUIRE(substance.elements().symbols().size() == 4);
+    REQUIRE(strings(substance.elements().symbols()) == Extract::symbols(substance.elements().elements()));
+    REQUIRE(substance.formula().coefficient("C") == 1);
+    REQUIRE(substance.formula().coefficient("H") == 1);
+    REQUIRE(substance.formula().coefficient("O") == 3);
+    REQUIRE(substance.formula().coefficient("Z") == -1);
 
     // Test Substance::replaceTags method with Substance::Substance(formula) constructor
     substance = Substance("Fe+++").replaceTags({"aqueous", "cation", "charged", "iron"});
-    REQUIRE(substance.formula().equivalent("Fe+3"));
+    REQUIRE(substance.formula().equivalent(SubstanceFormula("Fe+3")));
     REQUIRE(substance.name() == "Fe+++");
     REQUIRE(substance.tags().size() == 4);
     REQUIRE(substance.hasTag("aqueous"));
@@ -138,10 +149,10 @@ TEST_CASE("Testing Substance class", "[Substance]")
     REQUIRE(substance.hasTag("iron"));
     REQUIRE(substance.molarMass() == Approx(0.055847));
     REQUIRE(substance.charge() == 3);
-    REQUIRE(substance.symbols().size() == 2);
-    REQUIRE(substance.symbols() == Extract::symbols(substance.elements()));
-    REQUIRE(substance.coefficient("Fe") == 1);
-    REQUIRE(substance.coefficient("Z") == 3);
+    REQUIRE(substance.elements().symbols().size() == 2);
+    REQUIRE(strings(substance.elements().symbols()) == Extract::symbols(substance.elements().elements()));
+    REQUIRE(substance.formula().coefficient("Fe") == 1);
+    REQUIRE(substance.formula().coefficient("Z") == 3);
 
     // Test Substance::Substance(formula, elementsdb) constructor
     Elements elements = Elements::PeriodicTable();
@@ -149,17 +160,65 @@ TEST_CASE("Testing Substance class", "[Substance]")
     elements.append( Element({"Bb"}) );
 
     substance = Substance("AaBb2+", elements);
-    REQUIRE(substance.formula().equivalent("AaBb2+"));
+    REQUIRE(substance.formula().equivalent(SubstanceFormula("AaBb2+")));
     REQUIRE(substance.name() == "AaBb2+");
     REQUIRE(substance.tags().empty());
     REQUIRE(substance.molarMass() == Approx(0.0));
     REQUIRE(substance.charge() == 1);
-    REQUIRE(substance.symbols().size() == 3);
-    REQUIRE(substance.symbols() == Extract::symbols(substance.elements()));
-    REQUIRE(substance.coefficient("Aa") == 1);
-    REQUIRE(substance.coefficient("Bb") == 2);
-    REQUIRE(substance.coefficient("Z") == 1);
+    REQUIRE(substance.elements().symbols().size() == 3);
+    REQUIRE(strings(substance.elements().symbols()) == Extract::symbols(substance.elements().elements()));
+    REQUIRE(substance.formula().coefficient("Aa") == 1);
+    REQUIRE(substance.formula().coefficient("Bb") == 2);
+    REQUIRE(substance.formula().coefficient("Z") == 1);
 
     // Test Substance constructor fails with a formula containing unknown element symbols
     REQUIRE_THROWS( Substance("RrGgHh") );
 }
+
+TEST_CASE("Testing Substance numeric data", "[Substance]")
+{
+    Substance substance("CO3--");
+
+    REQUIRE(substance.charge() == -2);
+    REQUIRE(substance.molarMass() == Approx(0.0600092));
+    REQUIRE(substance.numElements() == substance.elements().coefficients().size());
+
+    for(auto i = 0u; i < substance.numElements(); ++i)
+        REQUIRE(substance.coefficient(i) == substance.elements().coefficients()[i]);
+
+    // Test the numeric data is preserved in duplicated substances
+    substance = substance.replaceName("CO3--(aq)").replaceTags({"aqueous"});
+
+    REQUIRE(substance.charge() == -2);
+    REQUIRE(substance.molarMass() == Approx(0.0600092));
+    REQUIRE(substance.numElements() == 3);
+
+    // Test the numeric data is updated in substances with replaced formula
+    substance = substance.replaceFormula("HCO3-");
+
+    REQUIRE(substance.charge() == -1);
+    REQUIRE(substance.molarMass() == Approx(0.0610168));
+    REQUIRE(substance.numElements() == 4);
+
+    // Test the coefficients of substances with more elements than stored inline
+    for(auto i = 0u; i < substance.numElements(); ++i)
+        REQUIRE(substance.coefficient(i) == substance.elements().coefficients()[i]);
+
+    // Test the numeric data of substances constructed from their arguments
+    substance = substanceWith("CaCO3", "Calcite", {"mineral"});
+
+    REQUIRE(substance.charge() == 0);
+    REQUIRE(substance.molarMass() == Approx(0.1000869));
+    REQUIRE(substance.numElements() == 3);
+
+    // Test the coefficients remain valid in copies that outlive the original substance
+    Substance copy = Substance("Fe+++");
+    {
+        const Substance original = Substance("H2O").replaceName("H2O(aq)");
+        copy = original;
+    }
+
+    REQUIRE(copy.numElements() == 2);
+    for(auto i = 0u; i < copy.numElements(); ++i)
+        REQUIRE(copy.coefficient(i) == copy.elements().coefficients()[i]);
+}
@@ -0,0 +1,614 @@
+// Atomik is a library that implements basic chemical concepts such as elements, substances, and reactions.
+//
+// Copyright (C) 2018-2019 Allan Leal and Reaktoro Contributors
+//
+// This library is free software; you can redistribute it and/or
+// modify it under the terms of the GNU Lesser General Public
+// License as published by the Free Software Foundation; either
+// version 2.1 of the License, or (at your option) any later version.
+//
+// This library is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+// Lesser General Public License for more details.
+//
+// You should have received a copy of the GNU Lesser General Public License
+// along with this library. If not, see <http://www.gnu.org/licenses/>.
+
+#include "SubstanceArchive.hpp"
+
+// C++ includes
+#include <algorithm>
+#include <cmath>
+#include <cstdio>
+#include <cstring>
+#include <fstream>
+#include <sstream>
+#include <unordered_map>
+#include <vector>
+
+// Atomik includes
+#include <Atomik/BinaryDatabase.hpp>
+#include <Atomik/Elements.hpp>
+#include <Atomik/Exception.hpp>
+#include <Atomik/Instrumentation.hpp>
+#include <Atomik/Substances.hpp>
+#include <Atomik/SubstanceTable.hpp>
+#include <Atomik/Tracing.hpp>
+
+namespace Atomik {
+namespace {
+
+/// The scale of the coefficients stored as integers.
+constexpr double coefficientScale = 1000.0;
+
+/// The number of bytes framing a block (its size and checksum).
+constexpr std::size_t blockFrameSize = sizeof(std::uint32_t) + sizeof(std::uint64_t);
+
+/// The minimum number of bytes encoding a substance in a block (its front-coded name and formula, type, and numbers of tags and elements).
+constexpr std::size_t minSubstanceSize = 7;
+
+/// A type used to encode values into the bytes of an archive.
+class ByteWriter
+{
+public:
+    /// Append an unsigned integer in variable-length (LEB128) encoding.
+    auto varint(std::uint64_t value) -> void
+    {
+        while(value >= 0x80)
+        {
+            m_bytes.push_back(char(value | 0x80));
+            value >>= 7;
+        }
+        m_bytes.push_back(char(value));
+    }
+
+    /// Append an unsigned integer in little-endian fixed-width encoding.
+    template<typename T>
+    auto fixed(T value) -> void
+    {
+        for(auto i = 0u; i < sizeof(T); ++i)
+            m_bytes.push_back(char((std::uint64_t(value) >> (8 * i)) & 0xff));
+    }
+
+    /// Append characters.
+    auto bytes(std::string_view str) -> void
+    {
+        m_bytes.append(str);
+    }
+
+    /// Append a string preceded by its size.
+    auto string(std::string_view str) -> void
+    {
+        varint(str.size());
+        bytes(str);
+    }
+
+    /// Append a string front-coded against the previous one (the size of their common prefix, and the remaining characters).
+    auto frontCoded(std::string_view previous, std::string_view str) -> void
+    {
+        const auto limit = std::min(previous.size(), str.size());
+        const auto prefix = std::mismatch(str.begin(), str.begin() + limit, previous.begin()).first - str.begin();
+        varint(prefix);
+        string(str.substr(prefix));
+    }
+
+    /// Append a number, as a scaled integer if this is exact, or as raw double otherwise.
+    auto number(double value) -> void
+    {
+        const auto scaled = value * coefficientScale;
+        if(std::abs(scaled) < 1e15)
+        {
+            const auto n = std::llround(scaled);
+            const auto decoded = double(n) / coefficientScale;
+            if(decoded == value && std::signbit(decoded) == std::signbit(value))
+            {
+                varint(((std::uint64_t(n) << 1) ^ std::uint64_t(n >> 63)) << 1); // zigzag encoding with a zero flag bit
+                return;
+            }
+        }
+        std::uint64_t bits;
+        std::memcpy(&bits, &value, sizeof(bits));
+        varint(1);
+        fixed(bits);
+    }
+
+    /// Return the bytes written so far.
+    auto str() -> std::string& { return m_bytes; }
+
+private:
+    /// The encoded bytes.
+    std::string m_bytes;
+};
+
+/// A type used to decode values from the bytes of an archive.
+class ByteReader
+{
+public:
+    /// Construct a ByteReader object over given bytes.
+    explicit ByteReader(std::string_view bytes) : m_pos(bytes.data()), m_end(bytes.data() + bytes.size()) {}
+
+    /// Read an unsigned integer in variable-length (LEB128) encoding.
+    auto varint() -> std::uint64_t
+    {
+        std::uint64_t value = 0;
+        for(unsigned shift = 0; ; shift += 7)
+        {
+            error(m_pos == m_end || shift > 63, "The substance archive is truncated or corrupted.");
+            const auto byte = std::uint8_t(*m_pos++);
+            value |= std::uint64_t(byte & 0x7f) << shift;
+            if(byte < 0x80)
+                return value;
+        }
+    }
+
+    /// Read an unsigned integer in little-endian fixed-width encoding.
+    template<typename T>
+    auto fixed() -> T
+    {
+        const auto data = bytes(sizeof(T));
+        std::uint64_t value = 0;
+        for(auto i = 0u; i < sizeof(T); ++i)
+            value |= std::uint64_t(std::uint8_t(data[i])) << (8 * i);
+        return T(value);
+    }
+
+    /// Read a given number of characters.
+    auto bytes(std::size_t count) -> std::string_view
+    {
+        error(std::size_t(m_end - m_pos) < count, "The substance archive is truncated or corrupted.");
+        const std::string_view res(m_pos, count);
+        m_pos += count;
+        return res;
+    }
+
+    /// Read a string preceded by its size.
+    auto string() -> std::string_view
+    {
+        return bytes(varint());
+    }
+
+    /// Read a front-coded string, replacing the previous one with it.
+    auto frontCoded(std::string& str) -> void
+    {
+        const auto prefix = varint();
+        error(prefix > str.size(), "The substance archive is truncated or corrupted.");
+        str.resize(prefix);
+        str += string();
+    }
+
+    /// Read a number.
+    auto number() -> double
+    {
+        const auto code = varint();
+        if(code & 1)
+        {
+            const auto bits = fixed<std::uint64_t>();
+            double value;
+            std::memcpy(&value, &bits, sizeof(value));
+            return value;
+        }
+        const auto zigzag = code >> 1;
+        const auto n = std::int64_t(zigzag >> 1) ^ -std::int64_t(zigzag & 1);
+        return double(n) / coefficientScale;
+    }
+
+    /// Read an index into a dictionary of given size.
+    auto index(std::size_t size) -> std::size_t
+    {
+        const auto i = varint();
+        error(i >= size, "The substance archive refers to a missing dictionary entry.");
+        return i;
+    }
+
+    /// Return true if all bytes have been read.
+    auto done() const -> bool { return m_pos == m_end; }
+
+    /// Return the number of bytes left to read.
+    auto remaining() const -> std::size_t { return m_end - m_pos; }
+
+private:
+    /// The next byte to read.
+    const char* m_pos;
+
+    /// The end of the bytes.
+    const char* m_end;
+};
+
+/// A type used to assign indices to distinct strings in order of first appearance.
+class Dictionary
+{
+public:
+    /// Return the index of a string, adding it if needed.
+    auto index(std::string_view str) -> std::size_t
+    {
+        const auto [it, inserted] = m_indices.emplace(std::string(str), m_strings.size());
+        if(inserted)
+            m_strings.emplace_back(str);
+        return it->second;
+    }
+
+    /// Return the strings in the dictionary.
+    auto strings() const -> const std::vector<std::string>& { return m_strings; }
+
+private:
+    /// The strings in order of first appearance.
+    std::vector<std::string> m_strings;
+
+    /// The index of each string.
+    std::unordered_map<std::string, std::size_t> m_indices;
+};
+
+/// Append a framed block (its size, its checksum, and its payload) to an archive.
+auto appendBlock(std::string& archive, const std::string& payload) -> void
+{
+    error(payload.size() > UINT32_MAX, "Could not encode a block of the substance archive larger than 4 GiB.");
+    ByteWriter frame;
+    frame.fixed(std::uint32_t(payload.size()));
+    frame.fixed(BinaryFormat::hash(payload));
+    archive += frame.str();
+    archive += payload;
+}
+
+/// Read a framed block from an archive, checking its checksum, and return its payload.
+auto readBlock(ByteReader& reader) -> std::string_view
+{
+    const auto size = reader.fixed<std::uint32_t>();
+    const auto checksum = reader.fixed<std::uint64_t>();
+    const auto payload = reader.bytes(size);
+    error(BinaryFormat::hash(payload) != checksum, "The substance archive is corrupted (a block checksum does not match).");
+    return payload;
+}
+
+/// The substances of a block decoded into columns.
+struct BlockColumns
+{
+    /// The number of substances in the block.
+    std::size_t size = 0;
+
+    /// The names of the substances.
+    std::vector<std::string> names;
+
+    /// The formulas of the substances.
+    std::vector<std::string> formulas;
+
+    /// The dictionary indices of the types of the substances.
+    std::vector<std::size_t> types;
+
+    /// The offsets of each substance in `tags` (with size equal to `size + 1`).
+    std::vector<std::size_t> tagOffsets;
+
+    /// The dictionary indices of the tags of the substances.
+    std::vector<std::size_t> tags;
+
+    /// The offsets of each substance in `symbols` and `coefficients` (with size equal to `size + 1`).
+    std::vector<std::size_t> compositionOffsets;
+
+    /// The dictionary indices of the element symbols in the formulas of the substances.
+    std::vector<std::size_t> symbols;
+
+    /// The coefficients of the element symbols in the formulas of the substances.
+    std::vector<double> coefficients;
+};
+
+/// The header and dictionaries of a decoded archive.
+struct ArchiveDictionaries
+{
+    /// The number of blocks of substances.
+    std::size_t numBlocks = 0;
+
+    /// The number of substances.
+    std::size_t numSubstances = 0;
+
+    /// The elements with the distinct symbols in the formulas of the substances.
+    std::vector<Element> elements;
+
+    /// The distinct types of the substances.
+    std::vector<std::string> types;
+
+    /// The distinct tags of the substances.
+    std::vector<std::string> tags;
+};
+
+/// Read the header and the dictionary block of an archive.
+auto readDictionaries(ByteReader& reader) -> ArchiveDictionaries
+{
+    ArchiveDictionaries res;
+    error(reader.bytes(sizeof(ArchiveFormat::magic)) != std::string_view(ArchiveFormat::magic, sizeof(ArchiveFormat::magic)),
+        "The data is not a substance archive.");
+    const auto version = reader.fixed<std::uint32_t>();
+    error(version != ArchiveFormat::version, "The substance archive has version ", version, ", but version ", ArchiveFormat::version, " is expected.");
+    res.numBlocks = reader.fixed<std::uint32_t>();
+    res.numSubstances = reader.fixed<std::uint64_t>();
+
+    // The header is not covered by a checksum, so its counts are bounded by the bytes left to encode them before being trusted
+    error(res.numBlocks > reader.remaining() / blockFrameSize || res.numSubstances > reader.remaining() / minSubstanceSize,
+        "The substance archive is truncated or corrupted.");
+
+    ByteReader dictionaries(readBlock(reader));
+    const auto periodicTable = Elements::PeriodicTable();
+    res.elements.resize(dictionaries.varint());
+    for(auto& element : res.elements)
+        element = periodicTable.getWithSymbol(std::string(dictionaries.string()));
+    res.types.resize(dictionaries.varint());
+    for(auto& type : res.types)
+        type = dictionaries.string();
+    res.tags.resize(dictionaries.varint());
+    for(auto& tag : res.tags)
+        tag = dictionaries.string();
+    error(!dictionaries.done(), "The substance archive is truncated or corrupted.");
+    return res;
+}
+
+/// Decode the columns of a block of substances.
+auto readColumns(std::string_view payload, const ArchiveDictionaries& dictionaries, BlockColumns& columns) -> void
+{
+    ByteReader reader(payload);
+    const auto size = columns.size = reader.varint();
+    error(size > ArchiveFormat::recordsPerBlock, "The substance archive is truncated or corrupted.");
+
+    columns.names.resize(size);
+    std::string previous;
+    for(auto& name : columns.names)
+        reader.frontCoded(previous), name = previous;
+
+    columns.formulas.resize(size);
+    previous.clear();
+    for(auto& formula : columns.formulas)
+        reader.frontCoded(previous), formula = previous;
+
+    columns.types.resize(size);
+    for(auto& type : columns.types)
+        type = reader.index(dictionaries.types.size());
+
+    const auto readIndices = [&](std::vector<std::size_t>& offsets, std::vector<std::size_t>& indices, std::size_t dictionarySize)
+    {
+        // Each index takes at least one byte, so the counts are bounded by the bytes left before being added, which
+        // keeps their sum from wrapping around and the offsets monotonic
+        offsets.assign(1, 0);
+        for(auto i = 0u; i < size; ++i)
+        {
+            const auto count = reader.varint();
+            error(count > reader.remaining() || offsets.back() > reader.remaining() - count, "The substance archive is truncated or corrupted.");
+            offsets.push_back(offsets.back() + count);
+        }
+        indices.resize(offsets.back());
+        for(auto& index : indices)
+            index = reader.index(dictionarySize);
+    };
+
+    readIndices(columns.tagOffsets, columns.tags, dictionaries.tags.size());
+    readIndices(columns.compositionOffsets, columns.symbols, dictionaries.elements.size());
+
+    columns.coefficients.resize(columns.symbols.size());
+    for(auto& coefficient : columns.coefficients)
+        coefficient = reader.number();
+
+    error(!reader.done(), "The substance archive is truncated or corrupted.");
+}
+
+/// Decode the blocks of an archive, passing the columns of each one to a function.
+template<typename Function>
+auto readBlocks(ByteReader& reader, const ArchiveDictionaries& dictionaries, const Function& function) -> void
+{
+    BlockColumns columns;
+    std::size_t count = 0;
+    for(auto i = 0u; i < dictionaries.numBlocks; ++i)
+    {
+        readColumns(readBlock(reader), dictionaries, columns);
+        function(columns);
+        count += columns.size;
+    }
+    error(count != dictionaries.numSubstances || !reader.done(), "The substance archive is truncated or corrupted.");
+}
+
+/// Return the content of a file.
+auto readFile(const std::string& path) -> std::string
+{
+    std::ifstream file(path, std::ios::binary);
+    error(!file, "Could not open the substance archive file `", path, "`.");
+    std::stringstream ss;
+    ss << file.rdbuf();
+    return ss.str();
+}
+
+} // namespace
+
+auto encodeSubstanceArchive(const Substances& substances) -> std::string
+{
+    ATOMIK_TIME(Timer::EncodeSubstanceArchive);
+    ATOMIK_TRACE("encodeSubstanceArchive");
+    const auto periodicTable = Elements::PeriodicTable();
+    Dictionary symbols, types, tags;
+    std::vector<std::string> blocks;
+
+    for(std::size_t begin = 0; begin < substances.size(); begin += ArchiveFormat::recordsPerBlock)
+    {
+        const auto end = std::min(begin + ArchiveFormat::recordsPerBlock, substances.size());
+        ByteWriter writer;
+        writer.varint(end - begin);
+
+        std::string_view previous;
+        for(auto i = begin; i < end; ++i)
+            writer.frontCoded(previous, substances[i].name().view()), previous = substances[i].name().view();
+        previous = {};
+        for(auto i = begin; i < end; ++i)
+            writer.frontCoded(previous, substances[i].formula().formula()), previous = substances[i].formula().formula();
+
+        for(auto i = begin; i < end; ++i)
+            writer.varint(types.index(substances[i].type().view()));
+
+        for(auto i = begin; i < end; ++i)
+            writer.varint(substances[i].tags().size());
+        for(auto i = begin; i < end; ++i)
+            for(const auto& tag : substances[i].tags())
+                writer.varint(tags.index(tag.view()));
+
+        for(auto i = begin; i < end; ++i)
+            writer.varint(substances[i].formula().symbols().size());
+        for(auto i = begin; i < end; ++i)
+            for(const auto& symbol : substances[i].formula().symbols())
+            {
+                error(std::size_t(periodicTable.indexWithSymbol(symbol)) >= periodicTable.size(),
+                    "Could not archive the substance `", substances[i].name().str(), "` with element `", symbol, "`, which is not in the periodic table.");
+                writer.varint(symbols.index(symbol.view()));
+            }
+
+        for(auto i = begin; i < end; ++i)
+            for(const auto coefficient : substances[i].formula().coefficients())
+                writer.number(coefficient);
+
+        blocks.push_back(std::move(writer.str()));
+    }
+
+    ByteWriter dictionaries;
+    for(const auto* dictionary : { &symbols, &types, &tags })
+    {
+        dictionaries.varint(dictionary->strings().size());
+        for(const auto& str : dictionary->strings())
+            dictionaries.string(str);
+    }
+
+    ByteWriter header;
+    header.bytes(std::string_view(ArchiveFormat::magic, sizeof(ArchiveFormat::magic)));
+    header.fixed(ArchiveFormat::version);
+    header.fixed(std::uint32_t(blocks.size()));
+    header.fixed(std::uint64_t(substances.size()));
+
+    auto archive = std::move(header.str());
+    appendBlock(archive, dictionaries.str());
+    for(const auto& block : blocks)
+        appendBlock(archive, block);
+    return archive;
+}
+
+auto decodeSubstanceArchive(std::string_view archive) -> Substances
+{
+    ATOMIK_TIME(Timer::DecodeSubstanceArchive);
+    ATOMIK_TRACE("decodeSubstanceArchive");
+    ByteReader reader(archive);
+    const auto dictionaries = readDictionaries(reader);
+
+    std::unordered_map<std::string_view, const Element*> elementWithSymbol;
+    for(const auto& element : dictionaries.elements)
+        elementWithSymbol.emplace(element.symbol().view(), &element);
+
+    std::vector<Substance> substances;
+    substances.reserve(dictionaries.numSubstances);
+    readBlocks(reader, dictionaries, [&](const BlockColumns& columns)
+    {
+        for(auto i = 0u; i < columns.size; ++i)
+        {
+            // The formula and elements are constructed as when deserializing substances from YAML or JSON
+            SubstanceFormula::Args formula;
+            formula.formula = columns.formulas[i];
+            for(auto k = columns.compositionOffsets[i]; k < columns.compositionOffsets[i + 1]; ++k)
+                formula.elements.emplace(dictionaries.elements[columns.symbols[k]].symbol().str(), columns.coefficients[k]);
+
+            Substance::Args args;
+            args.name = columns.names[i];
+            args.formula = SubstanceFormula(std::move(formula));
+            args.type = dictionaries.types[columns.types[i]];
+            for(auto k = columns.tagOffsets[i]; k < columns.tagOffsets[i + 1]; ++k)
+                args.tags.push_back(dictionaries.tags[columns.tags[k]]);
+
+            SubstanceElements::Args elements;
+            for(const auto& symbol : args.formula.symbols())
+                elements.elements.append(*elementWithSymbol.at(symbol.view()));
+            elements.coefficients = args.formula.coefficients();
+            args.elements = SubstanceElements(std::move(elements));
+
+            substances.emplace_back(std::move(args));
+        }
+    });
+    return Substances(std::move(substances));
+}
+
+auto decodeSubstanceArchiveTable(std::string_view archive) -> SubstanceTable
+{
+    ATOMIK_TIME(Timer::DecodeSubstanceArchive);
+    ATOMIK_TRACE("decodeSubstanceArchiveTable");
+    ByteReader reader(archive);
+    const auto dictionaries = readDictionaries(reader);
+    const auto n = dictionaries.numSubstances;
+
+    SubstanceTable table;
+    table.m_nameOffsets.reserve(n + 1);
+    table.m_formulaOffsets.reserve(n + 1);
+    table.m_compositionOffsets.reserve(n + 1);
+    table.m_charges.reserve(n);
+    table.m_molarMasses.reserve(n);
+    table.m_typeIndices.reserve(n);
+
+    // The dictionaries are in order of first appearance, as the ones of a table filled with `append`
+    table.m_elements = Elements(dictionaries.elements);
+    for(const auto& type : dictionaries.types)
+        table.m_types.emplace_back(type);
+    for(const auto& tag : dictionaries.tags)
+        table.m_tags.emplace_back(tag);
+    table.m_tagWords = (table.m_tags.size() + 63) / 64;
+    table.m_tagBits.reserve(n * table.m_tagWords);
+
+    const auto charge = std::find_if(dictionaries.elements.begin(), dictionaries.elements.end(),
+        [](const Element& element) { return element.symbol() == "Z"; }) - dictionaries.elements.begin();
+
+    readBlocks(reader, dictionaries, [&](const BlockColumns& columns)
+    {
+        for(auto i = 0u; i < columns.size; ++i)
+        {
+            table.m_names += columns.names[i];
+            table.m_nameOffsets.push_back(table.m_names.size());
+            table.m_formulas += columns.formulas[i];
+            table.m_formulaOffsets.push_back(table.m_formulas.size());
+
+            auto molarMass = 0.0;
+            auto z = 0.0;
+            for(auto k = columns.compositionOffsets[i]; k < columns.compositionOffsets[i + 1]; ++k)
+            {
+                const auto ielement = columns.symbols[k];
+                const auto coefficient = columns.coefficients[k];
+                molarMass += coefficient * dictionaries.elements[ielement].molarMass();
+                if(Index(ielement) == charge) z = coefficient;
+                table.m_compositionElements.push_back(ielement);
+                table.m_compositionCoefficients.push_back(coefficient);
+            }
+            table.m_compositionOffsets.push_back(table.m_compositionElements.size());
+            table.m_charges.push_back(z);
+            table.m_molarMasses.push_back(molarMass);
+
+            table.m_typeIndices.push_back(columns.types[i]);
+
+            table.m_tagBits.resize(table.m_tagBits.size() + table.m_tagWords, 0);
+            const auto row = table.m_tagBits.end() - table.m_tagWords;
+            for(auto k = columns.tagOffsets[i]; k < columns.tagOffsets[i + 1]; ++k)
+                row[columns.tags[k] / 64] |= std::uint64_t(1) << (columns.tags[k] % 64);
+
+            ++table.m_size;
+        }
+    });
+    return table;
+}
+
+auto writeSubstanceArchive(const Substances& substances, const std::string& path) -> void
+{
+    const auto archive = encodeSubstanceArchive(substances);
+    const auto temporary = path + ".tmp";
+    {
+        std::ofstream file(temporary, std::ios::binary);
+        file.write(archive.data(), archive.size());
+        error(!file, "Could not write the substance archive file `", path, "`.");
+    }
+    error(std::rename(temporary.c_str(), path.c_str()) != 0, "Could not write the substance archive file `", path, "`.");
+}
+
+auto readSubstanceArchive(const std::string& path) -> Substances
+{
+    return decodeSubstanceArchive(readFile(path));
+}
+
+auto readSubstanceArchiveTable(const std::string& path) -> SubstanceTable
+{
+    return decodeSubstanceArchiveTable(readFile(path));
+}
+
+} // namespace Atomik
@@ -0,0 +1,77 @@
+// Atomik is a library that implements basic chemical concepts such as elements, substances, and reactions.
+//
+// Copyright (C) 2018-2019 Allan Leal and Reaktoro Contributors
+//
+// This library is free software; you can redistribute it and/or
+// modify it under the terms of the GNU Lesser General Public
+// License as published by the Free Software Foundation; either
+// version 2.1 of the License, or (at your option) any later version.
+//
+// This library is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+// Lesser General Public License for more details.
+//
+// You should have received a copy of the GNU Lesser General Public License
+// along with this library. If not, see <http://www.gnu.org/licenses/>.
+
+#pragma once
+
+// C++ includes
+#include <cstdint>
+#include <string>
+#include <string_view>
+
+namespace Atomik {
+
+// Forward declarations
+class Substances;
+class SubstanceTable;
+
+/// The constants of the compressed archive format of substances.
+/// An archive starts with a header (magic, version, number of blocks, and number of substances), followed
+/// by a dictionary block (the distinct element symbols, types, and tags) and by blocks of at most
+/// `recordsPerBlock` substances. Each block is framed by its size and a checksum of its contents, and
+/// stores its substances in columns: front-coded names and formulas, dictionary indices of types, tags,
+/// and element symbols, and coefficients packed as variable-length integers in units of 1/1000 (or as
+/// raw doubles when not representable so). All integers are little-endian.
+namespace ArchiveFormat {
+
+/// The bytes at the start of every archive.
+constexpr char magic[8] = { 'A', 'T', 'O', 'M', 'I', 'K', 'S', 'A' };
+
+/// The version of the archive format.
+constexpr std::uint32_t version = 1;
+
+/// The maximum number of substances in a block.
+constexpr std::size_t recordsPerBlock = 4096;
+
+} // namespace ArchiveFormat
+
+/// Return the compressed archive of given substances.
+/// The elements of the substances are stored by symbol and resolved with the periodic table when decoded,
+/// as done when deserializing substances from YAML or JSON.
+/// @throw std::runtime_error When an element of a substance is not in the periodic table.
+auto encodeSubstanceArchive(const Substances& substances) -> std::string;
+
+/// Return the substances in a compressed archive.
+/// @throw std::runtime_error When the archive is invalid, truncated, or corrupted (its checksums do not match).
+auto decodeSubstanceArchive(std::string_view archive) -> Substances;
+
+/// Return the substances in a compressed archive as a columnar table, without constructing Substance objects.
+/// @throw std::runtime_error When the archive is invalid, truncated, or corrupted (its checksums do not match).
+auto decodeSubstanceArchiveTable(std::string_view archive) -> SubstanceTable;
+
+/// Write the compressed archive of given substances to a file.
+/// @throw std::runtime_error When the file cannot be written.
+auto writeSubstanceArchive(const Substances& substances, const std::string& path) -> void;
+
+/// Return the substances in a compressed archive file.
+/// @throw std::runtime_error When the file cannot be read or is not a valid archive.
+auto readSubstanceArchive(const std::string& path) -> Substances;
+
+/// Return the substances in a compressed archive file as a columnar table.
+/// @throw std::runtime_error When the file cannot be read or is not a valid archive.
+auto readSubstanceArchiveTable(const std::string& path) -> SubstanceTable;
+
+} // namespace Atomik
@@ -0,0 +1,168 @@
+// Atomik is a library that implements basic chemical concepts such as elements, substances, and reactions.
+//
+// Copyright (C) 2018-2019 Allan Leal and Reaktoro Contributors
+//
+// This library is free software; you can redistribute it and/or
+// modify it under the terms of the GNU Lesser General Public
+// License as published by the Free Software Foundation; either
+// version 2.1 of the License, or (at your option) any later version.
+//
+// This library is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+// Lesser General Public License for more details.
+//
+// You should have received a copy of the GNU Lesser General Public License
+// along with this library. If not, see <http://www.gnu.org/licenses/>.
+// Catch includes
+#include <catch2/catch.hpp>
+
+// C++ includes
+#include <algorithm>
+#include <cstdio>
+#include <sstream>
+
+// Atomik includes
+#include <Atomik/BinaryDatabase.hpp>
+#include <Atomik/StreamingWriter.hpp>
+#include <Atomik/SubstanceArchive.hpp>
+#include <Atomik/Substances.hpp>
+#include <Atomik/SubstanceTable.hpp>
+using namespace Atomik;
+
+TEST_CASE("Testing SubstanceArchive", "[SubstanceArchive]")
+{
+    const std::vector<Substance> prototypes = {
+        Substance("H2O").replaceName("H2O(aq)").replaceTags({"aqueous", "neutral"}),
+        Substance("HCO3-").replaceName("HCO3-(aq)").replaceTags({"aqueous", "charged"}),
+        Substance("CaCO3").replaceName("Calcite").replaceTags({}),
+        Substance("Fe3Al2Si3O12").replaceName("Almandine").replaceTags({"mineral"}),
+        Substance("Na0.333Al2.333Si3.667O10(OH)2").replaceName("Montmorillonite-Na").replaceTags({"mineral", "clay"}),
+    };
+
+    SECTION("Testing a small archive")
+    {
+        const Substances substances(prototypes);
+        const auto archive = encodeSubstanceArchive(substances);
+
+        const auto decoded = decodeSubstanceArchive(archive);
+        REQUIRE(decoded.size() == substances.size());
+        for(auto i = 0u; i < decoded.size(); ++i)
+        {
+            REQUIRE(decoded[i] == substances[i]);
+            REQUIRE(decoded[i].type() == substances[i].type());
+            REQUIRE(decoded[i].charge() == substances[i].charge());
+            REQUIRE(decoded[i].molarMass() == Approx(substances[i].molarMass()));
+        }
+
+        const SubstanceTable expected(substances);
+        const auto table = decodeSubstanceArchiveTable(archive);
+        REQUIRE(table.size() == expected.size());
+        REQUIRE(table.charges() == expected.charges());
+        REQUIRE(table.typeIndices() == expected.typeIndices());
+        REQUIRE(table.types() == expected.types());
+        REQUIRE(table.tagNames() == expected.tagNames());
+        REQUIRE(table.elements().size() == expected.elements().size());
+        for(auto i = 0u; i < table.size(); ++i)
+        {
+            REQUIRE(table.name(i) == expected.name(i));
+            REQUIRE(table.formula(i) == expected.formula(i));
+            REQUIRE(table.tags(i) == expected.tags(i));
+            REQUIRE(table.molarMasses()[i] == Approx(expected.molarMasses()[i]));
+            REQUIRE(table.substance(i) == substances[i]);
+        }
+        REQUIRE(table.indicesWithTag("mineral") == std::vector<Index>{3, 4});
+
+        REQUIRE(decodeSubstanceArchive(encodeSubstanceArchive(Substances())).size() == 0);
+    }
+
+    SECTION("Testing an archive with several blocks")
+    {
+        std::vector<Substance> many;
+        for(auto i = 0u; i < 3 * ArchiveFormat::recordsPerBlock + 7; ++i)
+            many.push_back(Substance(prototypes[i % prototypes.size()]).replaceName("Substance" + std::to_string(i)));
+        const Substances substances(many);
+
+        const auto archive = encodeSubstanceArchive(substances);
+        std::stringstream yaml;
+        writeYAML(yaml, substances);
+        REQUIRE(archive.size() * 4 < yaml.str().size());
+
+        const auto decoded = decodeSubstanceArchive(archive);
+        REQUIRE(decoded.size() == substances.size());
+        for(auto i = 0u; i < decoded.size(); ++i)
+            REQUIRE(decoded[i] == substances[i]);
+
+        const auto table = decodeSubstanceArchiveTable(archive);
+        REQUIRE(table.size() == substances.size());
+        REQUIRE(table.name(table.size() - 1) == substances[substances.size() - 1].name());
+    }
+
+    SECTION("Testing invalid archives")
+    {
+        const auto archive = encodeSubstanceArchive(Substances(prototypes));
+
+        auto corrupted = archive;
+        corrupted[corrupted.size() - 3] ^= 0x10;
+        REQUIRE_THROWS(decodeSubstanceArchive(corrupted));
+        REQUIRE_THROWS(decodeSubstanceArchiveTable(corrupted));
+
+        REQUIRE_THROWS(decodeSubstanceArchive(archive.substr(0, archive.size() - 1)));
+        REQUIRE_THROWS(decodeSubstanceArchive(archive + "x"));
+        REQUIRE_THROWS(decodeSubstanceArchive("not an archive"));
+
+        // The header counts are not checksummed and must not be trusted to size allocations
+        auto inflated = archive;
+        const auto numSubstancesOffset = sizeof(ArchiveFormat::magic) + 2 * sizeof(std::uint32_t);
+        std::fill_n(inflated.begin() + numSubstancesOffset, sizeof(std::uint64_t), '\xff');
+        REQUIRE_THROWS_AS(decodeSubstanceArchive(inflated), std::runtime_error);
+        REQUIRE_THROWS_AS(decodeSubstanceArchiveTable(inflated), std::runtime_error);
+
+        // The counts in a block are checksummed, but must not be trusted either; here the tag counts of two
+        // substances are replaced by 2^64 - 1 and 2, whose sum wraps around to 1, with the block checksum updated
+        const auto pair = encodeSubstanceArchive(Substances({
+            Substance("H2O").replaceName("A").replaceTags({"t"}),
+            Substance("H2O").replaceName("B").replaceTags({"t"}),
+        }));
+        const auto fixed = [](const std::string& bytes, std::size_t pos, std::size_t size)
+        {
+            std::uint64_t value = 0;
+            for(auto i = 0u; i < size; ++i)
+                value |= std::uint64_t(std::uint8_t(bytes[pos + i])) << (8 * i);
+            return value;
+        };
+        const auto header = sizeof(ArchiveFormat::magic) + 2 * sizeof(std::uint32_t) + sizeof(std::uint64_t);
+        const auto frame = sizeof(std::uint32_t) + sizeof(std::uint64_t);
+        const auto block = header + frame + fixed(pair, header, sizeof(std::uint32_t));
+        const auto payload = pair.substr(block + frame);
+
+        // The payload starts with the count, the front-coded names and formulas, and the types of the two substances
+        const auto tagCounts = std::string("\x02\x00\x01" "A" "\x00\x01" "B" "\x00\x03" "H2O" "\x03\x00" "\x00\x00", 16);
+        REQUIRE(payload.substr(0, 16) == tagCounts);
+        REQUIRE(payload.substr(16, 2) == std::string("\x01\x01", 2));
+
+        // The wrapped sum of one tag is consistent with the rest of the block once the second tag index is removed
+        REQUIRE(payload.substr(18, 2) == std::string("\x00\x00", 2));
+        auto forged = payload.substr(0, 16) + std::string(9, '\xff') + "\x01" + "\x02" + payload.substr(18, 1) + payload.substr(20);
+        std::string framing;
+        for(auto i = 0u; i < sizeof(std::uint32_t); ++i)
+            framing += char((forged.size() >> (8 * i)) & 0xff);
+        for(auto i = 0u; i < sizeof(std::uint64_t); ++i)
+            framing += char((BinaryFormat::hash(forged) >> (8 * i)) & 0xff);
+        const auto wrapped = pair.substr(0, block) + framing + forged;
+        REQUIRE_THROWS_AS(decodeSubstanceArchive(wrapped), std::runtime_error);
+        REQUIRE_THROWS_AS(decodeSubstanceArchiveTable(wrapped), std::runtime_error);
+    }
+
+    SECTION("Testing archive files")
+    {
+        const auto path = "SubstanceArchive.test.atomika";
+        writeSubstanceArchive(Substances(prototypes), path);
+        const auto decoded = readSubstanceArchive(path);
+        REQUIRE(decoded.size() == prototypes.size());
+        REQUIRE(decoded[4] == prototypes[4]);
+        REQUIRE(readSubstanceArchiveTable(path).size() == prototypes.size());
+        std::remove(path);
+        REQUIRE_THROWS(readSubstanceArchive(path));
+    }
+}
@@ -17,6 +17,9 @@
 
 #include "SubstanceElements.hpp"
 
+// Atomik includes
+#include <Atomik/Memory.hpp>
+
 namespace Atomik {
 
 struct SubstanceElements::Impl
@@ -24,29 +27,32 @@ struct SubstanceElements::Impl
     /// The elements that compose the substance.
     Elements elements;
 
-    /// The oxidation states of the elements in the substance.
-    std::vector<double> coefficients;
+    /// The coefficients of the elements in the substance.
+    std::pmr::vector<double> coefficients{memoryResource()};
 
     /// The oxidation states of the elements in the substance.
-    std::vector<double> oxidationStates;
+    std::pmr::vector<double> oxidationStates{memoryResource()};
 
     /// The symbols of the elements in the substance.
-    std::vector<std::string> symbols;
+    std::pmr::vector<InternedString> symbols{memoryResource()};
 
     /// The molar mass of the substance (in unit of kg/mol).
-    double molarMass;
+    double molarMass = 0.0;
 
     /// Construct a default SubstanceElements::Impl instance
     Impl()
     {}
 
     /// Construct a SubstanceElements::Impl instance
-    Impl(const Args& args)
-    : elements(args.elements),
-      coefficients(args.coefficients),
-      oxidationStates(args.oxidationStates)
+    Impl(Args args)
+    : coefficients(std::move(args.coefficients), memoryResource()),
+      oxidationStates(std::move(args.oxidationStates), memoryResource())
     {
+        // Assigned rather than moved so that the elements are stored in the current memory resource
+        elements = std::move(args.elements);
+
         /// Collect the symbols of the elements
+        symbols.reserve(elements.size());
         for(auto&& element : elements)
             symbols.push_back(element.symbol());
 
@@ -58,11 +64,15 @@ struct SubstanceElements::Impl
 };
 
 SubstanceElements::SubstanceElements()
-: pimpl(new Impl())
+: pimpl(allocateShared<Impl>())
 {}
 
 SubstanceElements::SubstanceElements(const Args& args)
-: pimpl(new Impl(args))
+: pimpl(allocateShared<Impl>(args))
+{}
+
+SubstanceElements::SubstanceElements(Args&& args)
+: pimpl(allocateShared<Impl>(std::move(args)))
 {}
 
 auto SubstanceElements::elements() const -> const Elements&
@@ -70,17 +80,17 @@ auto SubstanceElements::elements() const -> const Elements&
     return pimpl->elements;
 }
 
-auto SubstanceElements::symbols() const -> const std::vector<std::string>&
+auto SubstanceElements::symbols() const -> const std::pmr::vector<InternedString>&
 {
     return pimpl->symbols;
 }
 
-auto SubstanceElements::coefficients() const -> const std::vector<double>&
+auto SubstanceElements::coefficients() const -> const std::pmr::vector<double>&
 {
     return pimpl->coefficients;
 }
 
-auto SubstanceElements::oxidationStates() const -> const std::vector<double>&
+auto SubstanceElements::oxidationStates() const -> const std::pmr::vector<double>&
 {
     return pimpl->oxidationStates;
 }
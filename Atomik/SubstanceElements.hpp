@@ -19,6 +19,7 @@
 
 // C++ includes
 #include <memory>
+#include <memory_resource>
 #include <string>
 #include <vector>
 
@@ -35,13 +36,13 @@ public:
     struct Args
     {
         /// The elements that compose the substance.
-        const Elements& elements;
+        Elements elements;
 
-        /// The oxidation states of the elements in the substance.
-        const std::vector<double>& coefficients;
+        /// The coefficients of the elements in the substance.
+        std::pmr::vector<double> coefficients;
 
         /// The oxidation states of the elements in the substance.
-        const std::vector<double>& oxidationStates;
+        std::pmr::vector<double> oxidationStates;
     };
 
     /// Construct a default SubstanceElements object.
@@ -50,17 +51,20 @@ public:
     /// Construct a SubstanceElements object with given arguments.
     SubstanceElements(const Args& args);
 
+    /// Construct a SubstanceElements object by taking ownership of given arguments.
+    SubstanceElements(Args&& args);
+
     /// Return the elements in the substance.
     auto elements() const -> const Elements&;
 
     /// Return the symbols of the elements in the substance.
-    auto symbols() const -> const std::vector<std::string>&;
+    auto symbols() const -> const std::pmr::vector<InternedString>&;
 
     /// Return the coefficients of the elements in the substance.
-    auto coefficients() const -> const std::vector<double>&;
+    auto coefficients() const -> const std::pmr::vector<double>&;
 
     /// Return the oxidation states of the elements in the substance.
-    auto oxidationStates() const -> const std::vector<double>&;
+    auto oxidationStates() const -> const std::pmr::vector<double>&;
 
     /// Return the molar mass of the substance (in unit of kg/mol).
     auto molarMass() const -> double;
@@ -72,9 +76,9 @@ private:
 };
 
 /// Return an iterator to the begin of the elements container.
-auto begin(const SubstanceElements& elements) { return elements.elements().begin(); }
+inline auto begin(const SubstanceElements& elements) { return elements.elements().begin(); }
 
 /// Return an iterator to the end of the elements container.
-auto end(const SubstanceElements& elements) { return elements.elements().end(); }
+inline auto end(const SubstanceElements& elements) { return elements.elements().end(); }
 
 } // namespace Atomik
@@ -21,145 +21,44 @@
 // Atomik includes
 #include <Atomik/Elements.hpp>
 #include <Atomik/Extract.hpp>
-#include <Atomik/Formula.hpp>
-#include <Atomik/Substance.hpp>
+#include <Atomik/StringList.hpp>
+#include <Atomik/SubstanceElements.hpp>
 using namespace Atomik;
 
-TEST_CASE("Testing Substance class", "[Substance]")
+TEST_CASE("Testing SubstanceElements class", "[SubstanceElements]")
 {
-    Substance substance;
+    const Elements periodic = Elements::PeriodicTable();
 
-    // Test Substance::Substance(formula) constructor
-    substance = Substance("H2O");
-    REQUIRE(substance.formula().equivalent("H2O"));
-    REQUIRE(substance.name() == "H2O");
-    REQUIRE(substance.tags().empty());
-    REQUIRE(substance.molarMass() == Approx(0.01801528));
-    REQUIRE(substance.charge() == 0);
-    REQUIRE(substance.symbols().size() == 2);
-    REQUIRE(substance.symbols() == Extract::symbols(substance.elements()));
-    REQUIRE(substance.coefficient("H") == 2);
-    REQUIRE(substance.coefficient("O") == 1);
+    // Test SubstanceElements::SubstanceElements() constructor
+    SubstanceElements elements;
+    REQUIRE(elements.elements().size() == 0);
+    REQUIRE(elements.symbols().empty());
+    REQUIRE(elements.coefficients().empty());
+    REQUIRE(elements.molarMass() == 0.0);
 
-    // Test Substance::Substance(attributes) constructor
-    substance = Substance({"Na+", "Na+(aq)", {"aqueous", "cation", "charged"}});
-    REQUIRE(substance.formula().equivalent("Na+"));
-    REQUIRE(substance.name() == "Na+(aq)");
-    REQUIRE(substance.tags().size() == 3);
-    REQUIRE(substance.hasTag("aqueous"));
-    REQUIRE(substance.hasTag("cation"));
-    REQUIRE(substance.hasTag("charged"));
-    REQUIRE(substance.molarMass() == Approx(0.022989769));
-    REQUIRE(substance.charge() == 1);
-    REQUIRE(substance.symbols().size() == 2);
-    REQUIRE(substance.symbols() == Extract::symbols(substance.elements()));
-    REQUIRE(substance.coefficient("Na") == 1);
-    REQUIRE(substance.coefficient("Z") == 1);
+    // Test SubstanceElements::SubstanceElements(const Args&) constructor
+    const SubstanceElements::Args args = { periodic.withSymbols("Ca C O"), { 1, 1, 3 }, {} };
+    elements = SubstanceElements(args);
+    REQUIRE(strings(elements.symbols()) == std::vector<std::string>{ "Ca", "C", "O" });
+    REQUIRE(strings(elements.symbols()) == Extract::symbols(elements.elements()));
+    REQUIRE(elements.coefficients() == std::pmr::vector<double>{ 1, 1, 3 });
+    REQUIRE(elements.oxidationStates().empty());
+    REQUIRE(elements.molarMass() == Approx(0.1000869));
 
-    // Test Substance::Substance(attributes) constructor
-    substance = Substance({"Cl-", "Cl-(aq)", {"aqueous", "anion", "charged"}});
-    REQUIRE(substance.formula().equivalent("Cl-"));
-    REQUIRE(substance.name() == "Cl-(aq)");
-    REQUIRE(substance.tags().size() == 3);
-    REQUIRE(substance.hasTag("aqueous"));
-    REQUIRE(substance.hasTag("anion"));
-    REQUIRE(substance.hasTag("charged"));
-    REQUIRE(substance.molarMass() == Approx(0.035453));
-    REQUIRE(substance.charge() == -1);
-    REQUIRE(substance.symbols().size() == 2);
-    REQUIRE(substance.symbols() == Extract::symbols(substance.elements()));
-    REQUIRE(substance.coefficient("Cl") == 1);
-    REQUIRE(substance.coefficient("Z") == -1);
+    // Test the arguments are left untouched by the copying constructor
+    REQUIRE(args.elements.size() == 3);
+    REQUIRE(args.coefficients.size() == 3);
 
-    // Test Substance::Substance(attributes) constructor
-    substance = Substance({"CO3--", "CO3--(aq)", {"aqueous", "anion", "charged"}});
-    REQUIRE(substance.formula().equivalent("CO3-2"));
-    REQUIRE(substance.name() == "CO3--(aq)");
-    REQUIRE(substance.tags().size() == 3);
-    REQUIRE(substance.hasTag("aqueous"));
-    REQUIRE(substance.hasTag("anion"));
-    REQUIRE(substance.hasTag("charged"));
-    REQUIRE(substance.molarMass() == Approx(0.0600092));
-    REQUIRE(substance.charge() == -2);
-    REQUIRE(substance.symbols().size() == 3);
-    REQUIRE(substance.symbols() == Extract::symbols(substance.elements()));
-    REQUIRE(substance.coefficient("C") == 1);
-    REQUIRE(substance.coefficient("O") == 3);
-    REQUIRE(substance.coefficient("Z") == -2);
+    // Test SubstanceElements::SubstanceElements(Args&&) constructor
+    elements = SubstanceElements({ periodic.withSymbols("H O"), { 2, 1 }, { 1, -2 } });
+    REQUIRE(strings(elements.symbols()) == std::vector<std::string>{ "H", "O" });
+    REQUIRE(elements.coefficients() == std::pmr::vector<double>{ 2, 1 });
+    REQUIRE(elements.oxidationStates() == std::pmr::vector<double>{ 1, -2 });
+    REQUIRE(elements.molarMass() == Approx(0.01801528));
 
-    // Test Substance::replaceFormula method with Substance::Substance(formula) constructor
-    substance = Substance("CaCO3").replaceFormula("Ca(CO3)");
-    REQUIRE(substance.formula().equivalent("Ca(CO3)"));
-    REQUIRE(substance.name() == "CaCO3");
-    REQUIRE(substance.tags().empty());
-    REQUIRE(substance.molarMass() == Approx(0.1000869));
-    REQUIRE(substance.charge() == 0);
-    REQUIRE(substance.symbols().size() == 3);
-    REQUIRE(substance.symbols() == Extract::symbols(substance.elements()));
-    REQUIRE(substance.coefficient("C") == 1);
-    REQUIRE(substance.coefficient("Ca") == 1);
-    REQUIRE(substance.coefficient("O") == 3);
-
-    // Test Substance::replaceName method with Substance::Substance(formula) constructor
-    substance = Substance("H+").replaceName("H+(aq)");
-    REQUIRE(substance.formula().equivalent("H+"));
-    REQUIRE(substance.name() == "H+(aq)");
-    REQUIRE(substance.tags().empty());
-    REQUIRE(substance.molarMass() == Approx(0.00100794));
-    REQUIRE(substance.charge() == 1);
-    REQUIRE(substance.symbols().size() == 2);
-    REQUIRE(substance.symbols() == Extract::symbols(substance.elements()));
-    REQUIRE(substance.coefficient("H") == 1);
-    REQUIRE(substance.coefficient("Z") == 1);
-
-    // Test Substance::replaceTags method with Substance::Substance(formula) constructor
-    substance = Substance("HCO3-").replaceTags({"aqueous"});
-    REQUIRE(substance.formula().equivalent("HCO3-"));
-    REQUIRE(substance.name() == "HCO3-");
-    REQUIRE(substance.tags().size() == 1);
-    REQUIRE(substance.hasTag("aqueous"));
-    REQUIRE(substance.molarMass() == Approx(0.0610168));
-    REQUIRE(substance.charge() == -1);
-    REQUIRE(substance.symbols().size() == 4);
-    REQUIRE(substance.symbols() == Extract::symbols(substance.elements()));
-    REQUIRE(substance.coefficient("C") == 1);
-    REQUIRE(substance.coefficient("H") == 1);
-    REQUIRE(substance.coefficient("O") == 3);
-    REQUIRE(substance.coefficient("Z") == -1);
-
-    // Test Substance::replaceTags method with Substance::Substance(formula) constructor
-    substance = Substance("Fe+++").replaceTags({"aqueous", "cation", "charged", "iron"});
-    REQUIRE(substance.formula().equivalent("Fe+3"));
-    REQUIRE(substance.name() == "Fe+++");
-    REQUIRE(substance.tags().size() == 4);
-    REQUIRE(substance.hasTag("aqueous"));
-    REQUIRE(substance.hasTag("cation"));
-    REQUIRE(substance.hasTag("charged"));
-    REQUIRE(substance.hasTag("iron"));
-    REQUIRE(substance.molarMass() == Approx(0.055847));
-    REQUIRE(substance.charge() == 3);
-    REQUIRE(substance.symbols().size() == 2);
-    REQUIRE(substance.symbols() == Extract::symbols(substance.elements()));
-    REQUIRE(substance.coefficient("Fe") == 1);
-    REQUIRE(substance.coefficient("Z") == 3);
-
-    // Test Substance::Substance(formula, elementsdb) constructor
-    Elements elements = Elements::PeriodicTable();
-    elements.append( Element({"Aa"}) );
-    elements.append( Element({"Bb"}) );
-
-    substance = Substance("AaBb2+", elements);
-    REQUIRE(substance.formula().equivalent("AaBb2+"));
-    REQUIRE(substance.name() == "AaBb2+");
-    REQUIRE(substance.tags().empty());
-    REQUIRE(substance.molarMass() == Approx(0.0));
-    REQUIRE(substance.charge() == 1);
-    REQUIRE(substance.symbols().size() == 3);
-    REQUIRE(substance.symbols() == Extract::symbols(substance.elements()));
-    REQUIRE(substance.coefficient("Aa") == 1);
-    REQUIRE(substance.coefficient("Bb") == 2);
-    REQUIRE(substance.coefficient("Z") == 1);
-
-    // Test Substance constructor fails with a formula containing unknown element symbols
-    REQUIRE_THROWS( Substance("RrGgHh") );
+    // Test the range-based iteration over the elements of the substance
+    std::vector<std::string> symbols;
+    for(const auto& element : elements)
+        symbols.push_back(element.symbol());
+    REQUIRE(symbols == strings(elements.symbols()));
 }
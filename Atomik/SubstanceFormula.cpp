@@ -21,22 +21,20 @@
 #include <Atomik/Algorithms.hpp>
 #include <Atomik/ChemicalFormula.hpp>
 #include <Atomik/Exception.hpp>
+#include <Atomik/Memory.hpp>
 
 namespace Atomik {
 
 struct SubstanceFormula::Impl
 {
     /// The chemical formula of the substance.
-    std::string formula;
-
-    /// The element symbols and their coefficients in the substance, e.g., {{"H", 2}, {"O", 1}} for `H2O`.
-    std::unordered_map<std::string, double> elements;
+    InternedString formula;
 
     /// The element symbols in the chemical formula.
-    std::vector<std::string> symbols;
+    std::pmr::vector<InternedString> symbols{memoryResource()};
 
     /// The coefficients of the element symbols in the chemical formula.
-    std::vector<double> coefficients;
+    std::pmr::vector<double> coefficients{memoryResource()};
 
     /// Construct an object of type Impl.
     Impl()
@@ -44,38 +42,43 @@ struct SubstanceFormula::Impl
     }
 
     /// Construct an object of type Impl with given data.
-    Impl(const Args& args)
-    : formula(args.formula), elements(args.elements)
+    Impl(Args args)
+    : formula(std::move(args.formula))
     {
         // Ensure formula is not empty.
         error(formula.empty(), "Data member SubstanceFormula::Data::formula cannot be empty.");
 
         // Ensure elements are not left empty - parse the chemical formula to initialize it if needed
-        if(elements.empty())
-            elements = parseChemicalFormula(formula);
+        if(args.elements.empty())
+            args.elements = parseChemicalFormula(formula);
 
         // Initialize symbols and coefficients
-        symbols.reserve(elements.size());
-        coefficients.reserve(elements.size());
-        for(const auto& [symbol, coeff] : elements)
+        symbols.reserve(args.elements.size());
+        coefficients.reserve(args.elements.size());
+        for(auto& [symbol, coeff] : args.elements)
         {
-            symbols.push_back(symbol);
+            symbols.emplace_back(symbol);
             coefficients.push_back(coeff);
         }
     }
 };
 
 SubstanceFormula::SubstanceFormula()
-: pimpl(new Impl())
+: pimpl(allocateShared<Impl>())
 {}
 
 SubstanceFormula::SubstanceFormula(const std::string& formula)
-: SubstanceFormula({ formula })
+: SubstanceFormula(Args{ formula, {} })
 {
 }
 
 SubstanceFormula::SubstanceFormula(const Args& args)
-: pimpl(new Impl(args))
+: pimpl(allocateShared<Impl>(args))
+{
+}
+
+SubstanceFormula::SubstanceFormula(Args&& args)
+: pimpl(allocateShared<Impl>(std::move(args)))
 {
 }
 
@@ -84,25 +87,28 @@ auto SubstanceFormula::formula() const -> const std::string&
     return pimpl->formula;
 }
 
-auto SubstanceFormula::elements() const -> const std::unordered_map<std::string, double>&
+auto SubstanceFormula::elements() const -> std::unordered_map<std::string, double>
 {
-    return pimpl->elements;
+    std::unordered_map<std::string, double> res;
+    for(auto i = 0u; i < symbols().size(); ++i)
+        res.emplace(symbols()[i], coefficients()[i]);
+    return res;
 }
 
-auto SubstanceFormula::symbols() const -> const std::vector<std::string>&
+auto SubstanceFormula::symbols() const -> const std::pmr::vector<InternedString>&
 {
     return pimpl->symbols;
 }
 
-auto SubstanceFormula::coefficients() const -> const std::vector<double>&
+auto SubstanceFormula::coefficients() const -> const std::pmr::vector<double>&
 {
     return pimpl->coefficients;
 }
 
 auto SubstanceFormula::coefficient(const std::string& symbol) const -> double
 {
-    const auto i = elements().find(symbol);
-    return i != elements().end() ? i->second : 0.0;
+    const auto i = index(symbols(), symbol);
+    return i >= 0 ? coefficients()[i] : 0.0;
 }
 
 auto SubstanceFormula::charge() const -> double
@@ -112,7 +118,15 @@ auto SubstanceFormula::charge() const -> double
 
 auto SubstanceFormula::equivalent(const SubstanceFormula& other) const -> bool
 {
-    return elements() == other.elements();
+    if(symbols().size() != other.symbols().size())
+        return false;
+    for(auto i = 0u; i < symbols().size(); ++i)
+    {
+        const auto j = index(other.symbols(), symbols()[i]);
+        if(j < 0 || other.coefficients()[j] != coefficients()[i])
+            return false;
+    }
+    return true;
 }
 
 SubstanceFormula::operator std::string() const
@@ -127,7 +141,7 @@ auto operator<(const SubstanceFormula& lhs, const SubstanceFormula& rhs) -> bool
 
 auto operator==(const SubstanceFormula& lhs, const SubstanceFormula& rhs) -> bool
 {
-    return lhs.formula() == rhs.formula() && lhs.elements() == rhs.elements();
+    return lhs.formula() == rhs.formula() && lhs.equivalent(rhs);
 }
 
 auto equivalent(const SubstanceFormula& lhs, const SubstanceFormula& rhs) -> bool
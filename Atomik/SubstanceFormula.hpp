@@ -19,10 +19,14 @@
 
 // C++ includes
 #include <memory>
+#include <memory_resource>
 #include <string>
 #include <vector>
 #include <unordered_map>
 
+// Atomik includes
+#include <Atomik/InternedString.hpp>
+
 namespace Atomik {
 
 /// A type used to represent the chemical formula of a substance.
@@ -33,10 +37,10 @@ public:
     struct Args
     {
         /// The chemical formula of the substance.
-        const std::string& formula;
+        std::string formula;
 
         /// The element symbols and their coefficients in the substance, e.g., {{"H", 2}, {"O", 1}} for `H2O`.
-        const std::unordered_map<std::string, double>& elements;
+        std::unordered_map<std::string, double> elements;
     };
 
     /// Construct a default SubstanceFormula object.
@@ -48,17 +52,21 @@ public:
     /// Construct a SubstanceFormula object with given data.
     SubstanceFormula(const Args& args);
 
+    /// Construct a SubstanceFormula object by taking ownership of given data.
+    SubstanceFormula(Args&& args);
+
     /// Return the chemical formula of the substance.
     auto formula() const -> const std::string&;
 
     /// Return element symbols and their coefficients in the substance.
-    auto elements() const -> const std::unordered_map<std::string, double>&;
+    /// The map is built on each call from `symbols` and `coefficients`, which are the stored data.
+    auto elements() const -> std::unordered_map<std::string, double>;
 
     /// Return the element symbols in the chemical formula.
-    auto symbols() const -> const std::vector<std::string>&;
+    auto symbols() const -> const std::pmr::vector<InternedString>&;
 
     /// Return the coefficients of the element symbols in the chemical formula.
-    auto coefficients() const -> const std::vector<double>&;
+    auto coefficients() const -> const std::pmr::vector<double>&;
 
     /// Return the coefficient of an element in the chemical formula.
     /// @param symbol The symbol of the element.
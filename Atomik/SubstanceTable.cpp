@@ -0,0 +1,392 @@
+// Atomik is a library that implements basic chemical concepts such as elements, substances, and reactions.
+//
+// Copyright (C) 2018-2019 Allan Leal and Reaktoro Contributors
+//
+// This library is free software; you can redistribute it and/or
+// modify it under the terms of the GNU Lesser General Public
+// License as published by the Free Software Foundation; either
+// version 2.1 of the License, or (at your option) any later version.
+//
+// This library is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+// Lesser General Public License for more details.
+//
+// You should have received a copy of the GNU Lesser General Public License
+// along with this library. If not, see <http://www.gnu.org/licenses/>.
+
+#include "SubstanceTable.hpp"
+
+// Atomik includes
+#include <Atomik/Algorithms.hpp>
+#include <Atomik/StringList.hpp>
+#include <Atomik/Substance.hpp>
+#include <Atomik/Substances.hpp>
+
+namespace Atomik {
+namespace {
+
+/// Return the index of a given string in a dictionary, appending it if not present.
+auto dictionaryIndex(std::vector<InternedString>& dictionary, InternedString str) -> Index
+{
+    const auto i = index(dictionary, str);
+    if(i >= 0) return i;
+    dictionary.push_back(str);
+    return dictionary.size() - 1;
+}
+
+} // namespace
+
+SubstanceTable::SubstanceTable()
+: m_nameOffsets{0}, m_formulaOffsets{0}, m_compositionOffsets{0}
+{}
+
+SubstanceTable::SubstanceTable(const Substances& substances)
+: SubstanceTable()
+{
+    m_nameOffsets.reserve(substances.size() + 1);
+    m_formulaOffsets.reserve(substances.size() + 1);
+    m_compositionOffsets.reserve(substances.size() + 1);
+    m_charges.reserve(substances.size());
+    m_molarMasses.reserve(substances.size());
+    m_typeIndices.reserve(substances.size());
+    for(const auto& substance : substances)
+        append(substance);
+}
+
+auto SubstanceTable::append(const Substance& substance) -> void
+{
+    m_names += substance.name();
+    m_nameOffsets.push_back(m_names.size());
+
+    m_formulas += substance.formula().formula();
+    m_formulaOffsets.push_back(m_formulas.size());
+
+    m_charges.push_back(substance.charge());
+    m_molarMasses.push_back(substance.molarMass());
+
+    const auto& elements = substance.elements().elements();
+    const auto& coefficients = substance.elements().coefficients();
+    for(auto i = 0u; i < elements.size(); ++i)
+    {
+        auto ielement = m_elements.indexWithSymbol(elements[i].symbol());
+        if(ielement < 0)
+        {
+            m_elements.append(elements[i]);
+            ielement = m_elements.size() - 1;
+        }
+        m_compositionElements.push_back(ielement);
+        m_compositionCoefficients.push_back(coefficients[i]);
+    }
+    m_compositionOffsets.push_back(m_compositionElements.size());
+
+    m_typeIndices.push_back(dictionaryIndex(m_types, substance.type()));
+
+    std::vector<Index> itags;
+    itags.reserve(substance.tags().size());
+    for(const auto& tag : substance.tags())
+        itags.push_back(tagIndex(tag));
+
+    m_tagBits.resize(m_tagBits.size() + m_tagWords, 0);
+    const auto row = m_tagBits.end() - m_tagWords;
+    for(auto itag : itags)
+        row[itag / 64] |= std::uint64_t(1) << (itag % 64);
+
+    ++m_size;
+}
+
+auto SubstanceTable::append(std::string_view name, std::string_view formula, InternedString type, const std::vector<InternedString>& tags, const std::vector<Element>& elements, const std::vector<double>& coefficients) -> void
+{
+    m_names += name;
+    m_nameOffsets.push_back(m_names.size());
+
+    m_formulas += formula;
+    m_formulaOffsets.push_back(m_formulas.size());
+
+    double charge = 0.0;
+    double molarMass = 0.0;
+    for(auto i = 0u; i < elements.size(); ++i)
+    {
+        auto ielement = m_elements.indexWithSymbol(elements[i].symbol());
+        if(ielement < 0)
+        {
+            m_elements.append(elements[i]);
+            ielement = m_elements.size() - 1;
+        }
+        m_compositionElements.push_back(ielement);
+        m_compositionCoefficients.push_back(coefficients[i]);
+        molarMass += coefficients[i] * elements[i].molarMass();
+        if(elements[i].symbol().view() == "Z")
+            charge = coefficients[i];
+    }
+    m_compositionOffsets.push_back(m_compositionElements.size());
+
+    m_charges.push_back(charge);
+    m_molarMasses.push_back(molarMass);
+
+    m_typeIndices.push_back(dictionaryIndex(m_types, type));
+
+    std::vector<Index> itags;
+    itags.reserve(tags.size());
+    for(const auto& tag : tags)
+        itags.push_back(tagIndex(tag));
+
+    m_tagBits.resize(m_tagBits.size() + m_tagWords, 0);
+    const auto row = m_tagBits.end() - m_tagWords;
+    for(auto itag : itags)
+        row[itag / 64] |= std::uint64_t(1) << (itag % 64);
+
+    ++m_size;
+}
+
+auto SubstanceTable::append(const SubstanceTable& other) -> void
+{
+    const auto nameOffset = m_names.size();
+    m_names += other.m_names;
+    for(auto i = 1u; i <= other.m_size; ++i)
+        m_nameOffsets.push_back(nameOffset + other.m_nameOffsets[i]);
+
+    const auto formulaOffset = m_formulas.size();
+    m_formulas += other.m_formulas;
+    for(auto i = 1u; i <= other.m_size; ++i)
+        m_formulaOffsets.push_back(formulaOffset + other.m_formulaOffsets[i]);
+
+    m_charges.insert(m_charges.end(), other.m_charges.begin(), other.m_charges.end());
+    m_molarMasses.insert(m_molarMasses.end(), other.m_molarMasses.begin(), other.m_molarMasses.end());
+
+    std::vector<Index> ielements(other.m_elements.size());
+    for(auto i = 0u; i < other.m_elements.size(); ++i)
+    {
+        ielements[i] = m_elements.indexWithSymbol(other.m_elements[i].symbol());
+        if(ielements[i] < 0)
+        {
+            m_elements.append(other.m_elements[i]);
+            ielements[i] = m_elements.size() - 1;
+        }
+    }
+    const auto compositionOffset = m_compositionElements.size();
+    for(auto i = 1u; i <= other.m_size; ++i)
+        m_compositionOffsets.push_back(compositionOffset + other.m_compositionOffsets[i]);
+    for(auto ielement : other.m_compositionElements)
+        m_compositionElements.push_back(ielements[ielement]);
+    m_compositionCoefficients.insert(m_compositionCoefficients.end(), other.m_compositionCoefficients.begin(), other.m_compositionCoefficients.end());
+
+    std::vector<Index> itypes(other.m_types.size());
+    for(auto i = 0u; i < other.m_types.size(); ++i)
+        itypes[i] = dictionaryIndex(m_types, other.m_types[i]);
+    for(auto itype : other.m_typeIndices)
+        m_typeIndices.push_back(itypes[itype]);
+
+    std::vector<Index> itags(other.m_tags.size());
+    for(auto i = 0u; i < other.m_tags.size(); ++i)
+        itags[i] = tagIndex(other.m_tags[i]);
+    m_tagBits.resize(m_tagBits.size() + other.m_size * m_tagWords, 0);
+    auto row = m_tagBits.end() - other.m_size * m_tagWords;
+    for(auto i = 0u; i < other.m_size; ++i, row += m_tagWords)
+        for(auto itag = 0u; itag < other.m_tags.size(); ++itag)
+            if(other.m_tagBits[i * other.m_tagWords + itag / 64] & (std::uint64_t(1) << (itag % 64)))
+                row[itags[itag] / 64] |= std::uint64_t(1) << (itags[itag] % 64);
+
+    m_size += other.m_size;
+}
+
+auto SubstanceTable::size() const -> std::size_t
+{
+    return m_size;
+}
+
+auto SubstanceTable::name(Index index) const -> std::string_view
+{
+    const auto begin = m_nameOffsets[index];
+    return std::string_view(m_names).substr(begin, m_nameOffsets[index + 1] - begin);
+}
+
+auto SubstanceTable::formula(Index index) const -> std::string_view
+{
+    const auto begin = m_formulaOffsets[index];
+    return std::string_view(m_formulas).substr(begin, m_formulaOffsets[index + 1] - begin);
+}
+
+auto SubstanceTable::type(Index index) const -> InternedString
+{
+    return m_types[m_typeIndices[index]];
+}
+
+auto SubstanceTable::tags(Index index) const -> std::vector<InternedString>
+{
+    std::vector<InternedString> res;
+    for(auto itag = 0u; itag < m_tags.size(); ++itag)
+        if(m_tagBits[index * m_tagWords + itag / 64] & (std::uint64_t(1) << (itag % 64)))
+            res.push_back(m_tags[itag]);
+    return res;
+}
+
+auto SubstanceTable::hasTag(Index index, const std::string& tag) const -> bool
+{
+    const auto itag = Atomik::index(m_tags, InternedString::find(tag));
+    if(itag < 0) return false;
+    return m_tagBits[index * m_tagWords + itag / 64] & (std::uint64_t(1) << (itag % 64));
+}
+
+auto SubstanceTable::charges() const -> const std::vector<double>&
+{
+    return m_charges;
+}
+
+auto SubstanceTable::molarMasses() const -> const std::vector<double>&
+{
+    return m_molarMasses;
+}
+
+auto SubstanceTable::elements() const -> const Elements&
+{
+    return m_elements;
+}
+
+auto SubstanceTable::compositionOffsets() const -> const std::vector<std::size_t>&
+{
+    return m_compositionOffsets;
+}
+
+auto SubstanceTable::compositionElements() const -> const std::vector<Index>&
+{
+    return m_compositionElements;
+}
+
+auto SubstanceTable::compositionCoefficients() const -> const std::vector<double>&
+{
+    return m_compositionCoefficients;
+}
+
+auto SubstanceTable::types() const -> const std::vector<InternedString>&
+{
+    return m_types;
+}
+
+auto SubstanceTable::typeIndices() const -> const std::vector<Index>&
+{
+    return m_typeIndices;
+}
+
+auto SubstanceTable::tagNames() const -> const std::vector<InternedString>&
+{
+    return m_tags;
+}
+
+auto SubstanceTable::indexWithName(std::string_view name) const -> Index
+{
+    for(auto i = 0u; i < m_size; ++i)
+        if(this->name(i) == name)
+            return i;
+    return -1;
+}
+
+auto SubstanceTable::indicesWithTag(const std::string& tag) const -> std::vector<Index>
+{
+    return indicesWithTags(std::vector<std::string>{ tag });
+}
+
+auto SubstanceTable::indicesWithTags(const StringList& tags) const -> std::vector<Index>
+{
+    std::vector<std::uint64_t> mask(m_tagWords, 0);
+    for(const auto& tag : tags)
+    {
+        const auto itag = index(m_tags, InternedString::find(tag));
+        if(itag < 0) return {};
+        mask[itag / 64] |= std::uint64_t(1) << (itag % 64);
+    }
+
+    std::vector<Index> res;
+    for(auto i = 0u; i < m_size; ++i)
+    {
+        const auto row = m_tagBits.begin() + i * m_tagWords;
+        auto matches = true;
+        for(auto k = 0u; k < m_tagWords && matches; ++k)
+            matches = (row[k] & mask[k]) == mask[k];
+        if(matches)
+            res.push_back(i);
+    }
+    return res;
+}
+
+auto SubstanceTable::indicesWithElements(const StringList& symbols) const -> std::vector<Index>
+{
+    std::vector<char> allowed(m_elements.size());
+    for(auto i = 0u; i < m_elements.size(); ++i)
+        allowed[i] = contains(symbols, m_elements[i].symbol());
+
+    std::vector<Index> res;
+    for(auto i = 0u; i < m_size; ++i)
+    {
+        auto matches = true;
+        for(auto k = m_compositionOffsets[i]; k < m_compositionOffsets[i + 1] && matches; ++k)
+            matches = allowed[m_compositionElements[k]];
+        if(matches)
+            res.push_back(i);
+    }
+    return res;
+}
+
+auto SubstanceTable::substance(Index index) const -> Substance
+{
+    Substance::Args args;
+    args.name = std::string(name(index));
+    args.type = type(index);
+    args.tags = strings(tags(index));
+
+    SubstanceFormula::Args formulaArgs;
+    SubstanceElements::Args elementsArgs;
+    formulaArgs.formula = std::string(formula(index));
+    for(auto k = m_compositionOffsets[index]; k < m_compositionOffsets[index + 1]; ++k)
+    {
+        const auto& element = m_elements[m_compositionElements[k]];
+        const auto coefficient = m_compositionCoefficients[k];
+        formulaArgs.elements.emplace(element.symbol(), coefficient);
+        elementsArgs.elements.append(element);
+        elementsArgs.coefficients.push_back(coefficient);
+    }
+
+    args.formula = SubstanceFormula(std::move(formulaArgs));
+    args.elements = SubstanceElements(std::move(elementsArgs));
+
+    return Substance(std::move(args));
+}
+
+auto SubstanceTable::substances(const std::vector<Index>& indices) const -> Substances
+{
+    std::vector<Substance> res;
+    res.reserve(indices.size());
+    for(auto i : indices)
+        res.push_back(substance(i));
+    return Substances(std::move(res));
+}
+
+SubstanceTable::operator Substances() const
+{
+    std::vector<Substance> res;
+    res.reserve(m_size);
+    for(auto i = 0u; i < m_size; ++i)
+        res.push_back(substance(i));
+    return Substances(std::move(res));
+}
+
+auto SubstanceTable::tagIndex(InternedString tag) -> Index
+{
+    const auto itag = index(m_tags, tag);
+    if(itag >= 0) return itag;
+
+    if(m_tags.size() == m_tagWords * 64)
+    {
+        const auto words = m_tagWords + 1;
+        std::vector<std::uint64_t> bits(m_size * words, 0);
+        for(auto i = 0u; i < m_size; ++i)
+            std::copy_n(m_tagBits.begin() + i * m_tagWords, m_tagWords, bits.begin() + i * words);
+        m_tagBits = std::move(bits);
+        m_tagWords = words;
+    }
+
+    m_tags.push_back(tag);
+    return m_tags.size() - 1;
+}
+
+} // namespace Atomik
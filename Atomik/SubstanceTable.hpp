@@ -0,0 +1,195 @@
+// Atomik is a library that implements basic chemical concepts such as elements, substances, and reactions.
+//
+// Copyright (C) 2018-2019 Allan Leal and Reaktoro Contributors
+//
+// This library is free software; you can redistribute it and/or
+// modify it under the terms of the GNU Lesser General Public
+// License as published by the Free Software Foundation; either
+// version 2.1 of the License, or (at your option) any later version.
+//
+// This library is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+// Lesser General Public License for more details.
+//
+// You should have received a copy of the GNU Lesser General Public License
+// along with this library. If not, see <http://www.gnu.org/licenses/>.
+
+#pragma once
+
+// C++ includes
+#include <cstdint>
+#include <string>
+#include <string_view>
+#include <vector>
+
+// Atomik includes
+#include <Atomik/Elements.hpp>
+#include <Atomik/Index.hpp>
+#include <Atomik/InternedString.hpp>
+
+namespace Atomik {
+
+// Forward declarations
+class StringList;
+class Substance;
+class Substances;
+
+/// A type used to store a collection of chemical substances in columns.
+/// Instead of one Substance object per row, this class stores each attribute of the
+/// substances in a contiguous column so that scans and aggregations over many substances
+/// do not chase pointers. The molar masses and charges are computed once on construction.
+/// The elemental composition of the substances is stored in compressed sparse row (CSR)
+/// format, with element indices referring to the table's own dictionary of elements.
+/// ~~~
+/// using namespace Atomik;
+/// SubstanceTable table(Substances("H2O H+ OH- CO2 HCO3- CO3-2"));
+/// double total = 0.0;
+/// for(auto molarMass : table.molarMasses())
+///     total += molarMass;
+/// ~~~
+class SubstanceTable
+{
+public:
+    /// Construct a default SubstanceTable object.
+    SubstanceTable();
+
+    /// Construct a SubstanceTable object with given substances.
+    explicit SubstanceTable(const Substances& substances);
+
+    /// Append a new substance to the table.
+    auto append(const Substance& substance) -> void;
+
+    /// Append a new substance to the table with given attributes and elemental composition.
+    /// This avoids constructing a Substance object for each appended row. The electric charge
+    /// is the coefficient of element `Z`, if present, and the molar mass is computed from the
+    /// molar masses of the given elements.
+    auto append(std::string_view name, std::string_view formula, InternedString type, const std::vector<InternedString>& tags, const std::vector<Element>& elements, const std::vector<double>& coefficients) -> void;
+
+    /// Append the substances of another table (which must not be this table), merging their columns.
+    auto append(const SubstanceTable& other) -> void;
+
+    /// Return the number of substances in the table.
+    auto size() const -> std::size_t;
+
+    /// Return the name of the substance with given index.
+    auto name(Index index) const -> std::string_view;
+
+    /// Return the chemical formula of the substance with given index.
+    auto formula(Index index) const -> std::string_view;
+
+    /// Return the type of the substance with given index (e.g., `aqueous`, `gaseous`).
+    auto type(Index index) const -> InternedString;
+
+    /// Return the tags of the substance with given index.
+    auto tags(Index index) const -> std::vector<InternedString>;
+
+    /// Return true if the substance with given index has a given tag.
+    auto hasTag(Index index, const std::string& tag) const -> bool;
+
+    /// Return the electric charges of the substances.
+    auto charges() const -> const std::vector<double>&;
+
+    /// Return the molar masses of the substances (in unit of kg/mol).
+    auto molarMasses() const -> const std::vector<double>&;
+
+    /// Return the distinct elements composing the substances in the table.
+    auto elements() const -> const Elements&;
+
+    /// Return the offsets of each substance in the composition columns (with size equal to `size() + 1`).
+    auto compositionOffsets() const -> const std::vector<std::size_t>&;
+
+    /// Return the indices in `elements()` of the elements composing the substances.
+    auto compositionElements() const -> const std::vector<Index>&;
+
+    /// Return the coefficients of the elements composing the substances.
+    auto compositionCoefficients() const -> const std::vector<double>&;
+
+    /// Return the distinct types of the substances in the table.
+    auto types() const -> const std::vector<InternedString>&;
+
+    /// Return the indices in `types()` of the type of each substance.
+    auto typeIndices() const -> const std::vector<Index>&;
+
+    /// Return the distinct tags of the substances in the table.
+    auto tagNames() const -> const std::vector<InternedString>&;
+
+    /// Return the index of the first substance with given name.
+    /// If there is no substance with given name, return -1.
+    auto indexWithName(std::string_view name) const -> Index;
+
+    /// Return the indices of the substances with a given tag.
+    auto indicesWithTag(const std::string& tag) const -> std::vector<Index>;
+
+    /// Return the indices of the substances with given tags.
+    auto indicesWithTags(const StringList& tags) const -> std::vector<Index>;
+
+    /// Return the indices of the substances composed only of given elements.
+    auto indicesWithElements(const StringList& symbols) const -> std::vector<Index>;
+
+    /// Return the substance with given index.
+    auto substance(Index index) const -> Substance;
+
+    /// Return the substances with given indices.
+    auto substances(const std::vector<Index>& indices) const -> Substances;
+
+    /// Convert this SubstanceTable object into a Substances object.
+    operator Substances() const;
+
+private:
+    /// Decode a compressed archive directly into the columns of a table.
+    friend auto decodeSubstanceArchiveTable(std::string_view archive) -> SubstanceTable;
+
+    /// The number of substances in the table.
+    std::size_t m_size = 0;
+
+    /// The characters of the names of the substances.
+    std::string m_names;
+
+    /// The offsets of each name in `m_names` (with size equal to `m_size + 1`).
+    std::vector<std::size_t> m_nameOffsets;
+
+    /// The characters of the formulas of the substances.
+    std::string m_formulas;
+
+    /// The offsets of each formula in `m_formulas` (with size equal to `m_size + 1`).
+    std::vector<std::size_t> m_formulaOffsets;
+
+    /// The electric charges of the substances.
+    std::vector<double> m_charges;
+
+    /// The molar masses of the substances.
+    std::vector<double> m_molarMasses;
+
+    /// The distinct elements composing the substances.
+    Elements m_elements;
+
+    /// The offsets of each substance in the composition columns (with size equal to `m_size + 1`).
+    std::vector<std::size_t> m_compositionOffsets;
+
+    /// The indices in `m_elements` of the elements composing the substances.
+    std::vector<Index> m_compositionElements;
+
+    /// The coefficients of the elements composing the substances.
+    std::vector<double> m_compositionCoefficients;
+
+    /// The distinct types of the substances.
+    std::vector<InternedString> m_types;
+
+    /// The indices in `m_types` of the type of each substance.
+    std::vector<Index> m_typeIndices;
+
+    /// The distinct tags of the substances.
+    std::vector<InternedString> m_tags;
+
+    /// The tags of each substance as bitsets over `m_tags`, stored row after row.
+    std::vector<std::uint64_t> m_tagBits;
+
+    /// The number of 64-bit words in the tag bitset of each substance.
+    std::size_t m_tagWords = 0;
+
+    /// Return the index of a given tag in `m_tags`, adding it and widening the bitsets if needed.
+    auto tagIndex(InternedString tag) -> Index;
+};
+
+} // namespace Atomik
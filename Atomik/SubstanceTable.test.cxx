@@ -0,0 +1,112 @@
+// Atomik is a library that implements basic chemical concepts such as elements, substances, and reactions.
+//
+// Copyright (C) 2018-2019 Allan Leal and Reaktoro Contributors
+//
+// This library is free software; you can redistribute it and/or
+// modify it under the terms of the GNU Lesser General Public
+// License as published by the Free Software Foundation; either
+// version 2.1 of the License, or (at your option) any later version.
+//
+// This library is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+// Lesser General Public License for more details.
+//
+// You should have received a copy of the GNU Lesser General Public License
+// along with this library. If not, see <http://www.gnu.org/licenses/>.
+
+// Catch includes
+#include <catch2/catch.hpp>
+
+// Atomik includes
+#include <Atomik/StringList.hpp>
+#include <Atomik/Substances.hpp>
+#include <Atomik/SubstanceTable.hpp>
+using namespace Atomik;
+
+TEST_CASE("Testing SubstanceTable", "[SubstanceTable]")
+{
+    Substances substances({
+        Substance("H2O").replaceName("H2O(aq)").replaceTags({"aqueous", "neutral", "solvent"}),
+        Substance("H+").replaceName("H+(aq)").replaceTags({"aqueous", "charged", "cation"}),
+        Substance("OH-").replaceName("OH-(aq)").replaceTags({"aqueous", "charged", "anion"}),
+        Substance("CO2").replaceName("CO2(g)").replaceTags({"gaseous"}),
+        Substance("CO3-2").replaceName("CO3-2(aq)").replaceTags({"aqueous", "charged", "anion"}),
+    });
+
+    SubstanceTable table(substances);
+
+    REQUIRE( table.size() == 5 );
+
+    // Test the string and numeric columns
+    for(auto i = 0u; i < table.size(); ++i)
+    {
+        REQUIRE( table.name(i) == substances[i].name() );
+        REQUIRE( table.formula(i) == substances[i].formula().formula() );
+        REQUIRE( strings(table.tags(i)) == strings(substances[i].tags()) );
+        REQUIRE( table.charges()[i] == substances[i].charge() );
+        REQUIRE( table.molarMasses()[i] == substances[i].molarMass() );
+    }
+
+    // Test the composition columns
+    REQUIRE( table.compositionOffsets().size() == table.size() + 1 );
+    REQUIRE( table.elements().size() == 4 ); // H, O, Z, C
+
+    const auto k = table.compositionOffsets()[4];
+    const auto n = table.compositionOffsets()[5] - k;
+
+    REQUIRE( n == 3 );
+
+    auto coefficient = [&](auto symbol)
+    {
+        for(auto j = k; j < k + n; ++j)
+            if(table.elements()[table.compositionElements()[j]].symbol() == symbol)
+                return table.compositionCoefficients()[j];
+        return 0.0;
+    };
+
+    REQUIRE( coefficient("C") == 1 );
+    REQUIRE( coefficient("O") == 3 );
+    REQUIRE( coefficient("Z") == -2 );
+
+    // Test the queries
+    REQUIRE( table.indexWithName("CO2(g)") == 3 );
+    REQUIRE( table.indexWithName("XY(aq)") == -1 );
+
+    REQUIRE( table.hasTag(0, "solvent") );
+    REQUIRE_FALSE( table.hasTag(3, "aqueous") );
+
+    REQUIRE( table.indicesWithTag("aqueous") == std::vector<Index>{0, 1, 2, 4} );
+    REQUIRE( table.indicesWithTags("charged anion") == std::vector<Index>{2, 4} );
+    REQUIRE( table.indicesWithTag("unknown").empty() );
+
+    REQUIRE( table.indicesWithElements("H O") == std::vector<Index>{0} );
+    REQUIRE( table.indicesWithElements("H O Z") == std::vector<Index>{0, 1, 2} );
+    REQUIRE( table.indicesWithElements("C O Z") == std::vector<Index>{3, 4} );
+
+    // Test the conversion back to Substances
+    Substances converted = table;
+
+    REQUIRE( converted.size() == substances.size() );
+
+    for(auto i = 0u; i < converted.size(); ++i)
+    {
+        REQUIRE( converted[i].name() == substances[i].name() );
+        REQUIRE( converted[i].formula().equivalent(substances[i].formula()) );
+        REQUIRE( converted[i].tags() == substances[i].tags() );
+        REQUIRE( converted[i].molarMass() == Approx(substances[i].molarMass()) );
+        REQUIRE( converted[i].charge() == substances[i].charge() );
+    }
+
+    // Test tag bitsets wider than a single word
+    SubstanceTable wide;
+    for(auto i = 0; i < 70; ++i)
+        wide.append(Substance("H2O").replaceTags({ "tag" + std::to_string(i) }));
+
+    REQUIRE( wide.size() == 70 );
+    REQUIRE( wide.tagNames().size() == 70 );
+    REQUIRE( wide.hasTag(0, "tag0") );
+    REQUIRE( wide.hasTag(69, "tag69") );
+    REQUIRE_FALSE( wide.hasTag(69, "tag0") );
+    REQUIRE( wide.indicesWithTag("tag65") == std::vector<Index>{65} );
+}
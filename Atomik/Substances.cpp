@@ -20,35 +20,64 @@
 // Atomik includes
 #include <Atomik/Algorithms.hpp>
 #include <Atomik/Exception.hpp>
-#include <Atomik/Formula.hpp>
+#include <Atomik/Instrumentation.hpp>
+#include <Atomik/Memory.hpp>
 #include <Atomik/StringList.hpp>
+#include <Atomik/SubstanceFormula.hpp>
+#include <Atomik/Tracing.hpp>
 #include <Atomik/WithUtils.hpp>
 
 namespace Atomik {
+namespace {
+
+/// Return the substances in a collection that satisfy a given predicate.
+template<typename Predicate>
+auto select(const Substances& substances, const Predicate& pred) -> Substances
+{
+    Substances res;
+    for(const auto& substance : substances)
+        if(pred(substance))
+            res.append(substance);
+    return res;
+}
+
+} // namespace
 
 Substances::Substances()
+: m_substances(memoryResource())
 {}
 
 Substances::Substances(std::initializer_list<Substance> substances)
-: m_substances(std::move(substances))
+: m_substances(substances, memoryResource())
 {}
 
 Substances::Substances(std::vector<Substance> substances)
-: m_substances(std::move(substances))
+: m_substances(std::make_move_iterator(substances.begin()), std::make_move_iterator(substances.end()), memoryResource())
 {}
 
 Substances::Substances(StringList formulas)
-: m_substances(formulas.size())
+: m_substances(memoryResource())
 {
-    transform(formulas, m_substances, [&](std::string formula) { return Substance(formula); });
+    m_substances.reserve(formulas.size());
+    for(const auto& formula : formulas)
+        m_substances.emplace_back(formula);
 }
 
+Substances::Substances(const Substances& other)
+: m_substances(other.m_substances, memoryResource())
+{}
+
 auto Substances::append(Substance substance) -> void
 {
     m_substances.emplace_back(std::move(substance));
 }
 
-auto Substances::data() const -> const std::vector<Substance>&
+auto Substances::append(Substance::Args&& args) -> void
+{
+    m_substances.emplace_back(std::move(args));
+}
+
+auto Substances::data() const -> const std::pmr::vector<Substance>&
 {
     return m_substances;
 }
@@ -65,12 +94,18 @@ auto Substances::operator[](Index index) const -> const Substance&
 
 auto Substances::indexWithName(std::string name) const -> Index
 {
-    return indexfn(data(), Atomik::withName(name));
+    const auto idx = indexfn(data(), Atomik::withName(name));
+    ATOMIK_COUNT(Counter::SubstanceLookups, 1);
+    ATOMIK_COUNT(Counter::SubstanceLookupComparisons, idx < 0 ? size() : idx + 1);
+    return idx;
 }
 
 auto Substances::indexWithFormula(std::string formula) const -> Index
 {
-    return indexfn(data(), Atomik::withFormula(formula));
+    const auto idx = indexfn(data(), Atomik::withFormula(formula));
+    ATOMIK_COUNT(Counter::SubstanceLookups, 1);
+    ATOMIK_COUNT(Counter::SubstanceLookupComparisons, idx < 0 ? size() : idx + 1);
+    return idx;
 }
 
 auto Substances::getWithName(std::string name) const -> Substance
@@ -89,49 +124,67 @@ auto Substances::getWithFormula(std::string formula) const -> Substance
 
 auto Substances::withNames(const StringList& names) const -> Substances
 {
-    std::vector<Substance> selected(names.size());
-    transform(names, selected, [&](auto&& name) { return getWithName(name); });
-    return Substances(selected);
+    Substances selected;
+    selected.m_substances.reserve(names.size());
+    for(const auto& name : names)
+        selected.append(getWithName(name));
+    return selected;
 }
 
 auto Substances::withFormulas(const StringList& formulas) const -> Substances
 {
-    std::vector<Substance> selected(formulas.size());
-    transform(formulas, selected, [&](auto&& formula) { return getWithFormula(formula); });
-    return Substances(selected);
+    Substances selected;
+    selected.m_substances.reserve(formulas.size());
+    for(const auto& formula : formulas)
+        selected.append(getWithFormula(formula));
+    return selected;
 }
 
 auto Substances::withTag(std::string tag) const -> Substances
 {
-    return Substances(filter(data(), Atomik::withTag(tag)));
+    ATOMIK_COUNT(Counter::SubstanceFilters, 1);
+    ATOMIK_TRACE("Substances::withTag");
+    return select(*this, Atomik::withTag(tag));
 }
 
 auto Substances::withoutTag(std::string tag) const -> Substances
 {
-    return Substances(remove(data(), Atomik::withTag(tag)));
+    ATOMIK_COUNT(Counter::SubstanceFilters, 1);
+    ATOMIK_TRACE("Substances::withoutTag");
+    return select(*this, [pred = Atomik::withTag(tag)](auto&& substance) { return !pred(substance); });
 }
 
 auto Substances::withTags(const StringList& tags) const -> Substances
 {
-    return Substances(filter(data(), Atomik::withTags(tags.data())));
+    ATOMIK_COUNT(Counter::SubstanceFilters, 1);
+    ATOMIK_TRACE("Substances::withTags");
+    return select(*this, Atomik::withTags(tags.data()));
 }
 
 auto Substances::withoutTags(const StringList& tags) const -> Substances
 {
-    return Substances(remove(data(), Atomik::withTags(tags.data())));
+    ATOMIK_COUNT(Counter::SubstanceFilters, 1);
+    ATOMIK_TRACE("Substances::withoutTags");
+    return select(*this, [pred = Atomik::withTags(tags.data())](auto&& substance) { return !pred(substance); });
 }
 
 auto Substances::withElements(const StringList& symbols) const -> Substances
 {
-    return Substances(filter(data(), Atomik::withSymbols(symbols.data())));
+    ATOMIK_COUNT(Counter::SubstanceFilters, 1);
+    ATOMIK_TRACE("Substances::withElements");
+    return select(*this, [&](auto&& substance) { return contained(substance.elements().symbols(), symbols.data()); });
 }
 
 auto Substances::withElementsOf(const StringList& formulas) const -> Substances
 {
     std::vector<std::string> symbols;
     for(auto formula : formulas)
-        symbols = merge(symbols, Formula(formula).symbols());
-    return withElements(symbols);
+    {
+        const SubstanceFormula parsed(formula);
+        for(const auto& symbol : parsed.symbols())
+            symbols.push_back(symbol);
+    }
+    return withElements(unique(symbols));
 }
 
 auto Substances::tagged(const std::string& tag) const -> Substances
@@ -18,6 +18,7 @@
 #pragma once
 
 // C++ includes
+#include <memory_resource>
 #include <string>
 #include <vector>
 
@@ -46,11 +47,26 @@ public:
     /// Construct an Substances object with given substance formulas.
     explicit Substances(StringList formulas);
 
+    /// Construct a copy of a Substances object allocated from the current memory resource.
+    Substances(const Substances& other);
+
+    /// Construct a Substances object by taking the substances of another, with its memory resource.
+    Substances(Substances&& other) = default;
+
+    /// Assign the substances of another Substances object to this one, keeping the memory resource of this one.
+    auto operator=(const Substances& other) -> Substances& = default;
+
+    /// Assign the substances of another Substances object to this one, keeping the memory resource of this one.
+    auto operator=(Substances&& other) -> Substances& = default;
+
     /// Append a new substance to the list of substances.
     auto append(Substance substance) -> void;
 
+    /// Append a new substance to the list of substances constructed in place from given data.
+    auto append(Substance::Args&& args) -> void;
+
     /// Return the internal collection of Substance objects.
-    auto data() const -> const std::vector<Substance>&;
+    auto data() const -> const std::pmr::vector<Substance>&;
 
     /// Return the number of chemical substances in the collection.
     auto size() const -> std::size_t;
@@ -148,8 +164,11 @@ public:
     static auto PeriodicTable() -> Substances;
 
 private:
-    /// The chemical substances stored in the database.
-    std::vector<Substance> m_substances;
+    /// Allow Database objects to update their substances in place when applying a delta.
+    friend class Database;
+
+    /// The chemical substances stored in the database, allocated from the memory resource current at construction.
+    std::pmr::vector<Substance> m_substances;
 };
 
 } // namespace Atomik
@@ -48,21 +48,21 @@ TEST_CASE("Testing Substances", "[Substances]")
 
     // Test constructor Substances(vector<Substance>)
     substances = Substances({
-        Substance({ "H2O"  , "H2O(aq)"  , { "aqueous", "neutral", "solvent" } }),
-        Substance({ "H+"   , "H+(aq)"   , { "aqueous", "charged", "cation"}   }),
-        Substance({ "OH-"  , "OH-(aq)"  , { "aqueous", "charged", "anion" }   }),
-        Substance({ "H2"   , "H2(aq)"   , { "aqueous", "neutral" }            }),
-        Substance({ "O2"   , "O2(aq)"   , { "aqueous", "neutral" }            }),
-        Substance({ "Na+"  , "Na+(aq)"  , { "aqueous", "charged", "cation"}   }),
-        Substance({ "Cl-"  , "Cl-(aq)"  , { "aqueous", "charged", "anion" }   }),
-        Substance({ "NaCl" , "NaCl(aq)" , { "aqueous", "neutral" }            }),
-        Substance({ "CO2"  , "CO2(aq)"  , { "aqueous", "neutral" }            }),
-        Substance({ "HCO3-", "HCO3-(aq)", { "aqueous", "charged", "anion" }   }),
-        Substance({ "CO3-2", "CO3-2(aq)", { "aqueous", "charged", "anion" }   }),
-        Substance({ "CH4"  , "CH4(aq)"  , { "aqueous", "neutral" }            }),
-        Substance({ "H2O"  , "H2O(g)"   , { "gaseous" }                       }),
-        Substance({ "CO2"  , "CO2(g)"   , { "gaseous" }                       }),
-        Substance({ "CH4"  , "CH4(g)"   , { "gaseous" }                       }),
+        Substance("H2O").replaceName("H2O(aq)").replaceTags({ "aqueous", "neutral", "solvent" }),
+        Substance("H+").replaceName("H+(aq)").replaceTags({ "aqueous", "charged", "cation"}),
+        Substance("OH-").replaceName("OH-(aq)").replaceTags({ "aqueous", "charged", "anion" }),
+        Substance("H2").replaceName("H2(aq)").replaceTags({ "aqueous", "neutral" }),
+        Substance("O2").replaceName("O2(aq)").replaceTags({ "aqueous", "neutral" }),
+        Substance("Na+").replaceName("Na+(aq)").replaceTags({ "aqueous", "charged", "cation"}),
+        Substance("Cl-").replaceName("Cl-(aq)").replaceTags({ "aqueous", "charged", "anion" }),
+        Substance("NaCl").replaceName("NaCl(aq)").replaceTags({ "aqueous", "neutral" }),
+        Substance("CO2").replaceName("CO2(aq)").replaceTags({ "aqueous", "neutral" }),
+        Substance("HCO3-").replaceName("HCO3-(aq)").replaceTags({ "aqueous", "charged", "anion" }),
+        Substance("CO3-2").replaceName("CO3-2(aq)").replaceTags({ "aqueous", "charged", "anion" }),
+        Substance("CH4").replaceName("CH4(aq)").replaceTags({ "aqueous", "neutral" }),
+        Substance("H2O").replaceName("H2O(g)").replaceTags({ "gaseous" }),
+        Substance("CO2").replaceName("CO2(g)").replaceTags({ "gaseous" }),
+        Substance("CH4").replaceName("CH4(g)").replaceTags({ "gaseous" }),
     });
 
     REQUIRE(substances.size() == 15);
@@ -252,4 +252,17 @@ TEST_CASE("Testing Substances", "[Substances]")
 
     REQUIRE_NOTHROW(substances.getWithName("CaCO3(calcite)"));
     REQUIRE_NOTHROW(substances.getWithFormula("CaCO3"));
+
+    // Test method Substances::append with the arguments of a Substance object
+    const auto elements = Substance("MgCO3").elements();
+
+    substances.append({ "MgCO3(magnesite)", SubstanceFormula("MgCO3"), elements, "mineral", { "carbonate" } });
+
+    const auto magnesite = substances.getWithName("MgCO3(magnesite)");
+
+    REQUIRE( magnesite.formula().formula() == "MgCO3" );
+    REQUIRE( magnesite.type() == "mineral" );
+    REQUIRE( magnesite.hasTag("carbonate") );
+    REQUIRE( magnesite.numElements() == 3 );
+    REQUIRE( magnesite.molarMass() == Approx(Substance("MgCO3").molarMass()) );
 }
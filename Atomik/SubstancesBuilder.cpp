@@ -0,0 +1,144 @@
+// Atomik is a library that implements basic chemical concepts such as elements, substances, and reactions.
+//
+// Copyright (C) 2018-2019 Allan Leal and Reaktoro Contributors
+//
+// This library is free software; you can redistribute it and/or
+// modify it under the terms of the GNU Lesser General Public
+// License as published by the Free Software Foundation; either
+// version 2.1 of the License, or (at your option) any later version.
+//
+// This library is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+// Lesser General Public License for more details.
+//
+// You should have received a copy of the GNU Lesser General Public License
+// along with this library. If not, see <http://www.gnu.org/licenses/>.
+
+#include "SubstancesBuilder.hpp"
+
+// C++ includes
+#include <new>
+#include <type_traits>
+#include <thread>
+
+// Atomik includes
+#include <Atomik/Exception.hpp>
+#include <Atomik/SubstanceTable.hpp>
+#include <Atomik/Substances.hpp>
+
+namespace Atomik {
+namespace {
+
+/// Return the index of the segment containing the slot with given index and the position of the slot in it.
+template<std::size_t firstSegmentSize>
+auto locate(std::size_t index) -> std::pair<std::size_t, std::size_t>
+{
+    // Segment k holds the slots in [F*(2^k - 1), F*(2^(k+1) - 1)), with F the size of the first segment
+    const auto shifted = index / firstSegmentSize + 1;
+    std::size_t segment = 0;
+    while(shifted >> (segment + 1))
+        ++segment;
+    const auto offset = index - firstSegmentSize * ((std::size_t(1) << segment) - 1);
+    return { segment, offset };
+}
+
+} // namespace
+
+SubstancesBuilder::SubstancesBuilder()
+: m_size(0)
+{
+    for(auto& segment : m_segments)
+        segment.store(nullptr, std::memory_order_relaxed);
+}
+
+SubstancesBuilder::~SubstancesBuilder()
+{
+    const auto size = m_size.load();
+    for(auto i = 0u; i < size; ++i)
+        const_cast<Substance&>(substance(i)).~Substance();
+    for(auto& segment : m_segments)
+        delete[] segment.load();
+}
+
+auto SubstancesBuilder::append(Substance substance) -> void
+{
+    static_assert(std::is_nothrow_move_constructible_v<Substance>, "A claimed slot must always become ready.");
+
+    // Claim a slot only once its segment exists, so that a full builder or a failed segment
+    // allocation throws without leaving behind a claimed slot that never becomes ready
+    auto index = m_size.load(std::memory_order_relaxed);
+    Slot* slot = nullptr;
+    do slot = &this->slot(index);
+    while(!m_size.compare_exchange_weak(index, index + 1, std::memory_order_relaxed));
+
+    new (slot->storage) Substance(std::move(substance));
+    slot->ready.store(true, std::memory_order_release);
+}
+
+auto SubstancesBuilder::append(Substance::Args&& args) -> void
+{
+    append(Substance(std::move(args)));
+}
+
+auto SubstancesBuilder::size() const -> std::size_t
+{
+    return m_size.load(std::memory_order_relaxed);
+}
+
+auto SubstancesBuilder::seal() const -> Substances
+{
+    const auto size = m_size.load();
+    std::vector<Substance> substances;
+    substances.reserve(size);
+    for(auto i = 0u; i < size; ++i)
+        substances.push_back(substance(i));
+    return Substances(std::move(substances));
+}
+
+auto SubstancesBuilder::sealTable() const -> SubstanceTable
+{
+    const auto size = m_size.load();
+    SubstanceTable table;
+    for(auto i = 0u; i < size; ++i)
+        table.append(substance(i));
+    return table;
+}
+
+auto SubstancesBuilder::slot(std::size_t index) -> Slot&
+{
+    const auto [isegment, offset] = locate<firstSegmentSize>(index);
+    error(isegment >= maxSegments, "Could not append a substance because SubstancesBuilder is full.");
+
+    auto& segment = m_segments[isegment];
+    auto* slots = segment.load(std::memory_order_acquire);
+    if(slots == nullptr)
+    {
+        // Install the new segment under a lock, so that only one thread allocates it
+        std::lock_guard lock(m_installing);
+        slots = segment.load(std::memory_order_acquire);
+        if(slots == nullptr)
+        {
+            slots = new Slot[firstSegmentSize << isegment];
+            segment.store(slots, std::memory_order_release);
+        }
+    }
+    return slots[offset];
+}
+
+auto SubstancesBuilder::substance(std::size_t index) const -> const Substance&
+{
+    const auto [isegment, offset] = locate<firstSegmentSize>(index);
+
+    // The slot was claimed, but its segment or substance may still be under construction in another thread
+    Slot* slots = nullptr;
+    while((slots = m_segments[isegment].load(std::memory_order_acquire)) == nullptr)
+        std::this_thread::yield();
+    auto& slot = slots[offset];
+    while(!slot.ready.load(std::memory_order_acquire))
+        std::this_thread::yield();
+
+    return *std::launder(reinterpret_cast<const Substance*>(slot.storage));
+}
+
+} // namespace Atomik
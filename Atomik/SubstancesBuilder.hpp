@@ -0,0 +1,114 @@
+// Atomik is a library that implements basic chemical concepts such as elements, substances, and reactions.
+//
+// Copyright (C) 2018-2019 Allan Leal and Reaktoro Contributors
+//
+// This library is free software; you can redistribute it and/or
+// modify it under the terms of the GNU Lesser General Public
+// License as published by the Free Software Foundation; either
+// version 2.1 of the License, or (at your option) any later version.
+//
+// This library is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+// Lesser General Public License for more details.
+//
+// You should have received a copy of the GNU Lesser General Public License
+// along with this library. If not, see <http://www.gnu.org/licenses/>.
+
+#pragma once
+
+// C++ includes
+#include <array>
+#include <atomic>
+#include <cstddef>
+#include <mutex>
+
+// Atomik includes
+#include <Atomik/Substance.hpp>
+
+namespace Atomik {
+
+// Forward declarations
+class SubstanceTable;
+class Substances;
+
+/// A type used to collect substances appended concurrently from many threads.
+/// The substances are stored in segments of doubling capacity that are never relocated,
+/// so threads append without waiting for each other, except when one of them installs a
+/// new segment, which happens only a logarithmic number of times. Once all appends
+/// have completed, the builder is sealed into a Substances or SubstanceTable object:
+/// ~~~
+/// using namespace Atomik;
+/// SubstancesBuilder builder;
+/// // in many threads ...
+/// builder.append(Substance(formula));
+/// // after joining the threads ...
+/// Substances substances = builder.seal();
+/// ~~~
+/// The order of the sealed substances is the order in which their appends started.
+class SubstancesBuilder
+{
+public:
+    /// Construct a default SubstancesBuilder object.
+    SubstancesBuilder();
+
+    /// Destroy this SubstancesBuilder object and the substances it contains.
+    ~SubstancesBuilder();
+
+    SubstancesBuilder(const SubstancesBuilder&) = delete;
+
+    auto operator=(const SubstancesBuilder&) -> SubstancesBuilder& = delete;
+
+    /// Append a new substance (thread-safe, and lock-free unless a new segment is needed).
+    /// @throw std::runtime_error When the builder is full.
+    /// @throw std::bad_alloc When a new segment cannot be allocated, in which case the substance is not appended.
+    auto append(Substance substance) -> void;
+
+    /// Append a new substance constructed by taking ownership of given data (thread-safe, and lock-free unless a new segment is needed).
+    auto append(Substance::Args&& args) -> void;
+
+    /// Return the number of substances appended so far (including those still being constructed).
+    auto size() const -> std::size_t;
+
+    /// Return the appended substances as a Substances object.
+    /// This method should be called after all appends have been issued; it waits for those still in progress.
+    auto seal() const -> Substances;
+
+    /// Return the appended substances as a SubstanceTable object.
+    /// This method should be called after all appends have been issued; it waits for those still in progress.
+    auto sealTable() const -> SubstanceTable;
+
+private:
+    /// A slot storing a single substance.
+    struct Slot
+    {
+        /// The storage of the substance, constructed in place.
+        alignas(Substance) unsigned char storage[sizeof(Substance)];
+
+        /// True once the substance in this slot has been fully constructed.
+        std::atomic<bool> ready = false;
+    };
+
+    /// The number of slots in the first segment (each following segment doubles the previous one).
+    static constexpr std::size_t firstSegmentSize = 64;
+
+    /// The maximum number of segments.
+    static constexpr std::size_t maxSegments = 48;
+
+    /// Return the slot with given index, allocating its segment if needed.
+    auto slot(std::size_t index) -> Slot&;
+
+    /// Return the fully constructed substance with given index, waiting for it if needed.
+    auto substance(std::size_t index) const -> const Substance&;
+
+    /// The segments of slots (allocated on demand and never relocated).
+    std::array<std::atomic<Slot*>, maxSegments> m_segments;
+
+    /// The number of slots claimed by appends.
+    std::atomic<std::size_t> m_size;
+
+    /// The mutex serializing the installation of new segments.
+    std::mutex m_installing;
+};
+
+} // namespace Atomik
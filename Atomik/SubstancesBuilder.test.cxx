@@ -0,0 +1,98 @@
+// Atomik is a library that implements basic chemical concepts such as elements, substances, and reactions.
+//
+// Copyright (C) 2018-2019 Allan Leal and Reaktoro Contributors
+//
+// This library is free software; you can redistribute it and/or
+// modify it under the terms of the GNU Lesser General Public
+// License as published by the Free Software Foundation; either
+// version 2.1 of the License, or (at your option) any later version.
+//
+// This library is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+// Lesser General Public License for more details.
+//
+// You should have received a copy of the GNU Lesser General Public License
+// along with this library. If not, see <http://www.gnu.org/licenses/>.
+
+// Catch includes
+#include <catch2/catch.hpp>
+
+// C++ includes
+#include <thread>
+
+// Atomik includes
+#include <Atomik/AllocationCounter.test.hpp>
+#include <Atomik/SubstanceTable.hpp>
+#include <Atomik/Substances.hpp>
+#include <Atomik/SubstancesBuilder.hpp>
+using namespace Atomik;
+
+TEST_CASE("Testing SubstancesBuilder", "[SubstancesBuilder]")
+{
+    const Substances prototypes({ Substance("H2O"), Substance("CO2"), Substance("CaCO3"), Substance("Na+") });
+
+    const auto numThreads = 4;
+    const auto numAppends = 1000; // enough for several segments per builder
+
+    SubstancesBuilder builder;
+
+    std::vector<std::thread> threads;
+    for(auto t = 0; t < numThreads; ++t)
+        threads.emplace_back([&, t]() {
+            for(auto i = 0; i < numAppends; ++i)
+                builder.append(Substance(prototypes[t]).replaceName(prototypes[t].name().str() + "-" + std::to_string(i)));
+        });
+    for(auto& thread : threads)
+        thread.join();
+
+    REQUIRE(builder.size() == numThreads * numAppends);
+
+    const auto substances = builder.seal();
+    REQUIRE(substances.size() == numThreads * numAppends);
+
+    // Test every appended substance is present exactly once
+    for(auto t = 0; t < numThreads; ++t)
+        for(auto i = 0; i < numAppends; i += 97)
+            REQUIRE(std::size_t(substances.indexWithName(prototypes[t].name().str() + "-" + std::to_string(i))) < substances.size());
+
+    std::vector<int> counts(numThreads, 0);
+    for(const auto& substance : substances)
+        for(auto t = 0; t < numThreads; ++t)
+            if(substance.formula() == prototypes[t].formula())
+                ++counts[t];
+    REQUIRE(counts == std::vector<int>(numThreads, numAppends));
+
+    // Test sealing into a columnar table preserves the order of the substances
+    const auto table = builder.sealTable();
+    REQUIRE(table.size() == substances.size());
+    for(auto i = 0u; i < substances.size(); i += 101)
+        REQUIRE(table.name(i) == substances[i].name());
+}
+
+TEST_CASE("Testing SubstancesBuilder when a segment cannot be allocated", "[SubstancesBuilder]")
+{
+    const Substance water("H2O");
+
+    SubstancesBuilder builder;
+
+    // Fill the first segment of 64 slots
+    for(auto i = 0; i < 64; ++i)
+        builder.append(water);
+
+    // Test a failed allocation of the second segment does not leave a claimed slot behind
+    {
+        AllocationFailure failure(64 * sizeof(Substance));
+        REQUIRE_THROWS_AS(builder.append(water), std::bad_alloc);
+    }
+
+    REQUIRE(builder.size() == 64);
+    REQUIRE(builder.seal().size() == 64);
+    REQUIRE(builder.sealTable().size() == 64);
+
+    // Test appends succeed again once the segment can be allocated
+    builder.append(Substance("CO2"));
+
+    REQUIRE(builder.size() == 65);
+    REQUIRE(builder.seal()[64].name() == "CO2");
+}
@@ -0,0 +1,269 @@
+// Atomik is a library that implements basic chemical concepts such as elements, substances, and reactions.
+//
+// Copyright (C) 2018-2019 Allan Leal and Reaktoro Contributors
+//
+// This library is free software; you can redistribute it and/or
+// modify it under the terms of the GNU Lesser General Public
+// License as published by the Free Software Foundation; either
+// version 2.1 of the License, or (at your option) any later version.
+//
+// This library is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+// Lesser General Public License for more details.
+//
+// You should have received a copy of the GNU Lesser General Public License
+// along with this library. If not, see <http://www.gnu.org/licenses/>.
+
+#include "Tracing.hpp"
+
+// C++ includes
+#include <atomic>
+#include <chrono>
+#include <cstdio>
+#include <fstream>
+#include <memory>
+#include <mutex>
+#include <vector>
+
+// Atomik includes
+#include <Atomik/Exception.hpp>
+
+namespace Atomik {
+namespace {
+
+/// The maximum number of spans kept per thread in a trace, beyond which spans are counted as dropped.
+constexpr std::size_t maxThreadEvents = 1 << 16;
+
+/// A span recorded by a thread.
+struct Event
+{
+    const char* name;
+    std::string detail;
+    std::int64_t start;
+    std::int64_t duration;
+};
+
+/// The spans recorded by a thread, shared by the thread and the registry of threads so that
+/// the spans of threads that have finished are still written.
+struct ThreadTrace
+{
+    /// The identifier of the thread in the traces, in order of first use.
+    std::uint64_t tid = 0;
+
+    /// The name of the track of the thread.
+    std::string name;
+
+    /// The spans of the thread in the current trace, in order of completion.
+    std::vector<Event> events;
+
+    /// The number of spans of the thread in the current trace that were dropped after `maxThreadEvents`.
+    std::size_t dropped = 0;
+
+    /// The mutex protecting the name and spans, only contended while a trace is written.
+    std::mutex mutex;
+};
+
+/// The state of the tracing shared by all threads.
+struct Tracer
+{
+    /// The trace being recorded, or zero if none. Incremented by every call to startTracing.
+    std::atomic<std::uint64_t> session = 0;
+
+    /// The number of traces started so far.
+    std::uint64_t sessions = 0;
+
+    /// The number of threads registered so far, so that identifiers are not reused after finished threads are forgotten.
+    std::uint64_t registered = 0;
+
+    /// The start of the current trace in nanoseconds since the epoch of the steady clock.
+    std::atomic<std::int64_t> epoch = 0;
+
+    /// The path of the file of the current trace.
+    std::string path;
+
+    /// The threads that have recorded spans or set their names.
+    std::vector<std::shared_ptr<ThreadTrace>> threads;
+
+    /// The mutex protecting the members above, except `session`.
+    std::mutex mutex;
+};
+
+auto tracer() -> Tracer&
+{
+    static Tracer tracer;
+    return tracer;
+}
+
+/// Return the spans of the calling thread, registering the thread on first use.
+auto threadTrace() -> ThreadTrace&
+{
+    thread_local const auto trace = []()
+    {
+        auto& state = tracer();
+        std::lock_guard lock(state.mutex);
+        auto res = std::make_shared<ThreadTrace>();
+        res->tid = ++state.registered;
+        res->name = res->tid == 1 ? "main" : "thread " + std::to_string(res->tid);
+        state.threads.push_back(res);
+        return res;
+    }();
+    return *trace;
+}
+
+/// Return the nanoseconds since the epoch of the steady clock.
+auto steadyNow() -> std::int64_t
+{
+    const auto elapsed = std::chrono::steady_clock::now().time_since_epoch();
+    return std::chrono::duration_cast<std::chrono::nanoseconds>(elapsed).count();
+}
+
+/// Return the nanoseconds since the start of the current trace.
+auto now() -> std::int64_t
+{
+    return steadyNow() - tracer().epoch.load(std::memory_order_relaxed);
+}
+
+/// Write a string as a JSON string literal.
+auto writeString(std::ostream& out, std::string_view str) -> void
+{
+    out << '"';
+    for(const auto c : str)
+    {
+        if(c == '"' || c == '\\') out << '\\' << c;
+        else if(c == '\n') out << "\\n";
+        else if(static_cast<unsigned char>(c) < 0x20)
+        {
+            char escaped[8];
+            std::snprintf(escaped, sizeof(escaped), "\\u%04x", c);
+            out << escaped;
+        }
+        else out << c;
+    }
+    out << '"';
+}
+
+/// Write a time in nanoseconds as microseconds, the unit of the Chrome trace-event format.
+auto writeMicroseconds(std::ostream& out, std::int64_t ns) -> void
+{
+    char str[32];
+    std::snprintf(str, sizeof(str), "%lld.%03lld", static_cast<long long>(ns / 1000), static_cast<long long>(ns % 1000));
+    out << str;
+}
+
+} // namespace
+
+auto startTracing(const std::string& path) -> void
+{
+    threadTrace(); // register the calling thread first so that its track is the first one
+
+    auto& state = tracer();
+    std::lock_guard lock(state.mutex);
+
+    std::ofstream file(path);
+    error(!file, "Could not create the trace file `", path, "`.");
+
+    for(auto& thread : state.threads)
+    {
+        std::lock_guard threadLock(thread->mutex);
+        thread->events.clear();
+        thread->dropped = 0;
+    }
+
+    state.path = path;
+    state.epoch.store(steadyNow(), std::memory_order_relaxed);
+    state.session.store(++state.sessions, std::memory_order_release);
+}
+
+auto stopTracing() -> void
+{
+    auto& state = tracer();
+    std::lock_guard lock(state.mutex);
+
+    if(state.session.exchange(0, std::memory_order_acq_rel) == 0)
+        return;
+
+    std::ofstream file(state.path);
+    file << "{\"displayTimeUnit\":\"ms\",\"traceEvents\":[\n";
+    file << "{\"ph\":\"M\",\"pid\":1,\"tid\":0,\"name\":\"process_name\",\"args\":{\"name\":\"Atomik\"}}";
+
+    for(auto& thread : state.threads)
+    {
+        std::lock_guard threadLock(thread->mutex);
+
+        file << ",\n{\"ph\":\"M\",\"pid\":1,\"tid\":" << thread->tid << ",\"name\":\"thread_name\",\"args\":{\"name\":";
+        writeString(file, thread->name);
+        file << "}}";
+        file << ",\n{\"ph\":\"M\",\"pid\":1,\"tid\":" << thread->tid << ",\"name\":\"thread_sort_index\",\"args\":{\"sort_index\":" << thread->tid << "}}";
+
+        for(const auto& event : thread->events)
+        {
+            file << ",\n{\"ph\":\"X\",\"pid\":1,\"tid\":" << thread->tid << ",\"name\":";
+            writeString(file, event.name);
+            file << ",\"ts\":";
+            writeMicroseconds(file, event.start);
+            file << ",\"dur\":";
+            writeMicroseconds(file, event.duration);
+            if(!event.detail.empty())
+            {
+                file << ",\"args\":{\"detail\":";
+                writeString(file, event.detail);
+                file << "}";
+            }
+            file << "}";
+        }
+        if(thread->dropped)
+            file << ",\n{\"ph\":\"i\",\"s\":\"t\",\"pid\":1,\"tid\":" << thread->tid << ",\"name\":\"dropped spans\",\"ts\":0,\"args\":{\"count\":" << thread->dropped << "}}";
+        thread->events.clear();
+        thread->events.shrink_to_fit();
+        thread->dropped = 0;
+    }
+
+    file << "\n]}\n";
+    file.flush();
+    error(!file, "Could not write the trace file `", state.path, "`.");
+
+    // Forget the threads that have finished, whose spans are only referenced by the registry
+    std::vector<std::shared_ptr<ThreadTrace>> alive;
+    for(auto& thread : state.threads)
+        if(thread.use_count() > 1)
+            alive.push_back(std::move(thread));
+    state.threads = std::move(alive);
+}
+
+auto tracingActive() -> bool
+{
+    return tracer().session.load(std::memory_order_relaxed) != 0;
+}
+
+auto setTraceThreadName(std::string name) -> void
+{
+    auto& trace = threadTrace();
+    std::lock_guard lock(trace.mutex);
+    trace.name = std::move(name);
+}
+
+TraceSpan::TraceSpan(const char* name, std::string_view detail)
+: m_name(name), m_session(tracer().session.load(std::memory_order_acquire)), m_start(0)
+{
+    if(m_session == 0)
+        return;
+    m_detail = detail;
+    m_start = now();
+}
+
+TraceSpan::~TraceSpan()
+{
+    if(m_session == 0)
+        return;
+    const auto finish = now();
+    auto& trace = threadTrace();
+    std::lock_guard lock(trace.mutex);
+    if(tracer().session.load(std::memory_order_acquire) != m_session) // spans open when tracing stops are dropped
+        return;
+    if(trace.events.size() < maxThreadEvents)
+        trace.events.push_back({ m_name, std::move(m_detail), m_start, finish - m_start });
+    else ++trace.dropped;
+}
+
+} // namespace Atomik
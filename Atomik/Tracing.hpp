@@ -0,0 +1,103 @@
+// Atomik is a library that implements basic chemical concepts such as elements, substances, and reactions.
+//
+// Copyright (C) 2018-2019 Allan Leal and Reaktoro Contributors
+//
+// This library is free software; you can redistribute it and/or
+// modify it under the terms of the GNU Lesser General Public
+// License as published by the Free Software Foundation; either
+// version 2.1 of the License, or (at your option) any later version.
+//
+// This library is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+// Lesser General Public License for more details.
+//
+// You should have received a copy of the GNU Lesser General Public License
+// along with this library. If not, see <http://www.gnu.org/licenses/>.
+
+#pragma once
+
+// C++ includes
+#include <cstdint>
+#include <string>
+#include <string_view>
+
+namespace Atomik {
+
+/// Return true if the library was built with tracing spans (option `ATOMIK_ENABLE_TRACING`).
+/// Without it, the tracing macros compile to nothing and traces contain no spans.
+constexpr auto tracingEnabled() -> bool
+{
+#ifdef ATOMIK_TRACING
+    return true;
+#else
+    return false;
+#endif
+}
+
+/// Start recording tracing spans to be written to a file in the Chrome trace-event format.
+/// The file can be opened with `chrome://tracing` or https://ui.perfetto.dev, which show the
+/// spans of each thread on a separate track. A trace already being recorded is discarded.
+/// @throw std::runtime_error When the file cannot be created.
+auto startTracing(const std::string& path) -> void;
+
+/// Stop recording tracing spans and write them to the file given to startTracing.
+/// Spans still open when tracing stops are not written. Nothing happens if no trace is being recorded.
+/// At most 65536 spans are kept per thread; the number of later spans of a thread is written
+/// as an instant event named `dropped spans` on its track.
+/// @throw std::runtime_error When the file cannot be written.
+auto stopTracing() -> void;
+
+/// Return true if a trace is being recorded.
+auto tracingActive() -> bool;
+
+/// Set the name of the track of the calling thread in the traces (e.g., `ParallelLoader worker`).
+auto setTraceThreadName(std::string name) -> void;
+
+/// A type used to record a tracing span from its construction to its destruction.
+/// Spans are recorded only while a trace is being recorded, and nested spans of a thread
+/// are shown stacked in its track. Use the macro @ref ATOMIK_TRACE instead of this type directly.
+class TraceSpan
+{
+public:
+    /// Construct a TraceSpan object with a name, which must be a string literal, and an optional detail
+    /// (e.g., the path of a loaded file) shown in the arguments of the span.
+    explicit TraceSpan(const char* name, std::string_view detail = {});
+
+    /// Destroy this TraceSpan object and record the span.
+    ~TraceSpan();
+
+    TraceSpan(const TraceSpan&) = delete;
+
+    auto operator=(const TraceSpan&) -> TraceSpan& = delete;
+
+private:
+    /// The name of the span.
+    const char* m_name;
+
+    /// The detail of the span.
+    std::string m_detail;
+
+    /// The trace being recorded when the span started, or zero if none.
+    std::uint64_t m_session;
+
+    /// The start of the span in nanoseconds since the start of the trace.
+    std::int64_t m_start;
+};
+
+} // namespace Atomik
+
+#ifdef ATOMIK_TRACING
+#define ATOMIK_TRACE_CONCAT_IMPL(a, b) a##b
+#define ATOMIK_TRACE_CONCAT(a, b) ATOMIK_TRACE_CONCAT_IMPL(a, b)
+/// Record a tracing span over the rest of the enclosing scope (e.g., `ATOMIK_TRACE("parse YAML")`).
+#define ATOMIK_TRACE(name) const ::Atomik::TraceSpan ATOMIK_TRACE_CONCAT(atomikTraceSpan, __LINE__)(name)
+/// Record a tracing span with a detail over the rest of the enclosing scope (e.g., `ATOMIK_TRACE_DETAIL("loadSubstancesFile", path)`).
+#define ATOMIK_TRACE_DETAIL(name, detail) const ::Atomik::TraceSpan ATOMIK_TRACE_CONCAT(atomikTraceSpan, __LINE__)(name, detail)
+/// Set the name of the track of the calling thread in the traces.
+#define ATOMIK_TRACE_THREAD(name) ::Atomik::setTraceThreadName(name)
+#else
+#define ATOMIK_TRACE(name) ((void)0)
+#define ATOMIK_TRACE_DETAIL(name, detail) ((void)0)
+#define ATOMIK_TRACE_THREAD(name) ((void)0)
+#endif
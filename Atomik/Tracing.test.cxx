@@ -0,0 +1,253 @@
+// Atomik is a library that implements basic chemical concepts such as elements, substances, and reactions.
+//
+// Copyright (C) 2018-2019 Allan Leal and Reaktoro Contributors
+//
+// This library is free software; you can redistribute it and/or
+// modify it under the terms of the GNU Lesser General Public
+// License as published by the Free Software Foundation; either
+// version 2.1 of the License, or (at your option) any later version.
+//
+// This library is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+// Lesser General Public License for more details.
+//
+// You should have received a copy of the GNU Lesser General Public License
+// along with this library. If not, see <http://www.gnu.org/licenses/>.
+
+// Catch includes
+#include <catch2/catch.hpp>
+
+// C++ includes
+#include <algorithm>
+#include <filesystem>
+#include <fstream>
+#include <future>
+#include <set>
+#include <sstream>
+#include <thread>
+
+// Atomik includes
+#include <Atomik/JSON.hpp>
+#include <Atomik/ParallelLoader.hpp>
+#include <Atomik/Serialization.hpp>
+#include <Atomik/StreamingWriter.hpp>
+#include <Atomik/Substances.hpp>
+#include <Atomik/Tracing.hpp>
+using namespace Atomik;
+using Json::json;
+
+namespace {
+
+/// Return the events of a trace file.
+auto readTrace(const std::string& path) -> json
+{
+    std::ifstream file(path);
+    const auto trace = json::parse(file);
+    return trace.at("traceEvents");
+}
+
+/// Return the complete events of a trace with given name.
+auto spansNamed(const json& events, const std::string& name) -> std::vector<json>
+{
+    std::vector<json> res;
+    for(const auto& event : events)
+        if(event.at("ph") == "X" && event.at("name") == name)
+            res.push_back(event);
+    return res;
+}
+
+} // namespace
+
+TEST_CASE("Testing Tracing", "[Tracing]")
+{
+    namespace fs = std::filesystem;
+
+    const auto directory = fs::temp_directory_path() / "Tracing.test";
+    const auto path = (directory / "trace.json").string();
+    fs::remove_all(directory);
+    fs::create_directories(directory);
+
+    SECTION("When recording spans explicitly")
+    {
+        { TraceSpan span("before"); } // not recorded, no trace is being recorded
+
+        REQUIRE_FALSE(tracingActive());
+        startTracing(path);
+        REQUIRE(tracingActive());
+
+        {
+            TraceSpan outer("outer", "a \"quoted\" detail");
+            TraceSpan inner("inner");
+        }
+
+        std::thread([]()
+        {
+            setTraceThreadName("worker");
+            TraceSpan span("work");
+        }).join();
+
+        auto open = std::make_unique<TraceSpan>("open");
+
+        stopTracing();
+        REQUIRE_FALSE(tracingActive());
+        open.reset(); // not recorded, the trace was stopped while the span was open
+
+        stopTracing(); // does nothing
+
+        const auto events = readTrace(path);
+
+        REQUIRE(spansNamed(events, "before").empty());
+        REQUIRE(spansNamed(events, "open").empty());
+
+        const auto outer = spansNamed(events, "outer");
+        const auto inner = spansNamed(events, "inner");
+        const auto work = spansNamed(events, "work");
+        REQUIRE(outer.size() == 1);
+        REQUIRE(inner.size() == 1);
+        REQUIRE(work.size() == 1);
+
+        REQUIRE(outer[0]["args"]["detail"] == "a \"quoted\" detail");
+        REQUIRE(outer[0]["tid"] == inner[0]["tid"]);
+        REQUIRE(outer[0]["ts"].get<double>() <= inner[0]["ts"].get<double>());
+        REQUIRE(outer[0]["dur"].get<double>() >= inner[0]["dur"].get<double>());
+        REQUIRE(work[0]["tid"] != outer[0]["tid"]);
+
+        auto threadName = [&](const json& tid)
+        {
+            for(const auto& event : events)
+                if(event.at("ph") == "M" && event.at("name") == "thread_name" && event.at("tid") == tid)
+                    return event.at("args").at("name").get<std::string>();
+            return std::string();
+        };
+        REQUIRE(threadName(work[0]["tid"]) == "worker");
+        REQUIRE_FALSE(threadName(outer[0]["tid"]).empty());
+
+        // Test a new trace does not contain the spans of the previous one
+        startTracing(path);
+        { TraceSpan span("again"); }
+        stopTracing();
+
+        const auto again = readTrace(path);
+        REQUIRE(spansNamed(again, "again").size() == 1);
+        REQUIRE(spansNamed(again, "outer").empty());
+    }
+
+    SECTION("When threads finish between traces")
+    {
+        std::promise<void> recorded, release;
+        auto released = release.get_future();
+
+        startTracing(path);
+        std::thread([]() { TraceSpan span("finished"); }).join();
+        std::thread alive([&]()
+        {
+            { TraceSpan span("alive"); }
+            recorded.set_value();
+            released.wait();
+            { TraceSpan span("alive"); }
+        });
+        recorded.get_future().wait();
+        stopTracing(); // forgets the finished thread
+
+        const auto finished = spansNamed(readTrace(path), "finished");
+        REQUIRE(finished.size() == 1);
+
+        startTracing(path);
+        std::thread([]() { TraceSpan span("new"); }).join();
+        release.set_value();
+        alive.join();
+        stopTracing();
+
+        // Test the identifier of a new thread is not one of a finished or a running thread
+        const auto events = readTrace(path);
+        const auto added = spansNamed(events, "new");
+        const auto running = spansNamed(events, "alive");
+        REQUIRE(added.size() == 1);
+        REQUIRE(running.size() == 1);
+        REQUIRE(added[0]["tid"] != running[0]["tid"]);
+        REQUIRE(added[0]["tid"] != finished[0]["tid"]);
+    }
+
+    SECTION("When a thread records more spans than are kept")
+    {
+        startTracing(path);
+        for(auto i = 0; i < 70000; ++i)
+            TraceSpan span("many");
+        stopTracing();
+
+        const auto events = readTrace(path);
+        REQUIRE(spansNamed(events, "many").size() == 65536);
+
+        std::vector<json> dropped;
+        for(const auto& event : events)
+            if(event.at("name") == "dropped spans")
+                dropped.push_back(event);
+        REQUIRE(dropped.size() == 1);
+        REQUIRE(dropped[0]["args"]["count"] == 70000 - 65536);
+    }
+
+    SECTION("When the trace file cannot be created")
+    {
+        REQUIRE_THROWS(startTracing((directory / "missing" / "trace.json").string()));
+        REQUIRE_FALSE(tracingActive());
+    }
+
+    SECTION("When tracing the loading of substances")
+    {
+        const Substances substances({ Substance("H2O"), Substance("CO2"), Substance("CaCO3"), Substance("NaCl") });
+        const auto substancesPath = (directory / "substances.yml").string();
+        {
+            std::ofstream out(substancesPath);
+            writeYAML(out, substances);
+        }
+
+        std::ostringstream text;
+        writeYAML(text, substances);
+
+        startTracing(path);
+        const auto loaded = loadSubstancesFile(substancesPath);
+        const auto parallel = parallelLoadSubstancesYAML(text.str(), 2);
+        stopTracing();
+
+        REQUIRE(loaded.size() == 4);
+        REQUIRE(parallel.size() == 4);
+
+        const auto events = readTrace(path);
+
+        if(tracingEnabled())
+        {
+            const auto load = spansNamed(events, "loadSubstancesFile");
+            REQUIRE(load.size() == 1);
+            REQUIRE(load[0]["args"]["detail"] == substancesPath);
+            REQUIRE(spansNamed(events, "parse YAML").size() == 1);
+            const auto convert = spansNamed(events, "convert substances");
+            REQUIRE(convert.size() == 1);
+
+            // Test the stages of the loading are traced, not its records, so that traces of large files stay small
+            REQUIRE(spansNamed(events, "construct Substance").empty());
+
+            // Test the elements are resolved in one span per conversion (the file and each of the two chunks)
+            const auto resolve = spansNamed(events, "resolve elements");
+            REQUIRE(resolve.size() == 3);
+            const auto nested = [&](const json& span)
+            {
+                const auto begin = span["ts"].get<double>();
+                const auto end = begin + span["dur"].get<double>();
+                const auto outerBegin = convert[0]["ts"].get<double>();
+                const auto outerEnd = outerBegin + convert[0]["dur"].get<double>();
+                return span["tid"] == convert[0]["tid"] && outerBegin <= begin && end <= outerEnd;
+            };
+            REQUIRE(std::count_if(resolve.begin(), resolve.end(), nested) == 1);
+
+            // Test the chunks of the parallel loader are parsed on separate tracks
+            std::set<int> tids;
+            for(const auto& span : spansNamed(events, "parse chunk"))
+                tids.insert(span["tid"].get<int>());
+            REQUIRE(tids.size() == 2);
+        }
+        else REQUIRE(spansNamed(events, "loadSubstancesFile").empty());
+    }
+
+    fs::remove_all(directory);
+}
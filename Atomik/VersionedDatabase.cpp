@@ -0,0 +1,157 @@
+// Atomik is a library that implements basic chemical concepts such as elements, substances, and reactions.
+//
+// Copyright (C) 2018-2019 Allan Leal and Reaktoro Contributors
+//
+// This library is free software; you can redistribute it and/or
+// modify it under the terms of the GNU Lesser General Public
+// License as published by the Free Software Foundation; either
+// version 2.1 of the License, or (at your option) any later version.
+//
+// This library is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+// Lesser General Public License for more details.
+//
+// You should have received a copy of the GNU Lesser General Public License
+// along with this library. If not, see <http://www.gnu.org/licenses/>.
+
+#include "VersionedDatabase.hpp"
+
+// C++ includes
+#include <thread>
+#include <utility>
+
+// Atomik includes
+#include <Atomik/DatabaseDelta.hpp>
+
+namespace Atomik {
+namespace {
+
+/// Release a reference to a version of the database, destroying it if it was the last one.
+template<typename Version>
+auto release(Version* version) -> void
+{
+    if(version->references.fetch_sub(1, std::memory_order_acq_rel) == 1)
+        delete version;
+}
+
+} // namespace
+
+VersionedDatabase::Snapshot::Snapshot(Version* version)
+: m_version(version)
+{}
+
+VersionedDatabase::Snapshot::Snapshot(const Snapshot& other)
+: m_version(other.m_version)
+{
+    if(m_version)
+        m_version->references.fetch_add(1, std::memory_order_relaxed);
+}
+
+VersionedDatabase::Snapshot::Snapshot(Snapshot&& other) noexcept
+: m_version(other.m_version)
+{
+    other.m_version = nullptr;
+}
+
+VersionedDatabase::Snapshot::~Snapshot()
+{
+    if(m_version)
+        release(m_version);
+}
+
+auto VersionedDatabase::Snapshot::operator=(Snapshot other) noexcept -> Snapshot&
+{
+    std::swap(m_version, other.m_version);
+    return *this;
+}
+
+VersionedDatabase::VersionedDatabase()
+: VersionedDatabase(Database())
+{}
+
+VersionedDatabase::VersionedDatabase(Database database)
+: m_current(new Version{ std::move(database), 0, 1 }), m_readers{ 0, 0 }, m_phase(0)
+{}
+
+VersionedDatabase::~VersionedDatabase()
+{
+    release(m_current.load());
+}
+
+auto VersionedDatabase::snapshot() const -> Snapshot
+{
+    // Register as a reader in the current phase so that writers do not destroy
+    // the current version between loading it and incrementing its references.
+    while(true)
+    {
+        const auto phase = m_phase.load();
+        m_readers[phase].fetch_add(1);
+        if(m_phase.load() == phase)
+        {
+            auto* version = m_current.load();
+            version->references.fetch_add(1, std::memory_order_relaxed);
+            m_readers[phase].fetch_sub(1, std::memory_order_release);
+            return Snapshot(version);
+        }
+        m_readers[phase].fetch_sub(1, std::memory_order_release); // a writer has flipped the phase meanwhile
+    }
+}
+
+auto VersionedDatabase::version() const -> std::uint64_t
+{
+    return snapshot().version();
+}
+
+auto VersionedDatabase::publish(Database database) -> std::uint64_t
+{
+    std::lock_guard lock(m_writer);
+    return publishLocked(std::move(database));
+}
+
+auto VersionedDatabase::update(const std::function<Database(const Database&)>& function) -> std::uint64_t
+{
+    std::lock_guard lock(m_writer);
+    return publishLocked(function(m_current.load()->database));
+}
+
+auto VersionedDatabase::append(const Substances& substances) -> std::uint64_t
+{
+    return update([&](const Database& database)
+    {
+        auto data = database.substances();
+        for(const auto& substance : substances)
+            data.append(substance);
+        return Database(database.elements(), std::move(data));
+    });
+}
+
+auto VersionedDatabase::apply(const DatabaseDelta& delta) -> std::uint64_t
+{
+    return update([&](const Database& database)
+    {
+        auto next = database;
+        next.apply(delta);
+        return next;
+    });
+}
+
+auto VersionedDatabase::publishLocked(Database database) -> std::uint64_t
+{
+    auto* previous = m_current.load();
+    const auto number = previous->number + 1;
+    m_current.store(new Version{ std::move(database), number, 1 });
+
+    // Readers registering from now on see the new version. Wait for those registered in the
+    // previous phase, which may still be about to take a reference to the previous version.
+    const auto phase = m_phase.load();
+    m_phase.store(1 - phase);
+    while(m_readers[phase].load() != 0)
+        std::this_thread::yield();
+
+    release(previous);
+
+    return number;
+}
+
+} // namespace Atomik
@@ -0,0 +1,153 @@
+// Atomik is a library that implements basic chemical concepts such as elements, substances, and reactions.
+//
+// Copyright (C) 2018-2019 Allan Leal and Reaktoro Contributors
+//
+// This library is free software; you can redistribute it and/or
+// modify it under the terms of the GNU Lesser General Public
+// License as published by the Free Software Foundation; either
+// version 2.1 of the License, or (at your option) any later version.
+//
+// This library is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+// Lesser General Public License for more details.
+//
+// You should have received a copy of the GNU Lesser General Public License
+// along with this library. If not, see <http://www.gnu.org/licenses/>.
+
+#pragma once
+
+// C++ includes
+#include <atomic>
+#include <cstdint>
+#include <functional>
+#include <mutex>
+
+// Atomik includes
+#include <Atomik/Database.hpp>
+
+namespace Atomik {
+
+/// A type used to publish successive versions of a Database object to concurrent readers.
+/// Readers obtain a Snapshot, an immutable view of the latest published version together with its
+/// indexes, without ever taking a lock. Writers build a new Database object and publish it atomically;
+/// snapshots taken earlier keep their version alive and unchanged until they are destroyed:
+/// ~~~
+/// using namespace Atomik;
+/// VersionedDatabase versioned(Database(Elements::PeriodicTable(), substances));
+/// // in any reader thread ...
+/// auto snapshot = versioned.snapshot();
+/// for(SubstanceId id : snapshot->substancesWithTag("aqueous"))
+///     total += snapshot->substance(id).molarMass();
+/// // in the writer thread ...
+/// versioned.append(Substances({ Substance("CH4").replaceName("CH4(g)") }));
+/// ~~~
+/// Handles obtained from a snapshot remain valid for that snapshot only.
+class VersionedDatabase
+{
+    /// A published version of the database, shared by reference counting.
+    struct Version
+    {
+        /// The database of this version.
+        const Database database;
+
+        /// The number of this version (starting at zero).
+        const std::uint64_t number;
+
+        /// The number of references to this version (one from VersionedDatabase while current, one per Snapshot).
+        std::atomic<std::size_t> references;
+    };
+
+public:
+    /// A type used as an immutable view of a published version of the database.
+    class Snapshot
+    {
+    public:
+        /// Construct a copy of a Snapshot object (referring to the same version).
+        Snapshot(const Snapshot& other);
+
+        /// Construct a Snapshot object by taking over the version of another one.
+        Snapshot(Snapshot&& other) noexcept;
+
+        /// Destroy this Snapshot object, releasing its version when no longer referenced.
+        ~Snapshot();
+
+        /// Assign another Snapshot object to this one.
+        auto operator=(Snapshot other) noexcept -> Snapshot&;
+
+        /// Return the database of this snapshot.
+        auto database() const -> const Database& { return m_version->database; }
+
+        /// Return the number of the version of this snapshot.
+        auto version() const -> std::uint64_t { return m_version->number; }
+
+        /// Return the database of this snapshot.
+        auto operator*() const -> const Database& { return m_version->database; }
+
+        /// Return the database of this snapshot.
+        auto operator->() const -> const Database* { return &m_version->database; }
+
+    private:
+        /// Construct a Snapshot object that takes over an existing reference to a version.
+        explicit Snapshot(Version* version);
+
+        /// The referenced version of the database.
+        Version* m_version;
+
+        friend class VersionedDatabase;
+    };
+
+    /// Construct a VersionedDatabase object with an empty database.
+    VersionedDatabase();
+
+    /// Construct a VersionedDatabase object with a given initial database.
+    explicit VersionedDatabase(Database database);
+
+    /// Destroy this VersionedDatabase object (outstanding snapshots remain valid).
+    ~VersionedDatabase();
+
+    VersionedDatabase(const VersionedDatabase&) = delete;
+
+    auto operator=(const VersionedDatabase&) -> VersionedDatabase& = delete;
+
+    /// Return a snapshot of the latest published version of the database.
+    /// This method never blocks, and can be called concurrently with any other method.
+    auto snapshot() const -> Snapshot;
+
+    /// Return the number of the latest published version of the database.
+    auto version() const -> std::uint64_t;
+
+    /// Publish a new version of the database and return its number.
+    /// Concurrent writers are serialized, and readers are never blocked.
+    auto publish(Database database) -> std::uint64_t;
+
+    /// Publish a new version of the database produced from the latest one and return its number.
+    /// The function is invoked while other writers are excluded, so no update is lost.
+    auto update(const std::function<Database(const Database&)>& function) -> std::uint64_t;
+
+    /// Publish a new version of the database with given substances appended and return its number.
+    auto append(const Substances& substances) -> std::uint64_t;
+
+    /// Publish a new version of the database with the changes of a delta applied and return its number.
+    /// The latest version is copied and the delta applied to the copy, so snapshots in use are not affected.
+    /// @throw std::runtime_error When the delta cannot be applied (see `Database::apply`).
+    auto apply(const DatabaseDelta& delta) -> std::uint64_t;
+
+private:
+    /// Publish a new version of the database while holding the writer mutex.
+    auto publishLocked(Database database) -> std::uint64_t;
+
+    /// The latest published version of the database.
+    std::atomic<Version*> m_current;
+
+    /// The number of readers currently acquiring a version, for each of the two reader phases.
+    mutable std::atomic<std::size_t> m_readers[2];
+
+    /// The phase in which new readers register while acquiring a version.
+    mutable std::atomic<unsigned> m_phase;
+
+    /// The mutex serializing the writers.
+    std::mutex m_writer;
+};
+
+} // namespace Atomik
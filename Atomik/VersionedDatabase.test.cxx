@@ -0,0 +1,91 @@
+// Atomik is a library that implements basic chemical concepts such as elements, substances, and reactions.
+//
+// Copyright (C) 2018-2019 Allan Leal and Reaktoro Contributors
+//
+// This library is free software; you can redistribute it and/or
+// modify it under the terms of the GNU Lesser General Public
+// License as published by the Free Software Foundation; either
+// version 2.1 of the License, or (at your option) any later version.
+//
+// This library is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+// Lesser General Public License for more details.
+//
+// You should have received a copy of the GNU Lesser General Public License
+// along with this library. If not, see <http://www.gnu.org/licenses/>.
+
+// Catch includes
+#include <catch2/catch.hpp>
+
+// C++ includes
+#include <atomic>
+#include <thread>
+
+// Atomik includes
+#include <Atomik/VersionedDatabase.hpp>
+using namespace Atomik;
+
+TEST_CASE("Testing VersionedDatabase", "[VersionedDatabase]")
+{
+    Substances substances({
+        Substance("H2O").replaceName("H2O(aq)").replaceTags({"aqueous"}),
+        Substance("CO2").replaceName("CO2(g)").replaceTags({"gaseous"}),
+    });
+
+    VersionedDatabase versioned(Database(Elements::PeriodicTable(), substances));
+
+    auto first = versioned.snapshot();
+    REQUIRE(first.version() == 0);
+    REQUIRE(first->substances().size() == 2);
+
+    // Test publishing keeps earlier snapshots unchanged
+    REQUIRE(versioned.append(Substances({ Substance("CH4").replaceName("CH4(g)").replaceTags({"gaseous"}) })) == 1);
+
+    auto second = versioned.snapshot();
+    REQUIRE(versioned.version() == 1);
+    REQUIRE(second.version() == 1);
+    REQUIRE(second->substances().size() == 3);
+    REQUIRE(second->substancesWithTag("gaseous").size() == 2);
+    REQUIRE(second->hasSubstance("CH4(g)"));
+
+    REQUIRE(first->substances().size() == 2);
+    REQUIRE(first->substancesWithTag("gaseous").size() == 1);
+    REQUIRE_FALSE(first->hasSubstance("CH4(g)"));
+
+    // Test snapshots outlive the versioned database
+    auto copy = second;
+    {
+        VersionedDatabase other(second.database());
+        copy = other.snapshot();
+    }
+    REQUIRE(copy->substances().size() == 3);
+
+    // Test concurrent readers while a writer publishes new versions
+    std::atomic<bool> done = false;
+    std::atomic<bool> consistent = true;
+    std::vector<std::thread> readers;
+    for(auto i = 0; i < 4; ++i)
+        readers.emplace_back([&]() {
+            while(!done)
+            {
+                const auto snapshot = versioned.snapshot();
+                const auto& db = snapshot.database();
+                if(db.substances().size() != snapshot.version() + 2)
+                    consistent = false;
+                if(db.substancesWithTag("gaseous").size() != snapshot.version() + 1)
+                    consistent = false;
+            }
+        });
+
+    for(auto i = 0; i < 50; ++i)
+        versioned.append(Substances({ Substance("CH4").replaceName("CH4(g)" + std::to_string(i)).replaceTags({"gaseous"}) }));
+
+    done = true;
+    for(auto& reader : readers)
+        reader.join();
+
+    REQUIRE(consistent);
+    REQUIRE(versioned.version() == 51);
+    REQUIRE(versioned.snapshot()->substances().size() == 53);
+}
@@ -22,19 +22,22 @@
 
 // Atomik includes
 #include <Atomik/Algorithms.hpp>
+#include <Atomik/InternedString.hpp>
 
 namespace Atomik {
 
 /// Return a function that checks whether an item has a given name.
+/// The name is looked up in the string pool once so that each item is checked in constant time.
 inline auto withName(const std::string& name)
 {
-    return [&](auto&& item) { return item.name() == name; };
+    return [name = InternedString::find(name)](auto&& item) { return item.name() == name; };
 }
 
 /// Return a function that checks whether an item has a given symbol.
+/// The symbol is looked up in the string pool once so that each item is checked in constant time.
 inline auto withSymbol(const std::string& symbol)
 {
-    return [&](auto&& item) { return item.symbol() == symbol; };
+    return [symbol = InternedString::find(symbol)](auto&& item) { return item.symbol() == symbol; };
 }
 
 /// Return a function that checks whether an item has given symbols.
@@ -52,13 +55,16 @@ inline auto withFormula(const std::string& formula)
 /// Return a function that checks whether an item has a given tag.
 inline auto withTag(const std::string& tag)
 {
-    return [&](auto&& item) { return contains(item.tags(), tag); };
+    return [tag = InternedString::find(tag)](auto&& item) { return contains(item.tags(), tag); };
 }
 
 /// Return a function that checks whether an item has given tags.
 inline auto withTags(const std::vector<std::string>& tags)
 {
-    return [&](auto&& item) { return contained(tags, item.tags()); };
+    std::vector<InternedString> atoms;
+    for(const auto& tag : tags)
+        atoms.push_back(InternedString::find(tag));
+    return [atoms = std::move(atoms)](auto&& item) { return contained(atoms, item.tags()); };
 }
 
 } // namespace Atomik
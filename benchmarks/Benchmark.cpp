@@ -0,0 +1,67 @@
+// Atomik is a library that implements basic chemical concepts such as elements, substances, and reactions.
+//
+// Copyright (C) 2018-2019 Allan Leal and Reaktoro Contributors
+//
+// This library is free software; you can redistribute it and/or
+// modify it under the terms of the GNU Lesser General Public
+// License as published by the Free Software Foundation; either
+// version 2.1 of the License, or (at your option) any later version.
+//
+// This library is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+// Lesser General Public License for more details.
+//
+// You should have received a copy of the GNU Lesser General Public License
+// along with this library. If not, see <http://www.gnu.org/licenses/>.
+
+#include "Benchmark.hpp"
+
+// Atomik includes
+#include <Atomik/Substance.hpp>
+#include <Atomik/Substances.hpp>
+
+namespace Atomik {
+
+BenchmarkRegistration::BenchmarkRegistration(std::string name, std::function<void()> function)
+{
+    registeredBenchmarks().push_back({ std::move(name), std::move(function) });
+}
+
+auto registeredBenchmarks() -> std::vector<Benchmark>&
+{
+    static std::vector<Benchmark> benchmarks;
+    return benchmarks;
+}
+
+auto benchmarkFormulas() -> const std::vector<std::string>&
+{
+    static const std::vector<std::string> formulas = {
+        "H2O", "CO2", "H+", "OH-", "HCO3-", "CO3-2", "CaCO3", "NaCl", "Fe+++", "MgCO3",
+        "(CaMg)(CO3)2", "Fe3Al2Si3O12", "CaSO4.2H2O", "KAl3Si3O10(OH)2", "(NH4)2Fe(SO4)2.6H2O",
+    };
+    return formulas;
+}
+
+auto benchmarkSubstances() -> const Substances&
+{
+    static const Substances substances = []()
+    {
+        const std::vector<std::string> tags = { "aqueous", "gaseous", "mineral", "organic", "charged", "neutral" };
+        std::vector<Substance> res;
+        for(auto i = 0u; i < 200; ++i)
+        {
+            for(auto j = 0u; j < benchmarkFormulas().size(); ++j)
+            {
+                const auto& formula = benchmarkFormulas()[j];
+                res.push_back(Substance(formula)
+                    .replaceName(formula + "-" + std::to_string(i))
+                    .replaceTags({ tags[(i + j) % tags.size()], tags[(i * j) % tags.size()] }));
+            }
+        }
+        return Substances(std::move(res));
+    }();
+    return substances;
+}
+
+} // namespace Atomik
@@ -0,0 +1,77 @@
+// Atomik is a library that implements basic chemical concepts such as elements, substances, and reactions.
+//
+// Copyright (C) 2018-2019 Allan Leal and Reaktoro Contributors
+//
+// This library is free software; you can redistribute it and/or
+// modify it under the terms of the GNU Lesser General Public
+// License as published by the Free Software Foundation; either
+// version 2.1 of the License, or (at your option) any later version.
+//
+// This library is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+// Lesser General Public License for more details.
+//
+// You should have received a copy of the GNU Lesser General Public License
+// along with this library. If not, see <http://www.gnu.org/licenses/>.
+
+#pragma once
+
+// C++ includes
+#include <cstddef>
+#include <functional>
+#include <string>
+#include <vector>
+
+namespace Atomik {
+
+// Forward declarations
+class Substances;
+
+/// A type used to register a microbenchmark, a function timed by the `benchmarks` application.
+/// Benchmarks are registered by defining static objects of this type in the benchmark files:
+/// ~~~
+/// const BenchmarkRegistration parseWater("parseChemicalFormula/H2O", []() {
+///     doNotOptimize(parseChemicalFormula("H2O"));
+/// });
+/// ~~~
+/// The name is used to select benchmarks on the command line and to match them against a baseline,
+/// so it should not change once results have been stored.
+struct BenchmarkRegistration
+{
+    /// Register a benchmark with given name and function, which is called once per timed iteration.
+    BenchmarkRegistration(std::string name, std::function<void()> function);
+};
+
+/// A type used to describe a registered benchmark.
+struct Benchmark
+{
+    /// The name of the benchmark.
+    std::string name;
+
+    /// The function timed by the benchmark.
+    std::function<void()> function;
+};
+
+/// Return the registered benchmarks in order of registration.
+auto registeredBenchmarks() -> std::vector<Benchmark>&;
+
+/// Return the chemical formulas used as inputs by the benchmarks, from simple to complex.
+auto benchmarkFormulas() -> const std::vector<std::string>&;
+
+/// Return the substances used as inputs by the benchmarks, with a few thousand entries with tags.
+auto benchmarkSubstances() -> const Substances&;
+
+/// Prevent the compiler from optimizing away the computation of a value.
+template<typename T>
+inline auto doNotOptimize(const T& value) -> void
+{
+#if defined(__GNUC__) || defined(__clang__)
+    asm volatile("" : : "r"(&value) : "memory");
+#else
+    static const void* volatile sink;
+    sink = &value;
+#endif
+}
+
+} // namespace Atomik
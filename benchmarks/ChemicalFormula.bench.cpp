@@ -0,0 +1,48 @@
+// Atomik is a library that implements basic chemical concepts such as elements, substances, and reactions.
+//
+// Copyright (C) 2018-2019 Allan Leal and Reaktoro Contributors
+//
+// This library is free software; you can redistribute it and/or
+// modify it under the terms of the GNU Lesser General Public
+// License as published by the Free Software Foundation; either
+// version 2.1 of the License, or (at your option) any later version.
+//
+// This library is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+// Lesser General Public License for more details.
+//
+// You should have received a copy of the GNU Lesser General Public License
+// along with this library. If not, see <http://www.gnu.org/licenses/>.
+
+// Atomik includes
+#include <Atomik/ChemicalFormula.hpp>
+#include "Benchmark.hpp"
+
+namespace Atomik {
+namespace {
+
+const BenchmarkRegistration parseSimpleFormula("parseChemicalFormula/H2O", []() {
+    doNotOptimize(parseChemicalFormula(benchmarkFormulas().front()));
+});
+
+const BenchmarkRegistration parseComplexFormula("parseChemicalFormula/(NH4)2Fe(SO4)2.6H2O", []() {
+    doNotOptimize(parseChemicalFormula(benchmarkFormulas().back()));
+});
+
+const BenchmarkRegistration parseFormulas("parseChemicalFormula/mixed", []() {
+    for(const auto& formula : benchmarkFormulas())
+        doNotOptimize(parseChemicalFormula(formula));
+});
+
+const BenchmarkRegistration parseFormulasIntoTerms("parseChemicalFormula/mixed-terms", []() {
+    FormulaTerms terms;
+    for(const auto& formula : benchmarkFormulas())
+    {
+        parseChemicalFormula(formula, terms);
+        doNotOptimize(terms);
+    }
+});
+
+} // namespace
+} // namespace Atomik
@@ -0,0 +1,46 @@
+// Atomik is a library that implements basic chemical concepts such as elements, substances, and reactions.
+//
+// Copyright (C) 2018-2019 Allan Leal and Reaktoro Contributors
+//
+// This library is free software; you can redistribute it and/or
+// modify it under the terms of the GNU Lesser General Public
+// License as published by the Free Software Foundation; either
+// version 2.1 of the License, or (at your option) any later version.
+//
+// This library is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+// Lesser General Public License for more details.
+//
+// You should have received a copy of the GNU Lesser General Public License
+// along with this library. If not, see <http://www.gnu.org/licenses/>.
+
+// Atomik includes
+#include <Atomik/Elements.hpp>
+#include "Benchmark.hpp"
+
+namespace Atomik {
+namespace {
+
+/// Return the elements of the periodic table.
+auto periodicTable() -> const Elements&
+{
+    static const Elements elements = Elements::PeriodicTable();
+    return elements;
+}
+
+const BenchmarkRegistration getFirstElement("Elements/getWithSymbol/H", []() {
+    doNotOptimize(periodicTable().getWithSymbol("H"));
+});
+
+const BenchmarkRegistration getLastElement("Elements/getWithSymbol/Og", []() {
+    doNotOptimize(periodicTable().getWithSymbol("Og"));
+});
+
+const BenchmarkRegistration getElements("Elements/getWithSymbol/mixed", []() {
+    for(auto symbol : { "H", "O", "C", "Ca", "Na", "Cl", "Fe", "Si", "Al", "U" })
+        doNotOptimize(periodicTable().getWithSymbol(symbol));
+});
+
+} // namespace
+} // namespace Atomik
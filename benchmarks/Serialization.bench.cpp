@@ -0,0 +1,50 @@
+// Atomik is a library that implements basic chemical concepts such as elements, substances, and reactions.
+//
+// Copyright (C) 2018-2019 Allan Leal and Reaktoro Contributors
+//
+// This library is free software; you can redistribute it and/or
+// modify it under the terms of the GNU Lesser General Public
+// License as published by the Free Software Foundation; either
+// version 2.1 of the License, or (at your option) any later version.
+//
+// This library is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+// Lesser General Public License for more details.
+//
+// You should have received a copy of the GNU Lesser General Public License
+// along with this library. If not, see <http://www.gnu.org/licenses/>.
+
+// C++ includes
+#include <sstream>
+
+// Atomik includes
+#include <Atomik/Serialization.hpp>
+#include <Atomik/Substances.hpp>
+#include "Benchmark.hpp"
+
+namespace Atomik {
+namespace {
+
+/// Return the first substances of the benchmark substances, for round trips of moderate size.
+auto roundTripSubstances() -> const Substances&
+{
+    static const Substances substances(std::vector<Substance>(benchmarkSubstances().begin(), benchmarkSubstances().begin() + 300));
+    return substances;
+}
+
+const BenchmarkRegistration roundTripYAML("Serialization/YAML/round-trip", []() {
+    YAML::Node node;
+    node << roundTripSubstances();
+    std::stringstream ss;
+    ss << node;
+    doNotOptimize(YAML::Load(ss.str()).as<Substances>());
+});
+
+const BenchmarkRegistration roundTripJSON("Serialization/JSON/round-trip", []() {
+    const json j = roundTripSubstances();
+    doNotOptimize(json::parse(j.dump()).get<Substances>());
+});
+
+} // namespace
+} // namespace Atomik
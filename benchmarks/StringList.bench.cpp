@@ -0,0 +1,38 @@
+// Atomik is a library that implements basic chemical concepts such as elements, substances, and reactions.
+//
+// Copyright (C) 2018-2019 Allan Leal and Reaktoro Contributors
+//
+// This library is free software; you can redistribute it and/or
+// modify it under the terms of the GNU Lesser General Public
+// License as published by the Free Software Foundation; either
+// version 2.1 of the License, or (at your option) any later version.
+//
+// This library is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+// Lesser General Public License for more details.
+//
+// You should have received a copy of the GNU Lesser General Public License
+// along with this library. If not, see <http://www.gnu.org/licenses/>.
+
+// Atomik includes
+#include <Atomik/StringList.hpp>
+#include "Benchmark.hpp"
+
+namespace Atomik {
+namespace {
+
+const BenchmarkRegistration tokenizeShortList("StringList/tokenize/short", []() {
+    doNotOptimize(StringList("H O C Z"));
+});
+
+const BenchmarkRegistration tokenizeLongList("StringList/tokenize/long", []() {
+    doNotOptimize(StringList("H2O(aq) H+(aq) OH-(aq) CO2(aq) HCO3-(aq) CO3-2(aq) Ca+2(aq) CaCO3(aq) Na+(aq) Cl-(aq) NaCl(aq) Calcite Halite Dolomite"));
+});
+
+const BenchmarkRegistration tokenizeWithToken("StringList/tokenize/token", []() {
+    doNotOptimize(StringList("aqueous,gaseous,mineral,organic,charged,neutral", ','));
+});
+
+} // namespace
+} // namespace Atomik
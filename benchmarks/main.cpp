@@ -0,0 +1,266 @@
+// Atomik is a library that implements basic chemical concepts such as elements, substances, and reactions.
+//
+// Copyright (C) 2018-2019 Allan Leal and Reaktoro Contributors
+//
+// This library is free software; you can redistribute it and/or
+// modify it under the terms of the GNU Lesser General Public
+// License as published by the Free Software Foundation; either
+// version 2.1 of the License, or (at your option) any later version.
+//
+// This library is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+// Lesser General Public License for more details.
+//
+// You should have received a copy of the GNU Lesser General Public License
+// along with this library. If not, see <http://www.gnu.org/licenses/>.
+
+// C++ includes
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <cstdio>
+#include <fstream>
+#include <iostream>
+#include <numeric>
+#include <unordered_map>
+
+// Atomik includes
+#include <Atomik/JSON.hpp>
+#include "Benchmark.hpp"
+using namespace Atomik;
+using Json::json;
+
+namespace {
+
+const auto usage = R"(Usage: benchmarks [options]
+
+Run the microbenchmarks of Atomik and print their results as JSON.
+
+Options:
+  --help              Print this message and exit.
+  --list              List the names of the benchmarks and exit.
+  --filter TEXT       Run only the benchmarks whose names contain TEXT.
+  --samples N         Time each benchmark N times (default: 10).
+  --min-time MS       Repeat each benchmark for at least MS milliseconds per sample (default: 10).
+  --output FILE       Write the JSON results to FILE instead of the standard output.
+  --baseline FILE     Compare the results against those stored in FILE by a previous run.
+  --threshold X       Flag benchmarks whose median time grew by more than the fraction X
+                      of the baseline as regressions (default: 0.10).
+
+The exit status is 1 if a regression was flagged, 2 on invalid usage, and 0 otherwise.
+)";
+
+/// The options of the benchmarking application.
+struct Options
+{
+    bool help = false;
+    bool list = false;
+    std::string filter;
+    std::size_t samples = 10;
+    double minTime = 10.0;
+    std::string output;
+    std::string baseline;
+    double threshold = 0.10;
+};
+
+/// The timings of a benchmark.
+struct Result
+{
+    std::string name;
+    std::size_t iterations = 0;
+    double median = 0.0;
+    double mean = 0.0;
+    double min = 0.0;
+    double stddev = 0.0;
+};
+
+/// Return the options parsed from the command line arguments.
+auto parseOptions(int argc, char** argv) -> Options
+{
+    Options options;
+    for(int i = 1; i < argc; ++i)
+    {
+        const std::string arg = argv[i];
+        auto value = [&]() -> std::string
+        {
+            if(i + 1 == argc) throw std::invalid_argument("missing value of option " + arg);
+            return argv[++i];
+        };
+        if(arg == "--help") options.help = true;
+        else if(arg == "--list") options.list = true;
+        else if(arg == "--filter") options.filter = value();
+        else if(arg == "--samples") options.samples = std::max(1, std::stoi(value()));
+        else if(arg == "--min-time") options.minTime = std::stod(value());
+        else if(arg == "--output") options.output = value();
+        else if(arg == "--baseline") options.baseline = value();
+        else if(arg == "--threshold") options.threshold = std::stod(value());
+        else throw std::invalid_argument("unknown option " + arg);
+    }
+    return options;
+}
+
+/// Return the time in nanoseconds taken to call a function a number of times.
+auto measure(const std::function<void()>& function, std::size_t iterations) -> double
+{
+    const auto start = std::chrono::steady_clock::now();
+    for(std::size_t i = 0; i < iterations; ++i)
+        function();
+    const auto finish = std::chrono::steady_clock::now();
+    return std::chrono::duration<double, std::nano>(finish - start).count();
+}
+
+/// Return the timings of a benchmark.
+/// The number of iterations per sample is doubled until a sample takes at least the minimum time.
+auto run(const Benchmark& benchmark, const Options& options) -> Result
+{
+    const auto minTime = options.minTime * 1e6;
+
+    std::size_t iterations = 1;
+    while(measure(benchmark.function, iterations) < minTime && iterations < (std::size_t(1) << 40))
+        iterations *= 2;
+
+    std::vector<double> samples(options.samples);
+    for(auto& sample : samples)
+        sample = measure(benchmark.function, iterations) / iterations;
+
+    std::sort(samples.begin(), samples.end());
+
+    Result res;
+    res.name = benchmark.name;
+    res.iterations = iterations;
+    res.median = samples.size() % 2 ? samples[samples.size() / 2] : 0.5 * (samples[samples.size() / 2 - 1] + samples[samples.size() / 2]);
+    res.mean = std::accumulate(samples.begin(), samples.end(), 0.0) / samples.size();
+    res.min = samples.front();
+    for(auto sample : samples)
+        res.stddev += (sample - res.mean) * (sample - res.mean);
+    res.stddev = std::sqrt(res.stddev / samples.size());
+    return res;
+}
+
+/// Return the median times in nanoseconds of the benchmarks in a file of stored results.
+auto readBaseline(const std::string& path) -> std::unordered_map<std::string, double>
+{
+    std::ifstream file(path);
+    if(!file) throw std::runtime_error("could not open the baseline file " + path);
+    const auto results = json::parse(file);
+    std::unordered_map<std::string, double> res;
+    for(const auto& benchmark : results.at("benchmarks"))
+        res[benchmark.at("name").get<std::string>()] = benchmark.at("medianNs").get<double>();
+    return res;
+}
+
+} // namespace
+
+int main(int argc, char** argv)
+{
+    Options options;
+    try { options = parseOptions(argc, argv); }
+    catch(const std::exception& e)
+    {
+        std::cerr << "benchmarks: " << e.what() << "\n\n" << usage;
+        return 2;
+    }
+
+    if(options.help)
+    {
+        std::cout << usage;
+        return 0;
+    }
+
+    std::vector<Benchmark> selected;
+    for(const auto& benchmark : registeredBenchmarks())
+        if(benchmark.name.find(options.filter) != std::string::npos)
+            selected.push_back(benchmark);
+
+    if(options.list)
+    {
+        for(const auto& benchmark : selected)
+            std::cout << benchmark.name << '\n';
+        return 0;
+    }
+
+    std::unordered_map<std::string, double> baseline;
+    if(!options.baseline.empty())
+    {
+        try { baseline = readBaseline(options.baseline); }
+        catch(const std::exception& e)
+        {
+            std::cerr << "benchmarks: " << e.what() << '\n';
+            return 2;
+        }
+    }
+
+    json results = json::array();
+    auto regressions = 0;
+
+    for(const auto& benchmark : selected)
+    {
+        const auto res = run(benchmark, options);
+
+        json entry = {
+            { "name", res.name },
+            { "iterations", res.iterations },
+            { "medianNs", res.median },
+            { "meanNs", res.mean },
+            { "minNs", res.min },
+            { "stddevNs", res.stddev },
+        };
+
+        char line[256];
+        std::snprintf(line, sizeof(line), "%-48s %14.1f ns", res.name.c_str(), res.median);
+        std::cerr << line;
+
+        if(!options.baseline.empty())
+        {
+            const auto i = baseline.find(res.name);
+            if(i == baseline.end())
+            {
+                entry["status"] = "new";
+                std::cerr << "  (new)";
+            }
+            else
+            {
+                const auto ratio = res.median / i->second;
+                const auto status = ratio > 1.0 + options.threshold ? "regression" : ratio < 1.0 - options.threshold ? "improvement" : "unchanged";
+                entry["baselineNs"] = i->second;
+                entry["ratio"] = ratio;
+                entry["status"] = status;
+                regressions += ratio > 1.0 + options.threshold;
+                std::snprintf(line, sizeof(line), "  %6.2fx  %s", ratio, status);
+                std::cerr << line;
+            }
+        }
+        std::cerr << std::endl;
+
+        results.push_back(std::move(entry));
+    }
+
+    const json report = {
+        { "context", {
+            { "library", "Atomik" },
+            { "samples", options.samples },
+            { "minTimeMs", options.minTime },
+            { "threshold", options.threshold },
+        }},
+        { "benchmarks", results },
+    };
+
+    if(options.output.empty())
+        std::cout << report.dump(2) << std::endl;
+    else
+    {
+        std::ofstream file(options.output);
+        file << report.dump(2) << std::endl;
+        if(!file)
+        {
+            std::cerr << "benchmarks: could not write the results file " << options.output << '\n';
+            return 2;
+        }
+    }
+
+    if(regressions)
+        std::cerr << regressions << " benchmark(s) regressed by more than " << options.threshold * 100 << "% against the baseline." << std::endl;
+
+    return regressions ? 1 : 0;
+}
@@ -1,2 +1,3 @@
 # Only list below the public dependencies, those needed during run stage
-find_package(yaml-cpp REQUIRED)
\ No newline at end of file
+find_package(yaml-cpp REQUIRED)
+find_package(Threads REQUIRED)
\ No newline at end of file
@@ -0,0 +1,646 @@
+// Atomik is a library that implements basic chemical concepts such as elements, substances, and reactions.
+//
+// Copyright (C) 2018-2019 Allan Leal and Reaktoro Contributors
+//
+// This library is free software; you can redistribute it and/or
+// modify it under the terms of the GNU Lesser General Public
+// License as published by the Free Software Foundation; either
+// version 2.1 of the License, or (at your option) any later version.
+//
+// This library is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+// Lesser General Public License for more details.
+//
+// You should have received a copy of the GNU Lesser General Public License
+// along with this library. If not, see <http://www.gnu.org/licenses/>.
+
+// C++ includes
+#include <algorithm>
+#include <cctype>
+#include <cmath>
+#include <cstdint>
+#include <fstream>
+#include <functional>
+#include <iostream>
+#include <iterator>
+#include <memory>
+#include <numeric>
+#include <sstream>
+#include <string>
+#include <string_view>
+#include <unordered_set>
+#include <vector>
+
+// Atomik includes
+#include <Atomik/BinaryDatabase.hpp>
+#include <Atomik/Database.hpp>
+#include <Atomik/Element.hpp>
+#include <Atomik/Elements.hpp>
+#include <Atomik/StreamingWriter.hpp>
+#include <Atomik/StringList.hpp>
+#include <Atomik/Substance.hpp>
+#include <Atomik/SubstanceArchive.hpp>
+#include <Atomik/SubstanceElements.hpp>
+#include <Atomik/SubstanceFormula.hpp>
+#include <Atomik/Substances.hpp>
+using namespace Atomik;
+
+namespace {
+
+const auto usage = R"(Usage: atomik-generate [options]
+
+Generate synthetic databases of elements and substances for scale testing.
+
+The substances are aqueous ions and complexes, minerals (salts, hydrates, oxides,
+and silicates), gases, and organic liquids, drawn from weighted distributions of
+common cations, anions, and molecules. Their formulas, charges, tags, and types
+are consistent with each other, and all their elements are in the periodic table.
+The output is fully determined by the seed and the sizes.
+
+Options:
+  --help              Print this message and exit.
+  --seed N            The seed of the random number generator (default: 1).
+  --substances N      The number of substances (default: 1000).
+  --elements N        The number of elements: the first N elements of the periodic table,
+                      followed by synthetic ones with symbols starting with Q (default: 119).
+  --formats LIST      A comma-separated list of output formats among yaml, json, csv,
+                      atomikdb (binary database), and atomiksa (compressed archive)
+                      (default: yaml,json).
+  --output PREFIX     The prefix of the output files (default: synthetic), which are
+                      PREFIX-elements.{yml,json}, PREFIX-substances.{yml,json,csv,atomiksa},
+                      and PREFIX.atomikdb.
+
+The text formats are written in batches, so their memory use does not grow with
+the number of substances. The binary formats are assembled in memory.
+)";
+
+/// The number of records generated and written at a time.
+constexpr std::size_t batchSize = 1 << 16;
+
+/// The options of the generator.
+struct Options
+{
+    bool help = false;
+    std::uint64_t seed = 1;
+    std::size_t substances = 1000;
+    std::size_t elements = 119;
+    std::vector<std::string> formats = { "yaml", "json" };
+    std::string output = "synthetic";
+};
+
+/// Return the options parsed from the command line arguments.
+auto parseOptions(int argc, char** argv) -> Options
+{
+    Options options;
+    for(int i = 1; i < argc; ++i)
+    {
+        const std::string arg = argv[i];
+        auto value = [&]() -> std::string
+        {
+            if(i + 1 == argc) throw std::invalid_argument("missing value of option " + arg);
+            return argv[++i];
+        };
+        if(arg == "--help") options.help = true;
+        else if(arg == "--seed") options.seed = std::stoull(value());
+        else if(arg == "--substances") options.substances = std::stoull(value());
+        else if(arg == "--elements") options.elements = std::stoull(value());
+        else if(arg == "--formats") options.formats = StringList(value(), ',').data();
+        else if(arg == "--output") options.output = value();
+        else throw std::invalid_argument("unknown option " + arg);
+    }
+    for(const auto& format : options.formats)
+        if(format != "yaml" && format != "json" && format != "csv" && format != "atomikdb" && format != "atomiksa")
+            throw std::invalid_argument("unknown format " + format);
+    return options;
+}
+
+/// A type used to generate pseudo-random numbers (splitmix64), so that the output for
+/// a seed is the same on every platform, unlike with the distributions of the standard library.
+class Random
+{
+public:
+    /// Construct a Random object with given seed.
+    explicit Random(std::uint64_t seed) : m_state(seed) {}
+
+    /// Return the next pseudo-random 64-bit integer.
+    auto next() -> std::uint64_t
+    {
+        auto z = (m_state += 0x9e3779b97f4a7c15ull);
+        z = (z ^ (z >> 30)) * 0xbf58476d1ce4e5b9ull;
+        z = (z ^ (z >> 27)) * 0x94d049bb133111ebull;
+        return z ^ (z >> 31);
+    }
+
+    /// Return a pseudo-random number uniformly distributed in [0, 1).
+    auto uniform() -> double
+    {
+        return (next() >> 11) * 0x1.0p-53;
+    }
+
+    /// Return a pseudo-random integer uniformly distributed in [lower, upper].
+    auto integer(int lower, int upper) -> int
+    {
+        return lower + int(next() % std::uint64_t(upper - lower + 1));
+    }
+
+    /// Return true with given probability.
+    auto chance(double probability) -> bool
+    {
+        return uniform() < probability;
+    }
+
+    /// Return an item of a list chosen with probability proportional to its weight.
+    template<typename Item>
+    auto pick(const std::vector<Item>& items) -> const Item&
+    {
+        double total = 0.0;
+        for(const auto& item : items)
+            total += item.weight;
+        auto r = uniform() * total;
+        for(const auto& item : items)
+            if((r -= item.weight) < 0.0)
+                return item;
+        return items.back();
+    }
+
+private:
+    std::uint64_t m_state;
+};
+
+/// An ion or molecule used as a building block of the generated formulas.
+struct Group
+{
+    /// The formula of the group (e.g., `Ca`, `SO4`, `NH4`).
+    std::string formula;
+
+    /// The electric charge of the group.
+    int charge;
+
+    /// The relative frequency of the group.
+    double weight;
+
+    /// The tags of the substances containing the group.
+    std::vector<std::string> tags = {};
+};
+
+/// The cations in aqueous species and minerals, weighted by their abundance in geochemical databases.
+const std::vector<Group> cations = {
+    { "Na", 1, 12 }, { "K", 1, 8 }, { "Ca", 2, 12 }, { "Mg", 2, 10 }, { "Fe", 2, 7 }, { "Fe", 3, 5 },
+    { "Al", 3, 7 }, { "Mn", 2, 3 }, { "Zn", 2, 3 }, { "Cu", 2, 3 }, { "Sr", 2, 2 }, { "Ba", 2, 2 },
+    { "Li", 1, 2 }, { "Pb", 2, 2 }, { "Ni", 2, 2 }, { "Co", 2, 2 }, { "Cd", 2, 1 }, { "Hg", 2, 1 },
+    { "UO2", 2, 1 }, { "NH4", 1, 3 }, { "Cs", 1, 1 }, { "Rb", 1, 1 }, { "Cr", 3, 1 },
+};
+
+/// The anions and ligands in aqueous species and minerals.
+const std::vector<Group> anions = {
+    { "OH", -1, 15 }, { "Cl", -1, 14 }, { "F", -1, 5 }, { "Br", -1, 2 }, { "I", -1, 1 },
+    { "SO4", -2, 12, { "sulfate" } }, { "CO3", -2, 10, { "carbonate" } }, { "HCO3", -1, 8, { "carbonate" } },
+    { "NO3", -1, 5, { "nitrate" } }, { "PO4", -3, 4, { "phosphate" } }, { "HPO4", -2, 3, { "phosphate" } },
+    { "H2PO4", -1, 2, { "phosphate" } }, { "HS", -1, 3, { "sulfide" } }, { "S", -2, 2, { "sulfide" } },
+    { "CH3COO", -1, 2, { "organic" } }, { "HSiO3", -1, 1, { "silicate" } },
+};
+
+/// The gases, other than the alkanes.
+const std::vector<Group> gases = {
+    { "CO2", 0, 15 }, { "O2", 0, 10 }, { "N2", 0, 10 }, { "H2", 0, 8 }, { "CH4", 0, 8, { "organic" } },
+    { "H2S", 0, 6 }, { "SO2", 0, 5 }, { "NH3", 0, 5 }, { "H2O", 0, 8 }, { "N2O", 0, 2 }, { "NO2", 0, 2 },
+    { "CO", 0, 4 }, { "Ar", 0, 2 }, { "He", 0, 1 },
+};
+
+/// The cations in silicate minerals.
+const std::vector<Group> silicateCations = {
+    { "Na", 1, 3 }, { "K", 1, 3 }, { "Ca", 2, 3 }, { "Mg", 2, 3 }, { "Fe", 2, 2 }, { "Al", 3, 4 },
+};
+
+/// The hydration numbers of hydrated minerals.
+const int hydrations[] = { 1, 2, 3, 4, 5, 6, 7, 8, 10, 12 };
+
+/// Return true if a formula has more than one element, and so needs parentheses when repeated.
+auto compound(const std::string& formula) -> bool
+{
+    return std::count_if(formula.begin(), formula.end(), [](char c) { return std::isupper(c); }) > 1;
+}
+
+/// Return a group repeated a number of times in a formula (e.g., `Cl2`, `(SO4)3`).
+auto repeat(const std::string& formula, int count) -> std::string
+{
+    if(count == 1) return formula;
+    if(compound(formula)) return "(" + formula + ")" + std::to_string(count);
+    return formula + std::to_string(count);
+}
+
+/// Return an element with a count in a formula (e.g., `Si`, `O10`).
+auto atoms(const std::string& symbol, int count) -> std::string
+{
+    return count == 1 ? symbol : symbol + std::to_string(count);
+}
+
+/// Return the suffix of a formula with given charge, mostly as a sign and a number (e.g., `+2`), sometimes as repeated signs (e.g., `++`).
+auto chargeSuffix(int charge, Random& random) -> std::string
+{
+    if(charge == 0) return "";
+    const auto sign = charge > 0 ? '+' : '-';
+    const auto count = std::abs(charge);
+    if(count == 1) return std::string(1, sign);
+    if(random.chance(0.2)) return std::string(count, sign);
+    return sign + std::to_string(count);
+}
+
+/// The attributes of a generated substance.
+struct Generated
+{
+    std::string formula;
+    std::string name;
+    std::string type;
+    std::vector<std::string> tags;
+};
+
+/// Append the tags of a group to a list of tags, skipping duplicates.
+auto addTags(std::vector<std::string>& tags, const std::vector<std::string>& more) -> void
+{
+    for(const auto& tag : more)
+        if(std::find(tags.begin(), tags.end(), tag) == tags.end())
+            tags.push_back(tag);
+}
+
+/// Return a generated aqueous species: a free cation, a free anion, or a complex of a cation and ligands.
+auto aqueous(Random& random) -> Generated
+{
+    Generated res;
+    res.type = "aqueous";
+    res.tags = { "aqueous" };
+    int charge = 0;
+    const auto kind = random.uniform();
+    if(kind < 0.40)
+    {
+        const auto& cation = random.pick(cations);
+        res.formula = cation.formula;
+        charge = cation.charge;
+    }
+    else if(kind < 0.65)
+    {
+        const auto& anion = random.pick(anions);
+        res.formula = anion.formula;
+        charge = anion.charge;
+        addTags(res.tags, anion.tags);
+    }
+    else
+    {
+        const auto& cation = random.pick(cations);
+        const auto& ligand = random.pick(anions);
+        // At most as many ligands as keep the complex from being more negative than -1 (e.g., Al(OH)4-)
+        const auto maxCount = std::max(1, (cation.charge + 1) / -ligand.charge);
+        const auto count = std::min(maxCount, random.chance(0.55) ? 1 : random.chance(0.55) ? 2 : random.chance(0.75) ? 3 : 4);
+        res.formula = cation.formula + repeat(ligand.formula, count);
+        charge = cation.charge + count * ligand.charge;
+        res.tags.push_back("complex");
+        addTags(res.tags, ligand.tags);
+    }
+    res.tags.push_back(charge ? "charged" : "neutral");
+    res.formula += chargeSuffix(charge, random);
+    res.name = res.formula + "(aq)";
+    return res;
+}
+
+/// Return a pronounceable mineral name ending in `ite` (e.g., `Kalorite`).
+auto mineralName(Random& random) -> std::string
+{
+    static const char* consonants[] = { "b", "c", "d", "f", "g", "h", "k", "l", "m", "n", "p", "r", "s", "t", "v", "z", "br", "ch", "gr", "st", "th" };
+    static const char* vowels[] = { "a", "e", "i", "o", "u", "ae", "ia", "ou" };
+    std::string name;
+    const auto syllables = random.integer(2, 3);
+    for(auto i = 0; i < syllables; ++i)
+    {
+        name += consonants[random.next() % std::size(consonants)];
+        name += vowels[random.next() % std::size(vowels)];
+    }
+    name.pop_back();
+    name += "ite";
+    name[0] = std::toupper(name[0]);
+    return name;
+}
+
+/// Return a generated mineral: a simple or double salt (possibly hydrated), an oxide, or a silicate.
+auto mineral(Random& random) -> Generated
+{
+    Generated res;
+    res.type = "mineral";
+    res.tags = { "mineral" };
+    const auto kind = random.uniform();
+    if(kind < 0.50)
+    {
+        const auto& cation = random.pick(cations);
+        const auto& anion = random.pick(anions);
+        const auto g = std::gcd(cation.charge, -anion.charge);
+        res.formula = repeat(cation.formula, -anion.charge / g) + repeat(anion.formula, cation.charge / g);
+        addTags(res.tags, anion.tags);
+    }
+    else if(kind < 0.60)
+    {
+        const auto& cation1 = random.pick(cations);
+        const auto& cation2 = random.pick(cations);
+        const auto& anion = random.pick(anions);
+        const auto charge = cation1.charge + cation2.charge;
+        if(cation1.formula != cation2.formula && charge % anion.charge == 0)
+            res.formula = cation1.formula + cation2.formula + repeat(anion.formula, -charge / anion.charge);
+        else
+        {
+            const auto g = std::gcd(cation1.charge, -anion.charge);
+            res.formula = repeat(cation1.formula, -anion.charge / g) + repeat(anion.formula, cation1.charge / g);
+        }
+        addTags(res.tags, anion.tags);
+    }
+    else if(kind < 0.70)
+    {
+        const auto& cation = random.pick(cations);
+        const auto g = std::gcd(cation.charge, 2);
+        res.formula = repeat(cation.formula, 2 / g) + atoms("O", cation.charge / g);
+        res.tags.push_back("oxide");
+    }
+    else
+    {
+        // The oxygens balance the charges of the cations and silicons, with hydroxyls taking up an odd remainder
+        auto total = 0;
+        const auto numCations = random.integer(1, 3);
+        for(auto i = 0; i < numCations; ++i)
+        {
+            const auto& cation = random.pick(silicateCations);
+            const auto count = random.integer(1, 3);
+            res.formula += atoms(cation.formula, count);
+            total += count * cation.charge;
+        }
+        const auto silicons = random.integer(1, 8);
+        total += 4 * silicons;
+        auto hydroxyls = random.chance(0.4) ? random.integer(1, 2) : 0;
+        if((total - hydroxyls) % 2) ++hydroxyls;
+        res.formula += atoms("Si", silicons) + atoms("O", (total - hydroxyls) / 2);
+        if(hydroxyls) res.formula += repeat("OH", hydroxyls);
+        res.tags.push_back("silicate");
+    }
+    if(kind < 0.60 && random.chance(0.25))
+    {
+        // The water is grouped as (H2O)n, since in a dot notation like FeF2.6H2O the parser reads the digits around the dot as one coefficient
+        res.formula += "(H2O)" + std::to_string(hydrations[random.next() % std::size(hydrations)]);
+        res.tags.push_back("hydrate");
+    }
+    res.name = mineralName(random);
+    return res;
+}
+
+/// Return a generated gas: a common gas or a light alkane.
+auto gaseous(Random& random) -> Generated
+{
+    Generated res;
+    res.type = "gaseous";
+    res.tags = { "gaseous" };
+    if(random.chance(0.8))
+    {
+        const auto& gas = random.pick(gases);
+        res.formula = gas.formula;
+        addTags(res.tags, gas.tags);
+    }
+    else
+    {
+        const auto n = random.integer(2, 12);
+        res.formula = atoms("C", n) + atoms("H", 2 * n + 2);
+        res.tags.push_back("organic");
+    }
+    res.name = res.formula + "(g)";
+    return res;
+}
+
+/// Return a generated organic liquid: an alkane, an alcohol, or a carboxylic acid.
+auto liquid(Random& random) -> Generated
+{
+    Generated res;
+    res.type = "liquid";
+    res.tags = { "liquid", "organic" };
+    const auto n = random.integer(5, 30);
+    const auto kind = random.uniform();
+    if(kind < 0.4) res.formula = atoms("C", n) + atoms("H", 2 * n + 2);
+    else if(kind < 0.7) res.formula = atoms("C", n) + atoms("H", 2 * n + 1) + "OH";
+    else res.formula = atoms("C", n) + atoms("H", 2 * n + 1) + "COOH";
+    res.name = res.formula + "(l)";
+    return res;
+}
+
+/// Return a generated substance of a random type.
+auto generate(Random& random) -> Generated
+{
+    const auto kind = random.uniform();
+    if(kind < 0.45) return aqueous(random);
+    if(kind < 0.80) return mineral(random);
+    if(kind < 0.90) return gaseous(random);
+    return liquid(random);
+}
+
+/// Return the elements of the database: the first elements of the periodic table, followed by synthetic ones.
+auto generateElements(std::size_t size, Random& random) -> std::vector<Element>
+{
+    const auto periodic = Elements::PeriodicTable();
+    std::vector<Element> res;
+    res.reserve(size);
+    for(auto i = 0u; i < size && i < periodic.size(); ++i)
+        res.push_back(periodic[i]);
+    for(auto i = periodic.size(); i < size; ++i)
+    {
+        // The symbols Q, Qa, Qb, ..., Qz, Qaa, ... do not clash with the periodic table
+        std::string symbol = "Q";
+        for(auto k = i - periodic.size(); k > 0; k = (k - 1) / 26)
+            symbol.insert(symbol.begin() + 1, char('a' + (k - 1) % 26));
+        ElementData data;
+        data.symbol = symbol;
+        data.name = "Synthetic" + std::to_string(i + 1);
+        data.atomicNumber = i + 1;
+        data.atomicWeight = 0.001 * (1.0 + 2.5 * i * (0.9 + 0.2 * random.uniform()));
+        data.electronegativity = std::round(70.0 + 300.0 * random.uniform()) / 100.0;
+        data.tags = { "synthetic" };
+        res.push_back(Element(data));
+    }
+    return res;
+}
+
+/// Return a field of a CSV row, quoted if needed.
+auto csvField(const std::string& field) -> std::string
+{
+    if(field.find_first_of(",\"\n") == std::string::npos)
+        return field;
+    std::string res = "\"";
+    for(auto c : field)
+        res += c == '"' ? std::string("\"\"") : std::string(1, c);
+    return res + "\"";
+}
+
+/// A type used to write sequences of records to a YAML or JSON file in batches.
+class BatchedFile
+{
+public:
+    /// Construct a BatchedFile object writing to a given file in a given text format (`yaml` or `json`).
+    BatchedFile(const std::string& path, std::string format)
+    : m_file(path, std::ios::binary), m_format(std::move(format)), m_path(path)
+    {
+        if(!m_file) throw std::runtime_error("could not open the file " + path);
+        if(m_format == "json") m_file << '[';
+    }
+
+    /// Write a batch of records, which must not be empty.
+    template<typename Items>
+    auto write(const Items& items) -> void
+    {
+        if(m_format == "yaml")
+        {
+            writeYAML(m_file, items);
+            m_records += items.size();
+            return;
+        }
+        std::ostringstream ss;
+        writeJSON(ss, items);
+        const auto str = ss.str(); // the records enclosed in brackets and followed by a line break
+        if(m_records) m_file << ',';
+        m_file.write(str.data() + 1, str.size() - 3);
+        m_records += items.size();
+    }
+
+    /// Terminate the sequence of records and close the file.
+    auto close() -> void
+    {
+        if(m_format == "json") m_file << "]\n";
+        if(m_format == "yaml" && !m_records) m_file << "[]\n";
+        m_file.close();
+        if(!m_file) throw std::runtime_error("could not write the file " + m_path);
+    }
+
+private:
+    std::ofstream m_file;
+    std::string m_format;
+    std::string m_path;
+    std::size_t m_records = 0;
+};
+
+/// Return true if a list of formats has a given format.
+auto has(const std::vector<std::string>& formats, const std::string& format) -> bool
+{
+    return std::find(formats.begin(), formats.end(), format) != formats.end();
+}
+
+} // namespace
+
+int main(int argc, char** argv)
+{
+    Options options;
+    try { options = parseOptions(argc, argv); }
+    catch(const std::exception& e)
+    {
+        std::cerr << "atomik-generate: " << e.what() << "\n\n" << usage;
+        return 2;
+    }
+
+    if(options.help)
+    {
+        std::cout << usage;
+        return 0;
+    }
+
+    try
+    {
+        Random random(options.seed);
+
+        // Generate and write the elements
+        const auto elements = generateElements(options.elements, random);
+        for(auto format : { "yaml", "json" })
+        {
+            if(!has(options.formats, format)) continue;
+            BatchedFile file(options.output + "-elements." + (format == std::string("yaml") ? "yml" : "json"), format);
+            for(std::size_t offset = 0; offset < elements.size(); offset += batchSize)
+                file.write(Elements(std::vector<Element>(elements.begin() + offset, elements.begin() + std::min(offset + batchSize, elements.size()))));
+            file.close();
+        }
+
+        // Generate and write the substances in batches, keeping them in memory only for the binary formats
+        std::vector<std::unique_ptr<BatchedFile>> files;
+        for(auto format : { "yaml", "json" })
+            if(has(options.formats, format))
+                files.push_back(std::make_unique<BatchedFile>(options.output + "-substances." + (format == std::string("yaml") ? "yml" : "json"), format));
+
+        std::ofstream csv;
+        if(has(options.formats, "csv"))
+        {
+            csv.open(options.output + "-substances.csv", std::ios::binary);
+            if(!csv) throw std::runtime_error("could not open the file " + options.output + "-substances.csv");
+            csv << "name,formula,tags,type\n";
+        }
+
+        const auto binary = has(options.formats, "atomikdb") || has(options.formats, "atomiksa");
+        std::vector<Substance> all;
+
+        std::unordered_set<std::size_t> names;
+        names.reserve(options.substances);
+
+        for(std::size_t offset = 0; offset < options.substances; offset += batchSize)
+        {
+            const auto size = std::min(batchSize, options.substances - offset);
+            std::vector<Substance> batch;
+            batch.reserve(size);
+            for(std::size_t i = offset; i < offset + size; ++i)
+            {
+                auto generated = generate(random);
+                // Keep the names unique, appending the index of the substance on a clash
+                if(!names.insert(std::hash<std::string>()(generated.name)).second)
+                    generated.name += "-" + std::to_string(i);
+
+                const Substance substance(generated.formula);
+                Substance::Args args;
+                args.name = generated.name;
+                args.formula = substance.formula();
+                args.elements = substance.elements();
+                args.type = generated.type;
+                args.tags = generated.tags;
+                batch.push_back(Substance(std::move(args)));
+
+                if(csv.is_open())
+                {
+                    std::string tags;
+                    for(const auto& tag : generated.tags)
+                        tags += (tags.empty() ? "" : " ") + tag;
+                    csv << csvField(generated.name) << ',' << csvField(generated.formula) << ',' << tags << ',' << generated.type << '\n';
+                }
+            }
+
+            const Substances substances(batch);
+            for(auto& file : files)
+                file->write(substances);
+
+            if(binary)
+                std::move(batch.begin(), batch.end(), std::back_inserter(all));
+
+            std::cerr << "\ratomik-generate: " << offset + size << " of " << options.substances << " substances" << std::flush;
+        }
+        std::cerr << std::endl;
+
+        for(auto& file : files)
+            file->close();
+
+        if(csv.is_open())
+        {
+            csv.close();
+            if(!csv) throw std::runtime_error("could not write the file " + options.output + "-substances.csv");
+        }
+
+        if(binary)
+        {
+            const Substances substances(std::move(all));
+            if(has(options.formats, "atomikdb"))
+                writeBinaryDatabase(Database(Elements(elements), substances), options.output + ".atomikdb");
+            if(has(options.formats, "atomiksa"))
+                writeSubstanceArchive(substances, options.output + "-substances.atomiksa");
+        }
+    }
+    catch(const std::exception& e)
+    {
+        std::cerr << "atomik-generate: " << e.what() << '\n';
+        return 1;
+    }
+
+    return 0;
+}